@@ -53,6 +53,13 @@ typedef enum
     SDL_BLENDMODE_MUL = 0x00000008,      /**< color multiply
                                               dstRGB = (srcRGB * dstRGB) + (dstRGB * (1-srcA))
                                               dstA = dstA */
+    SDL_BLENDMODE_BLEND_PREMULTIPLIED = 0x00000010, /**< alpha blending with premultiplied source
+                                                         dstRGB = srcRGB + (dstRGB * (1-srcA))
+                                                         dstA = srcA + (dstA * (1-srcA))
+                                                         source colors must already be multiplied
+                                                         by alpha, see SDL_PremultiplyAlpha(), and
+                                                         fading with an alpha mod needs a matching
+                                                         color mod */
     SDL_BLENDMODE_INVALID = 0x7FFFFFFF
 
     /* Additional custom blend modes can be returned by SDL_ComposeCustomBlendMode() */
@@ -1684,11 +1684,45 @@ extern "C" {
  *    "0" or "nearest" - Nearest pixel sampling
  *    "1" or "linear"  - Linear filtering (supported by OpenGL and Direct3D)
  *    "2" or "best"    - Currently this is the same as "linear"
+ *    "3" or "bicubic" - Bicubic filtering (software renderer, others use "linear")
+ *    "4" or "lanczos" - Lanczos filtering (software renderer, others use "linear")
  *
  *  By default nearest pixel sampling is used
  */
 #define SDL_HINT_RENDER_SCALE_QUALITY       "SDL_RENDER_SCALE_QUALITY"
 
+/**
+ * A variable controlling how many threads the software renderer uses to draw.
+ *
+ * The render target is split into tiles and the queued draw commands are
+ * binned by the tiles they touch, then each tile is drawn by one thread of a
+ * pool owned by the renderer. Lines, scaled and rotated copies are drawn on
+ * the calling thread. The result is identical to single threaded rendering.
+ *
+ * This variable can be set to the following values:
+ *   "0" or "1" - Draw on the calling thread (default)
+ *   "N"        - Draw using up to N threads, including the calling one
+ *   "-1"       - Use one thread per CPU core
+ *
+ * This hint can be changed at any time, it takes effect the next time the
+ * command queue is flushed.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS    "SDL_RENDER_SOFTWARE_THREADS"
+
+/**
+ * A variable controlling how many frames can be read back asynchronously at once.
+ *
+ * Each frame requested with SDL_RenderReadPixelsAsync() uses one of these
+ * buffers until it is released with SDL_RenderReleaseReadback().
+ *
+ * This variable can be set to the following values:
+ *   "N" - Allow N frames to be read back at once (default 2)
+ *
+ * This hint is checked the first time SDL_RenderReadPixelsAsync() is called
+ * on a renderer.
+ */
+#define SDL_HINT_RENDER_READBACK_BUFFERS    "SDL_RENDER_READBACK_BUFFERS"
+
 /**
  *  \brief  A variable controlling whether updates to the SDL screen surface should be synchronized with the vertical refresh, to avoid tearing.
  *
@@ -1974,6 +2008,50 @@ extern "C" {
  */
 #define SDL_HINT_VIDEO_MINIMIZE_ON_FOCUS_LOSS   "SDL_VIDEO_MINIMIZE_ON_FOCUS_LOSS"
 
+/**
+ * A variable controlling where the offscreen video driver sends presented frames.
+ *
+ * Every frame presented with SDL_UpdateWindowSurface() (or the software
+ * renderer on top of it) is written to the sink, in the format chosen with
+ * SDL_HINT_VIDEO_OFFSCREEN_FRAME_FORMAT.
+ *
+ * This variable can be set to the following values:
+ *   ""            - Don't stream frames (default)
+ *   "path"        - Write frames to the file at path
+ *   "fd:N"        - Write frames to the already open file descriptor N,
+ *                   e.g. a pipe to an encoder (POSIX only)
+ *   "ring:path"   - Copy frames into a shared memory ring mapped from the
+ *                   file at path, e.g. under /dev/shm (POSIX only)
+ *
+ * A ring starts with a 64 byte header: the magic "SDLFRAME", followed by
+ * 32-bit version, header_size, format, width, height, pitch, frame_size,
+ * slot_size, slot_count and frame_count fields. Frame N is stored in slot
+ * N % slot_count, at header_size + (N % slot_count) * slot_size, and
+ * frame_count is incremented once the frame is complete. A reader's copy of
+ * frame N is intact if frame_count - N < slot_count after copying it.
+ *
+ * Streams and rings keep the size of the first frame; later frames of a
+ * different size are not written, except for raw RGB streams.
+ *
+ * Setting this hint keeps window surfaces in system memory instead of GPU
+ * textures, so it should be set before the video subsystem is initialized.
+ * Each window opens the sink when its surface is first created, and
+ * SDL_GetWindowSurface() fails if the sink can't be opened.
+ */
+#define SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK "SDL_VIDEO_OFFSCREEN_FRAME_SINK"
+
+/**
+ * A variable controlling the format of frames sent to SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK.
+ *
+ * This variable can be set to the following values:
+ *   "rgb" - Raw SDL_PIXELFORMAT_RGB888 frames, with no header (default)
+ *   "yuv" - SDL_PIXELFORMAT_IYUV frames, as a YUV4MPEG2 stream when writing
+ *           to a file or file descriptor
+ *
+ * This hint is checked when a window surface is first created.
+ */
+#define SDL_HINT_VIDEO_OFFSCREEN_FRAME_FORMAT "SDL_VIDEO_OFFSCREEN_FRAME_FORMAT"
+
 /**
  *  \brief  A variable controlling whether the libdecor Wayland backend is allowed to be used.
  *
@@ -2711,6 +2789,43 @@ extern "C" {
  */
 #define SDL_HINT_SHUTDOWN_DBUS_ON_QUIT "SDL_SHUTDOWN_DBUS_ON_QUIT"
 
+/**
+ * A variable controlling how many threads are used to convert YUV images to RGB.
+ *
+ * Large images are split into horizontal bands, aligned to the chroma
+ * subsampling, which are converted in parallel by a pool of worker threads
+ * that is kept alive until SDL_Quit(). The result is identical to a
+ * single threaded conversion.
+ *
+ * This variable can be set to the following values:
+ *   "0" or "1" - YUV images are converted on the calling thread (default)
+ *   "N"        - YUV images are converted using up to N threads, including the calling one
+ *   "-1"       - Use one thread per CPU core
+ *
+ * This hint can be changed at any time and affects SDL_ConvertPixels() and
+ * the software YUV texture implementation.
+ */
+#define SDL_HINT_YUV_CONVERSION_THREADS "SDL_YUV_CONVERSION_THREADS"
+
+/**
+ * A variable that limits which CPU features SDL uses.
+ *
+ * By default SDL uses every feature the CPU supports. This hint is a comma
+ * separated list of features to add or remove, each optionally prefixed
+ * with '+' or '-' and applied in order, for example "-all,+sse2" or
+ * "-avx2". The features are "all", "altivec", "mmx", "3dnow", "sse", "sse2",
+ * "sse3", "sse41", "sse42", "avx", "avx2", "avx512f", "arm-simd", "neon",
+ * "lsx" and "lasx".
+ *
+ * Features the CPU lacks are never enabled. The SDL_HasSSE2() family of
+ * functions reports the masked features, so this is mostly useful to test
+ * the scalar or older code paths on a newer CPU. Code that picked its path
+ * before the hint changed keeps it.
+ *
+ * This hint can be changed at any time after SDL_Init().
+ */
+#define SDL_HINT_CPU_FEATURE_MASK "SDL_CPU_FEATURE_MASK"
+
 
 /**
  *  \brief  An enumeration of hint priorities
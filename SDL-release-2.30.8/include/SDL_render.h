@@ -102,7 +102,9 @@ typedef enum
 {
     SDL_ScaleModeNearest, /**< nearest pixel sampling */
     SDL_ScaleModeLinear,  /**< linear filtering */
-    SDL_ScaleModeBest     /**< anisotropic filtering */
+    SDL_ScaleModeBest,    /**< anisotropic filtering */
+    SDL_ScaleModeBicubic, /**< bicubic filtering, software renderer only, others use linear filtering */
+    SDL_ScaleModeLanczos  /**< Lanczos-3 filtering, software renderer only, others use linear filtering */
 } SDL_ScaleMode;
 
 /**
@@ -147,6 +149,18 @@ typedef struct SDL_Renderer SDL_Renderer;
 struct SDL_Texture;
 typedef struct SDL_Texture SDL_Texture;
 
+/**
+ * A pending read of a frame, returned by SDL_RenderReadPixelsAsync()
+ */
+struct SDL_RenderReadback;
+typedef struct SDL_RenderReadback SDL_RenderReadback;
+
+/**
+ * A set of textures that surfaces are packed into, see SDL_CreateTextureAtlas()
+ */
+struct SDL_TextureAtlas;
+typedef struct SDL_TextureAtlas SDL_TextureAtlas;
+
 /* Function prototypes */
 
 /**
@@ -1679,6 +1693,117 @@ extern DECLSPEC int SDLCALL SDL_RenderGeometryRaw(SDL_Renderer *renderer,
                                                int num_vertices,
                                                const void *indices, int num_indices, int size_indices);
 
+/**
+ * Copy many portions of a texture to the current rendering target at once.
+ *
+ * This draws the same as calling SDL_RenderCopyF() for each pair of source
+ * and destination rectangles, in order, but submits them all as a single
+ * batch of geometry where the renderer supports it. Combined with a texture
+ * atlas, this lets thousands of sprites or glyphs be drawn with one draw
+ * call.
+ *
+ * The texture color, alpha and blend modes apply to all of the copies.
+ *
+ * \param renderer the rendering context
+ * \param texture the source texture
+ * \param srcrects an array of `count` source rectangles, or NULL to copy the
+ *                 entire texture each time
+ * \param dstrects an array of `count` destination rectangles
+ * \param count the number of copies
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderCopyF
+ * \sa SDL_AddSurfaceToTextureAtlas
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopySprites(SDL_Renderer * renderer,
+                                                  SDL_Texture * texture,
+                                                  const SDL_Rect * srcrects,
+                                                  const SDL_FRect * dstrects,
+                                                  int count);
+
+/**
+ * Create a texture atlas, to pack many small surfaces into a few textures.
+ *
+ * The atlas creates static textures ("pages") of the given size as needed.
+ * Surfaces are placed with a skyline allocator, next to each other with no
+ * gap between them; add a transparent border to surfaces that will be
+ * drawn scaled with linear filtering.
+ *
+ * The atlas must be destroyed before its renderer.
+ *
+ * \param renderer the rendering context
+ * \param format one of the enumerated values in SDL_PixelFormatEnum, used
+ *               for the textures of the atlas
+ * \param w the width of each texture in pixels
+ * \param h the height of each texture in pixels
+ * \returns the new atlas or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AddSurfaceToTextureAtlas
+ * \sa SDL_ClearTextureAtlas
+ * \sa SDL_DestroyTextureAtlas
+ */
+extern DECLSPEC SDL_TextureAtlas *SDLCALL SDL_CreateTextureAtlas(SDL_Renderer * renderer,
+                                                                 Uint32 format,
+                                                                 int w, int h);
+
+/**
+ * Copy a surface into free space in a texture atlas.
+ *
+ * Only the area taken by the surface is uploaded, so surfaces can be added
+ * at any time, e.g. glyphs as they are first used. If the surface doesn't
+ * fit into any of the atlas textures, a new one is created. The area can be
+ * changed later with SDL_UpdateTexture().
+ *
+ * \param atlas the atlas returned by SDL_CreateTextureAtlas()
+ * \param surface the surface to add, which must fit in one atlas texture
+ * \param texture a pointer filled in with the atlas texture holding the
+ *                surface
+ * \param rect a pointer filled in with the area of that texture holding the
+ *             surface, to use as a source rectangle when drawing
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_CreateTextureAtlas
+ * \sa SDL_RenderCopySprites
+ */
+extern DECLSPEC int SDLCALL SDL_AddSurfaceToTextureAtlas(SDL_TextureAtlas * atlas,
+                                                         SDL_Surface * surface,
+                                                         SDL_Texture ** texture,
+                                                         SDL_Rect * rect);
+
+/**
+ * Make all of the space in a texture atlas available again.
+ *
+ * The atlas keeps its textures, and the areas returned so far become
+ * invalid.
+ *
+ * \param atlas the atlas returned by SDL_CreateTextureAtlas()
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_AddSurfaceToTextureAtlas
+ */
+extern DECLSPEC void SDLCALL SDL_ClearTextureAtlas(SDL_TextureAtlas * atlas);
+
+/**
+ * Destroy a texture atlas and its textures.
+ *
+ * \param atlas the atlas returned by SDL_CreateTextureAtlas()
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_CreateTextureAtlas
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyTextureAtlas(SDL_TextureAtlas * atlas);
+
 /**
  * Read pixels from the current rendering target to an array of pixels.
  *
@@ -1710,6 +1835,77 @@ extern DECLSPEC int SDLCALL SDL_RenderReadPixels(SDL_Renderer * renderer,
                                                  Uint32 format,
                                                  void *pixels, int pitch);
 
+/**
+ * Request the pixels of the next frame shown by SDL_RenderPresent().
+ *
+ * Unlike SDL_RenderReadPixels(), this doesn't flush the rendering commands
+ * or wait for the copy. The frame is read from the window just before the
+ * next SDL_RenderPresent() shows it, into one of a few buffers owned by the
+ * renderer. If `format` differs from the window's pixel format, the pixels
+ * are converted on a separate thread while rendering goes on. Use
+ * SDL_RenderGetReadbackPixels() to get them.
+ *
+ * The number of buffers is set by the SDL_HINT_RENDER_READBACK_BUFFERS hint
+ * the first time this function is called. When they are all in use, this
+ * function fails until SDL_RenderReleaseReadback() is called on one of them.
+ *
+ * \param renderer the rendering context
+ * \param rect an SDL_Rect structure representing the area to read, or NULL
+ *             for the entire window
+ * \param format an SDL_PixelFormatEnum value of the desired format of the
+ *               pixel data, or 0 to use the format of the window
+ * \returns a handle to the pending read or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderGetReadbackPixels
+ * \sa SDL_RenderReleaseReadback
+ */
+extern DECLSPEC SDL_RenderReadback *SDLCALL SDL_RenderReadPixelsAsync(SDL_Renderer * renderer,
+                                                                     const SDL_Rect * rect,
+                                                                     Uint32 format);
+
+/**
+ * Get the pixels of a frame requested with SDL_RenderReadPixelsAsync().
+ *
+ * The pixels are available once the frame has been presented and converted
+ * to the requested format. Rows are `pitch` bytes apart. Parts of the
+ * requested area outside of the viewport are cleared, as in the window's
+ * format. The pixels stay valid until SDL_RenderReleaseReadback() is called.
+ *
+ * \param readback the handle returned by SDL_RenderReadPixelsAsync()
+ * \param wait SDL_TRUE to wait for a conversion in progress to complete
+ * \param pixels a pointer filled in with the pixel data
+ * \param pitch a pointer filled in with the pitch of the pixel data
+ * \returns 0 on success, 1 if the frame hasn't been presented yet or is
+ *          still being converted, or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderReadPixelsAsync
+ * \sa SDL_RenderReleaseReadback
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetReadbackPixels(SDL_RenderReadback * readback,
+                                                        SDL_bool wait,
+                                                        const void **pixels, int *pitch);
+
+/**
+ * Give the buffer of a frame read back to its renderer, for reuse.
+ *
+ * The handle and its pixels must not be used afterwards. Handles are also
+ * released when their renderer is destroyed.
+ *
+ * \param readback the handle returned by SDL_RenderReadPixelsAsync()
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderReadPixelsAsync
+ * \sa SDL_RenderGetReadbackPixels
+ */
+extern DECLSPEC void SDLCALL SDL_RenderReleaseReadback(SDL_RenderReadback * readback);
+
 /**
  * Update the screen with any rendering performed since the previous call.
  *
@@ -915,7 +915,8 @@ extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             const SDL_Rect * dstrect);
 
 /**
- * Perform bilinear scaling between two surfaces of the same format, 32BPP.
+ * Perform bilinear scaling between two surfaces of the same format, 16, 24
+ * or 32BPP.
  *
  * \since This function is available since SDL 2.0.16.
  */
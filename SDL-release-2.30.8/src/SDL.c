@@ -50,10 +50,12 @@
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
 #include "thread/SDL_thread_c.h"
+#include "video/SDL_yuv_c.h"
 
 /* Initialization/Cleanup routines */
 #ifndef SDL_TIMERS_DISABLED
 #include "timer/SDL_timer_c.h"
+#include "cpuinfo/SDL_cpuinfo_c.h"
 #endif
 #ifdef SDL_VIDEO_DRIVER_WINDOWS
 extern int SDL_HelperWindowCreate(void);
@@ -191,6 +193,7 @@ void SDL_InitMainThread(void)
     SDL_TicksInit();
 #endif
     SDL_LogInit();
+    SDL_InitCPUInfo();
 
     SDL_main_thread_initialized = SDL_TRUE;
 }
@@ -201,6 +204,7 @@ static void SDL_QuitMainThread(void)
         return;
     }
 
+    SDL_QuitCPUInfo();
     SDL_LogQuit();
 #ifndef SDL_TIMERS_DISABLED
     SDL_TicksQuit();
@@ -524,6 +528,10 @@ void SDL_Quit(void)
     SDL_DBus_Quit();
 #endif
 
+#if SDL_HAVE_YUV
+    SDL_QuitYUVConversionThreads();
+#endif
+
     SDL_ClearHints();
     SDL_AssertionsQuit();
 
@@ -125,6 +125,26 @@
 #define SDL_HAVE_YUV !SDL_LEAN_AND_MEAN
 #endif
 
+/* SIMD code paths wider than the compiler's baseline flags
+   - compiled per function with SDL_TARGETING("sse4.1") / SDL_TARGETING("avx2")
+   - only called after checking SDL_HasSSE41() / SDL_HasAVX2() at runtime */
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 5))
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#else
+#define SDL_TARGETING(x)
+#endif
+
+#if (defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)) && \
+    !defined(SDL_DISABLE_IMMINTRIN_H) && !defined(__EMSCRIPTEN__)
+#if defined(_MSC_VER) && (_MSC_VER >= 1800) && !defined(__clang__)
+#define SDL_SSE4_1_INTRINSICS 1
+#define SDL_AVX2_INTRINSICS   1
+#elif (defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 5))) && defined(HAVE_IMMINTRIN_H)
+#define SDL_SSE4_1_INTRINSICS 1
+#define SDL_AVX2_INTRINSICS   1
+#endif
+#endif
+
 #ifndef SDL_RENDER_DISABLED
 /* define the not defined ones as 0 */
 #ifndef SDL_VIDEO_RENDER_D3D
@@ -40,6 +40,10 @@
 
 #include "SDL_cpuinfo.h"
 #include "SDL_assert.h"
+#ifndef TEST_MAIN
+#include "SDL_hints.h"
+#include "SDL_cpuinfo_c.h"
+#endif
 
 #ifdef HAVE_SYSCONF
 #include <unistd.h>
@@ -984,7 +988,88 @@ static Uint32 SDL_GetCPUFeatures(void)
     return SDL_CPUFeatures;
 }
 
-#define CPU_FEATURE_AVAILABLE(f) ((SDL_GetCPUFeatures() & f) ? SDL_TRUE : SDL_FALSE)
+/* Features the application allows SDL to use, see SDL_HINT_CPU_FEATURE_MASK */
+static Uint32 SDL_CPUFeatureMask = 0xFFFFFFFF;
+
+#ifndef TEST_MAIN
+static const struct
+{
+    const char *name;
+    Uint32 feature;
+} SDL_CPUFeatureNames[] = {
+    { "altivec", CPU_HAS_ALTIVEC },
+    { "mmx", CPU_HAS_MMX },
+    { "3dnow", CPU_HAS_3DNOW },
+    { "sse", CPU_HAS_SSE },
+    { "sse2", CPU_HAS_SSE2 },
+    { "sse3", CPU_HAS_SSE3 },
+    { "sse41", CPU_HAS_SSE41 },
+    { "sse42", CPU_HAS_SSE42 },
+    { "avx", CPU_HAS_AVX },
+    { "avx2", CPU_HAS_AVX2 },
+    { "avx512f", CPU_HAS_AVX512F },
+    { "arm-simd", CPU_HAS_ARM_SIMD },
+    { "neon", CPU_HAS_NEON },
+    { "lsx", CPU_HAS_LSX },
+    { "lasx", CPU_HAS_LASX }
+};
+
+static Uint32 SDL_ParseCPUFeatureMask(const char *hint)
+{
+    Uint32 mask = 0xFFFFFFFF;
+    const char *spot = hint;
+
+    while (spot && *spot) {
+        const char *end = SDL_strchr(spot, ',');
+        size_t len = end ? (size_t)(end - spot) : SDL_strlen(spot);
+        SDL_bool add = SDL_TRUE;
+        Uint32 features = 0;
+        int i;
+
+        if (*spot == '+' || *spot == '-') {
+            add = (*spot == '+');
+            ++spot;
+            --len;
+        }
+        if (len == 3 && SDL_strncasecmp(spot, "all", len) == 0) {
+            features = 0xFFFFFFFF;
+        } else {
+            for (i = 0; i < SDL_arraysize(SDL_CPUFeatureNames); ++i) {
+                if (SDL_strlen(SDL_CPUFeatureNames[i].name) == len &&
+                    SDL_strncasecmp(spot, SDL_CPUFeatureNames[i].name, len) == 0) {
+                    features = SDL_CPUFeatureNames[i].feature;
+                    break;
+                }
+            }
+        }
+        if (add) {
+            mask |= features;
+        } else {
+            mask &= ~features;
+        }
+        spot = end ? end + 1 : NULL;
+    }
+    return mask;
+}
+
+static void SDLCALL SDL_CPUFeatureMaskChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_CPUFeatureMask = SDL_ParseCPUFeatureMask(hint);
+}
+
+void SDL_InitCPUInfo(void)
+{
+    SDL_AddHintCallback(SDL_HINT_CPU_FEATURE_MASK, SDL_CPUFeatureMaskChanged, NULL);
+}
+
+void SDL_QuitCPUInfo(void)
+{
+    SDL_DelHintCallback(SDL_HINT_CPU_FEATURE_MASK, SDL_CPUFeatureMaskChanged, NULL);
+    SDL_CPUFeatureMask = 0xFFFFFFFF;
+}
+#endif /* !TEST_MAIN */
+
+#define CPU_FEATURE_AVAILABLE(f) ((SDL_GetCPUFeatures() & SDL_CPUFeatureMask & f) ? SDL_TRUE : SDL_FALSE)
 
 SDL_bool SDL_HasRDTSC(void)
 {
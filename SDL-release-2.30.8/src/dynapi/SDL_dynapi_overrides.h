@@ -898,3 +898,11 @@
 #define SDL_DestroyWindowSurface SDL_DestroyWindowSurface_REAL
 #define SDL_GDKGetDefaultUser SDL_GDKGetDefaultUser_REAL
 #define SDL_GameControllerGetSteamHandle SDL_GameControllerGetSteamHandle_REAL
+#define SDL_RenderReadPixelsAsync SDL_RenderReadPixelsAsync_REAL
+#define SDL_RenderGetReadbackPixels SDL_RenderGetReadbackPixels_REAL
+#define SDL_RenderReleaseReadback SDL_RenderReleaseReadback_REAL
+#define SDL_RenderCopySprites SDL_RenderCopySprites_REAL
+#define SDL_CreateTextureAtlas SDL_CreateTextureAtlas_REAL
+#define SDL_AddSurfaceToTextureAtlas SDL_AddSurfaceToTextureAtlas_REAL
+#define SDL_ClearTextureAtlas SDL_ClearTextureAtlas_REAL
+#define SDL_DestroyTextureAtlas SDL_DestroyTextureAtlas_REAL
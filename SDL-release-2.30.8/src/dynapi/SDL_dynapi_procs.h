@@ -985,3 +985,11 @@ SDL_DYNAPI_PROC(int,SDL_DestroyWindowSurface,(SDL_Window *a),(a),return)
 SDL_DYNAPI_PROC(int,SDL_GDKGetDefaultUser,(XUserHandle *a),(a),return)
 #endif
 SDL_DYNAPI_PROC(Uint64,SDL_GameControllerGetSteamHandle,(SDL_GameController *a),(a),return)
+SDL_DYNAPI_PROC(SDL_RenderReadback*,SDL_RenderReadPixelsAsync,(SDL_Renderer *a, const SDL_Rect *b, Uint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_RenderGetReadbackPixels,(SDL_RenderReadback *a, SDL_bool b, const void **c, int *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_RenderReleaseReadback,(SDL_RenderReadback *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_RenderCopySprites,(SDL_Renderer *a, SDL_Texture *b, const SDL_Rect *c, const SDL_FRect *d, int e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_TextureAtlas*,SDL_CreateTextureAtlas,(SDL_Renderer *a, Uint32 b, int c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_AddSurfaceToTextureAtlas,(SDL_TextureAtlas *a, SDL_Surface *b, SDL_Texture **c, SDL_Rect *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_ClearTextureAtlas,(SDL_TextureAtlas *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyTextureAtlas,(SDL_TextureAtlas *a),(a),)
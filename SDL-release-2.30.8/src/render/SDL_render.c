@@ -28,6 +28,7 @@
 #include "SDL_sysrender.h"
 #include "software/SDL_render_sw_c.h"
 #include "../video/SDL_pixels_c.h"
+#include "../thread/SDL_systhread.h"
 
 #if defined(__ANDROID__)
 #include "../core/android/SDL_android.h"
@@ -89,6 +90,10 @@ this should probably be removed at some point in the future.  --ryan. */
     SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_DST_COLOR, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, \
                           SDL_BLENDFACTOR_ZERO, SDL_BLENDFACTOR_ONE, SDL_BLENDOPERATION_ADD)
 
+#define SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL                                                              \
+    SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, \
+                          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD)
+
 #ifndef SDL_RENDER_DISABLED
 static const SDL_RenderDriver *render_drivers[] = {
 #if SDL_VIDEO_RENDER_D3D
@@ -260,6 +265,7 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
     renderer->color_queued = SDL_FALSE;
     renderer->viewport_queued = SDL_FALSE;
     renderer->cliprect_queued = SDL_FALSE;
+    renderer->last_queued_draw = NULL;
     return retval;
 }
 
@@ -324,16 +330,24 @@ static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
 
     /* !!! FIXME: are there threading limitations in SDL's render API? If not, we need to mutex this. */
     retval = renderer->render_commands_pool;
-    if (retval) {
-        renderer->render_commands_pool = retval->next;
-        retval->next = NULL;
-    } else {
-        retval = SDL_calloc(1, sizeof(*retval));
-        if (!retval) {
+    if (!retval) {
+        /* Grow the pool by a whole block, so a frame's commands sit together in memory */
+        SDL_RenderCommandBlock *block = (SDL_RenderCommandBlock *)SDL_calloc(1, sizeof(*block));
+        int i;
+
+        if (!block) {
             SDL_OutOfMemory();
             return NULL;
         }
+        for (i = 0; i < SDL_RENDER_COMMAND_BLOCK_SIZE - 1; i++) {
+            block->commands[i].next = &block->commands[i + 1];
+        }
+        block->next = renderer->render_command_blocks;
+        renderer->render_command_blocks = block;
+        retval = &block->commands[0];
     }
+    renderer->render_commands_pool = retval->next;
+    retval->next = NULL;
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
     if (renderer->render_commands_tail) {
@@ -487,14 +501,59 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
     return cmd;
 }
 
+/* Appends a just queued draw of points, rects or triangles to the previous command, if that one is the
+ * same kind of draw with the same state and its vertices end where the new ones start.
+ * 'first' is where the vertex data ended before the backend queued the draw. */
+static void MergeRenderCommand(SDL_Renderer *renderer, SDL_RenderCommand *cmd, size_t first)
+{
+    SDL_RenderCommand *prev = renderer->last_queued_draw;
+    const size_t size = renderer->vertex_data_used - first;
+
+    SDL_assert(cmd == renderer->render_commands_tail);
+
+    /* Only draws the backend put at 'first' in the vertex data, without padding, can be merged */
+    if (cmd->data.draw.first != first || size == 0 || cmd->data.draw.count == 0) {
+        renderer->last_queued_draw = NULL;
+        return;
+    }
+
+    if (prev && prev->next == cmd &&
+        prev->command == cmd->command &&
+        prev->data.draw.first + renderer->last_queued_draw_size == first &&
+        /* the same number of bytes per point, rect or vertex */
+        renderer->last_queued_draw_size * cmd->data.draw.count == size * prev->data.draw.count &&
+        prev->data.draw.r == cmd->data.draw.r &&
+        prev->data.draw.g == cmd->data.draw.g &&
+        prev->data.draw.b == cmd->data.draw.b &&
+        prev->data.draw.a == cmd->data.draw.a &&
+        prev->data.draw.blend == cmd->data.draw.blend &&
+        prev->data.draw.texture == cmd->data.draw.texture) {
+        prev->data.draw.count += cmd->data.draw.count;
+        renderer->last_queued_draw_size += size;
+
+        /* Give the command back to the pool */
+        prev->next = NULL;
+        renderer->render_commands_tail = prev;
+        cmd->next = renderer->render_commands_pool;
+        renderer->render_commands_pool = cmd;
+        return;
+    }
+
+    renderer->last_queued_draw = cmd;
+    renderer->last_queued_draw_size = size;
+}
+
 static int QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, const int count)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL);
     int retval = -1;
     if (cmd) {
+        const size_t first = renderer->vertex_data_used;
         retval = renderer->QueueDrawPoints(renderer, cmd, points, count);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            MergeRenderCommand(renderer, cmd, first);
         }
     }
     return retval;
@@ -522,6 +581,7 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
     cmd = PrepQueueCmdDraw(renderer, (use_rendergeometry ? SDL_RENDERCMD_GEOMETRY : SDL_RENDERCMD_FILL_RECTS), NULL);
 
     if (cmd) {
+        const size_t first = renderer->vertex_data_used;
         if (use_rendergeometry) {
             SDL_bool isstack1;
             SDL_bool isstack2;
@@ -572,6 +632,8 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
 
                 if (retval < 0) {
                     cmd->command = SDL_RENDERCMD_NO_OP;
+                } else {
+                    MergeRenderCommand(renderer, cmd, first);
                 }
             }
             SDL_small_free(xy, isstack1);
@@ -581,6 +643,8 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
             retval = renderer->QueueFillRects(renderer, cmd, rects, count);
             if (retval < 0) {
                 cmd->command = SDL_RENDERCMD_NO_OP;
+            } else {
+                MergeRenderCommand(renderer, cmd, first);
             }
         }
     }
@@ -627,6 +691,7 @@ static int QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
     int retval = -1;
     cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_GEOMETRY, texture);
     if (cmd) {
+        const size_t first = renderer->vertex_data_used;
         retval = renderer->QueueGeometry(renderer, cmd, texture,
                                          xy, xy_stride,
                                          color, color_stride, uv, uv_stride,
@@ -634,6 +699,8 @@ static int QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                                          scale_x, scale_y);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            MergeRenderCommand(renderer, cmd, first);
         }
     }
     return retval;
@@ -1248,6 +1315,10 @@ static SDL_ScaleMode SDL_GetScaleMode(void)
         return SDL_ScaleModeLinear;
     } else if (SDL_strcasecmp(hint, "best") == 0) {
         return SDL_ScaleModeBest;
+    } else if (SDL_strcasecmp(hint, "bicubic") == 0) {
+        return SDL_ScaleModeBicubic;
+    } else if (SDL_strcasecmp(hint, "lanczos") == 0) {
+        return SDL_ScaleModeLanczos;
     } else {
         return (SDL_ScaleMode)SDL_atoi(hint);
     }
@@ -4183,26 +4254,417 @@ int SDL_RenderGeometryRaw(SDL_Renderer *renderer,
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
 
-int SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
-                         Uint32 format, void *pixels, int pitch)
+int SDL_RenderCopySprites(SDL_Renderer *renderer, SDL_Texture *texture,
+                          const SDL_Rect *srcrects, const SDL_FRect *dstrects, int count)
 {
-    SDL_Rect real_rect;
+    SDL_Rect texture_rect;
+    SDL_FRect viewport;
+    SDL_bool isstack1;
+    SDL_bool isstack2;
+    float *xy;
+    int *indices;
+    int i;
+    int retval = 0;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
 
-    if (!renderer->RenderReadPixels) {
-        return SDL_Unsupported();
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
     }
 
-    FlushRenderCommands(renderer); /* we need to render before we read the results. */
+    if (!dstrects) {
+        return SDL_InvalidParamError("dstrects");
+    }
 
-    if (!format) {
-        if (!renderer->target) {
-            format = SDL_GetWindowPixelFormat(renderer->window);
+#if DONT_DRAW_WHILE_HIDDEN
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+#endif
+
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Renderers that copy rectangles natively don't gain anything from geometry */
+    if (renderer->QueueCopy) {
+        for (i = 0; i < count; ++i) {
+            retval = SDL_RenderCopyF(renderer, texture, srcrects ? &srcrects[i] : NULL, &dstrects[i]);
+            if (retval < 0) {
+                break;
+            }
+        }
+        return retval;
+    }
+
+    texture_rect.x = 0;
+    texture_rect.y = 0;
+    texture_rect.w = texture->w;
+    texture_rect.h = texture->h;
+    RenderGetViewportSize(renderer, &viewport);
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    /* Interleaved x, y, u, v for each vertex */
+    xy = SDL_small_alloc(float, 4 * 4 * count, &isstack1);
+    indices = SDL_small_alloc(int, 6 * count, &isstack2);
+    if (xy && indices) {
+        float *ptr_xy = xy;
+        int *ptr_indices = indices;
+        const int xy_stride = 4 * sizeof(float);
+        const int *rect_index_order = renderer->rect_index_order;
+        int cur_index = 0;
+
+        /* Build the same quads SDL_RenderCopyF() would, skipping the ones it would skip */
+        for (i = 0; i < count; ++i) {
+            const SDL_FRect *dstrect = &dstrects[i];
+            SDL_Rect srcrect = texture_rect;
+            float minu, minv, maxu, maxv;
+            float minx, miny, maxx, maxy;
+
+            if (srcrects && !SDL_IntersectRect(&srcrects[i], &texture_rect, &srcrect)) {
+                continue;
+            }
+            if (!SDL_HasIntersectionF(dstrect, &viewport)) {
+                continue;
+            }
+
+            minu = (float)(srcrect.x) / (float)texture->w;
+            minv = (float)(srcrect.y) / (float)texture->h;
+            maxu = (float)(srcrect.x + srcrect.w) / (float)texture->w;
+            maxv = (float)(srcrect.y + srcrect.h) / (float)texture->h;
+
+            minx = dstrect->x;
+            miny = dstrect->y;
+            maxx = dstrect->x + dstrect->w;
+            maxy = dstrect->y + dstrect->h;
+
+            *ptr_xy++ = minx;
+            *ptr_xy++ = miny;
+            *ptr_xy++ = minu;
+            *ptr_xy++ = minv;
+            *ptr_xy++ = maxx;
+            *ptr_xy++ = miny;
+            *ptr_xy++ = maxu;
+            *ptr_xy++ = minv;
+            *ptr_xy++ = maxx;
+            *ptr_xy++ = maxy;
+            *ptr_xy++ = maxu;
+            *ptr_xy++ = maxv;
+            *ptr_xy++ = minx;
+            *ptr_xy++ = maxy;
+            *ptr_xy++ = minu;
+            *ptr_xy++ = maxv;
+
+            *ptr_indices++ = cur_index + rect_index_order[0];
+            *ptr_indices++ = cur_index + rect_index_order[1];
+            *ptr_indices++ = cur_index + rect_index_order[2];
+            *ptr_indices++ = cur_index + rect_index_order[3];
+            *ptr_indices++ = cur_index + rect_index_order[4];
+            *ptr_indices++ = cur_index + rect_index_order[5];
+            cur_index += 4;
+        }
+
+        if (cur_index > 0) {
+            texture->last_command_generation = renderer->render_command_generation;
+
+            retval = QueueCmdGeometry(renderer, texture,
+                                      xy, xy_stride, &texture->color, 0 /* color_stride */, xy + 2, xy_stride,
+                                      cur_index,
+                                      indices, cur_index / 4 * 6, 4,
+                                      renderer->scale.x, renderer->scale.y);
+            if (retval == 0) {
+                retval = FlushRenderCommandsIfNotBatching(renderer);
+            }
+        }
+    } else {
+        retval = SDL_OutOfMemory();
+    }
+    SDL_small_free(xy, isstack1);
+    SDL_small_free(indices, isstack2);
+
+    return retval;
+}
+
+/* A horizontal segment of the top of the packed area of an atlas texture */
+typedef struct SDL_AtlasSkylineNode
+{
+    int x;
+    int y;
+    int w;
+} SDL_AtlasSkylineNode;
+
+typedef struct SDL_TextureAtlasPage
+{
+    SDL_Texture *texture;
+    SDL_AtlasSkylineNode *skyline; /* sorted by x, covering the texture width */
+    int num_nodes;
+} SDL_TextureAtlasPage;
+
+struct SDL_TextureAtlas
+{
+    SDL_Renderer *renderer;
+    Uint32 format;
+    int w;
+    int h;
+    SDL_TextureAtlasPage *pages;
+    int num_pages;
+};
+
+static void ResetAtlasSkyline(SDL_TextureAtlasPage *page, int w)
+{
+    page->skyline[0].x = 0;
+    page->skyline[0].y = 0;
+    page->skyline[0].w = w;
+    page->num_nodes = 1;
+}
+
+/* Returns the lowest y where a w x h area starting at the given node fits, or -1 */
+static int FitAtlasSkyline(const SDL_TextureAtlas *atlas, const SDL_TextureAtlasPage *page, int index, int w, int h)
+{
+    int y = 0;
+    int remaining = w;
+
+    if (page->skyline[index].x + w > atlas->w) {
+        return -1;
+    }
+    while (remaining > 0) {
+        y = SDL_max(y, page->skyline[index].y);
+        if (y + h > atlas->h) {
+            return -1;
+        }
+        remaining -= page->skyline[index].w;
+        ++index;
+    }
+    return y;
+}
+
+/* Finds the place with the lowest top for a w x h area, breaking ties with the narrowest node */
+static SDL_bool FindAtlasSpace(const SDL_TextureAtlas *atlas, const SDL_TextureAtlasPage *page, int w, int h, int *node, SDL_Rect *area)
+{
+    int best_top = atlas->h + 1;
+    int best_w = 0;
+    int i;
+
+    *node = -1;
+    for (i = 0; i < page->num_nodes; ++i) {
+        const int y = FitAtlasSkyline(atlas, page, i, w, h);
+
+        if (y >= 0 && (y + h < best_top || (y + h == best_top && page->skyline[i].w < best_w))) {
+            best_top = y + h;
+            best_w = page->skyline[i].w;
+            *node = i;
+            area->x = page->skyline[i].x;
+            area->y = y;
+            area->w = w;
+            area->h = h;
+        }
+    }
+    return *node >= 0;
+}
+
+static void AddAtlasSkyline(SDL_TextureAtlasPage *page, int index, const SDL_Rect *area)
+{
+    SDL_AtlasSkylineNode *skyline = page->skyline;
+    const int right = area->x + area->w;
+    int i;
+
+    SDL_memmove(&skyline[index + 1], &skyline[index], (page->num_nodes - index) * sizeof(*skyline));
+    skyline[index].x = area->x;
+    skyline[index].y = area->y + area->h;
+    skyline[index].w = area->w;
+    ++page->num_nodes;
+
+    /* Trim the nodes now under the new one */
+    i = index + 1;
+    while (i < page->num_nodes && skyline[i].x < right) {
+        if (skyline[i].x + skyline[i].w <= right) {
+            SDL_memmove(&skyline[i], &skyline[i + 1], (page->num_nodes - i - 1) * sizeof(*skyline));
+            --page->num_nodes;
         } else {
-            format = renderer->target->format;
+            skyline[i].w -= right - skyline[i].x;
+            skyline[i].x = right;
+            break;
+        }
+    }
+
+    /* Merge neighbours at the same height */
+    i = 0;
+    while (i + 1 < page->num_nodes) {
+        if (skyline[i].y == skyline[i + 1].y) {
+            skyline[i].w += skyline[i + 1].w;
+            SDL_memmove(&skyline[i + 1], &skyline[i + 2], (page->num_nodes - i - 2) * sizeof(*skyline));
+            --page->num_nodes;
+        } else {
+            ++i;
+        }
+    }
+}
+
+static SDL_TextureAtlasPage *AddTextureAtlasPage(SDL_TextureAtlas *atlas)
+{
+    SDL_TextureAtlasPage *pages;
+    SDL_TextureAtlasPage *page;
+
+    pages = (SDL_TextureAtlasPage *)SDL_realloc(atlas->pages, (atlas->num_pages + 1) * sizeof(*pages));
+    if (!pages) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    atlas->pages = pages;
+
+    page = &pages[atlas->num_pages];
+    /* Nodes are at least one pixel wide, plus one while adding a node */
+    page->skyline = (SDL_AtlasSkylineNode *)SDL_malloc((atlas->w + 1) * sizeof(*page->skyline));
+    if (!page->skyline) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    page->texture = SDL_CreateTexture(atlas->renderer, atlas->format, SDL_TEXTUREACCESS_STATIC, atlas->w, atlas->h);
+    if (!page->texture) {
+        SDL_free(page->skyline);
+        return NULL;
+    }
+    if (SDL_ISPIXELFORMAT_ALPHA(atlas->format)) {
+        SDL_SetTextureBlendMode(page->texture, SDL_BLENDMODE_BLEND);
+    }
+    ResetAtlasSkyline(page, atlas->w);
+    ++atlas->num_pages;
+    return page;
+}
+
+SDL_TextureAtlas *SDL_CreateTextureAtlas(SDL_Renderer *renderer, Uint32 format, int w, int h)
+{
+    SDL_TextureAtlas *atlas;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    if (SDL_ISPIXELFORMAT_FOURCC(format)) {
+        SDL_SetError("Texture atlases need a packed pixel format");
+        return NULL;
+    }
+    if (w <= 0 || h <= 0) {
+        SDL_SetError("Texture atlas dimensions can't be 0");
+        return NULL;
+    }
+
+    atlas = (SDL_TextureAtlas *)SDL_calloc(1, sizeof(*atlas));
+    if (!atlas) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    atlas->renderer = renderer;
+    atlas->format = format;
+    atlas->w = w;
+    atlas->h = h;
+
+    /* Create the first texture right away, to catch unsupported formats and sizes */
+    if (!AddTextureAtlasPage(atlas)) {
+        SDL_DestroyTextureAtlas(atlas);
+        return NULL;
+    }
+    return atlas;
+}
+
+int SDL_AddSurfaceToTextureAtlas(SDL_TextureAtlas *atlas, SDL_Surface *surface, SDL_Texture **texture, SDL_Rect *rect)
+{
+    SDL_TextureAtlasPage *page = NULL;
+    SDL_Surface *converted = NULL;
+    SDL_Rect area;
+    int node = -1;
+    int retval;
+    int i;
+
+    if (!atlas) {
+        return SDL_InvalidParamError("atlas");
+    }
+    if (!surface) {
+        return SDL_InvalidParamError("surface");
+    }
+    if (!texture) {
+        return SDL_InvalidParamError("texture");
+    }
+    if (!rect) {
+        return SDL_InvalidParamError("rect");
+    }
+    if (surface->w <= 0 || surface->h <= 0 || surface->w > atlas->w || surface->h > atlas->h) {
+        return SDL_SetError("A %dx%d surface doesn't fit in a %dx%d texture atlas", surface->w, surface->h, atlas->w, atlas->h);
+    }
+
+    for (i = 0; i < atlas->num_pages; ++i) {
+        if (FindAtlasSpace(atlas, &atlas->pages[i], surface->w, surface->h, &node, &area)) {
+            page = &atlas->pages[i];
+            break;
+        }
+    }
+    if (!page) {
+        page = AddTextureAtlasPage(atlas);
+        if (!page) {
+            return -1;
+        }
+        FindAtlasSpace(atlas, page, surface->w, surface->h, &node, &area);
+    }
+
+    if (surface->format->format != atlas->format) {
+        converted = SDL_ConvertSurfaceFormat(surface, atlas->format, 0);
+        if (!converted) {
+            return -1;
         }
+        surface = converted;
+    }
+    if (SDL_LockSurface(surface) < 0) {
+        SDL_FreeSurface(converted);
+        return -1;
+    }
+    retval = SDL_UpdateTexture(page->texture, &area, surface->pixels, surface->pitch);
+    SDL_UnlockSurface(surface);
+    SDL_FreeSurface(converted);
+    if (retval < 0) {
+        return retval;
+    }
+
+    AddAtlasSkyline(page, node, &area);
+    *texture = page->texture;
+    *rect = area;
+    return 0;
+}
+
+void SDL_ClearTextureAtlas(SDL_TextureAtlas *atlas)
+{
+    int i;
+
+    if (!atlas) {
+        return;
+    }
+    for (i = 0; i < atlas->num_pages; ++i) {
+        ResetAtlasSkyline(&atlas->pages[i], atlas->w);
+    }
+}
+
+void SDL_DestroyTextureAtlas(SDL_TextureAtlas *atlas)
+{
+    int i;
+
+    if (!atlas) {
+        return;
+    }
+    for (i = 0; i < atlas->num_pages; ++i) {
+        SDL_DestroyTexture(atlas->pages[i].texture);
+        SDL_free(atlas->pages[i].skyline);
     }
+    SDL_free(atlas->pages);
+    SDL_free(atlas);
+}
+
+/* Reads the part of rect inside the viewport from the render target, the queue must have been flushed */
+static int ReadPixelsFromTarget(SDL_Renderer *renderer, const SDL_Rect *rect,
+                                Uint32 format, void *pixels, int pitch)
+{
+    SDL_Rect real_rect;
 
     real_rect.x = (int)SDL_floor(renderer->viewport.x);
     real_rect.y = (int)SDL_floor(renderer->viewport.y);
@@ -4225,6 +4687,345 @@ int SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
                                       format, pixels, pitch);
 }
 
+int SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
+                         Uint32 format, void *pixels, int pitch)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!renderer->RenderReadPixels) {
+        return SDL_Unsupported();
+    }
+
+    FlushRenderCommands(renderer); /* we need to render before we read the results. */
+
+    if (!format) {
+        if (!renderer->target) {
+            format = SDL_GetWindowPixelFormat(renderer->window);
+        } else {
+            format = renderer->target->format;
+        }
+    }
+
+    return ReadPixelsFromTarget(renderer, rect, format, pixels, pitch);
+}
+
+static void *GrowReadbackBuffer(void **pixels, size_t *size, size_t needed)
+{
+    if (*size < needed) {
+        void *ptr = SDL_realloc(*pixels, needed);
+        if (!ptr) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        *pixels = ptr;
+        *size = needed;
+    }
+    return *pixels;
+}
+
+static int SDLCALL SDL_RenderReadbackThread(void *data)
+{
+    SDL_Renderer *renderer = (SDL_Renderer *)data;
+
+    SDL_LockMutex(renderer->readback_lock);
+    while (!renderer->readback_quit) {
+        SDL_RenderReadback *readback = NULL;
+        int i;
+
+        for (i = 0; i < renderer->num_readbacks; ++i) {
+            if (renderer->readbacks[i].state == SDL_RENDERREADBACK_CONVERTING) {
+                readback = &renderer->readbacks[i];
+                break;
+            }
+        }
+        if (!readback) {
+            SDL_CondWait(renderer->readback_cond, renderer->readback_lock);
+            continue;
+        }
+
+        /* Only this thread touches a converting readback */
+        SDL_UnlockMutex(renderer->readback_lock);
+        readback->retval = SDL_ConvertPixels(readback->rect.w, readback->rect.h,
+                                             readback->read_format, readback->read_pixels, readback->read_pitch,
+                                             readback->format, readback->pixels, readback->pitch);
+        SDL_LockMutex(renderer->readback_lock);
+
+        readback->state = SDL_RENDERREADBACK_READY;
+        SDL_CondBroadcast(renderer->readback_cond);
+    }
+    SDL_UnlockMutex(renderer->readback_lock);
+    return 0;
+}
+
+static int InitRenderReadbacks(SDL_Renderer *renderer)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_READBACK_BUFFERS);
+    int num_readbacks = hint ? SDL_atoi(hint) : 2;
+    int i;
+
+    if (num_readbacks < 1) {
+        num_readbacks = 1;
+    }
+
+    renderer->readback_lock = SDL_CreateMutex();
+    renderer->readback_cond = SDL_CreateCond();
+    renderer->readbacks = (SDL_RenderReadback *)SDL_calloc(num_readbacks, sizeof(*renderer->readbacks));
+    if (!renderer->readback_lock || !renderer->readback_cond || !renderer->readbacks) {
+        SDL_DestroyCond(renderer->readback_cond);
+        SDL_DestroyMutex(renderer->readback_lock);
+        SDL_free(renderer->readbacks);
+        renderer->readback_cond = NULL;
+        renderer->readback_lock = NULL;
+        renderer->readbacks = NULL;
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < num_readbacks; ++i) {
+        renderer->readbacks[i].renderer = renderer;
+    }
+    renderer->num_readbacks = num_readbacks;
+    return 0;
+}
+
+static void QuitRenderReadbacks(SDL_Renderer *renderer)
+{
+    int i;
+
+    if (!renderer->readbacks) {
+        return;
+    }
+
+    if (renderer->readback_thread) {
+        SDL_LockMutex(renderer->readback_lock);
+        renderer->readback_quit = SDL_TRUE;
+        SDL_CondBroadcast(renderer->readback_cond);
+        SDL_UnlockMutex(renderer->readback_lock);
+        SDL_WaitThread(renderer->readback_thread, NULL);
+        renderer->readback_thread = NULL;
+    }
+
+    for (i = 0; i < renderer->num_readbacks; ++i) {
+        SDL_free(renderer->readbacks[i].pixels);
+        SDL_free(renderer->readbacks[i].read_pixels);
+    }
+    SDL_free(renderer->readbacks);
+    renderer->readbacks = NULL;
+    renderer->num_readbacks = 0;
+    SDL_DestroyCond(renderer->readback_cond);
+    SDL_DestroyMutex(renderer->readback_lock);
+    renderer->readback_cond = NULL;
+    renderer->readback_lock = NULL;
+}
+
+/* Reads the frame about to be presented for the pending readbacks */
+static void CaptureRenderReadbacks(SDL_Renderer *renderer)
+{
+    SDL_bool converting = SDL_FALSE;
+    Uint32 window_format;
+    int i;
+
+    if (!renderer->readbacks) {
+        return;
+    }
+
+    window_format = renderer->window ? SDL_GetWindowPixelFormat(renderer->window) : SDL_PIXELFORMAT_UNKNOWN;
+
+    for (i = 0; i < renderer->num_readbacks; ++i) {
+        SDL_RenderReadback *readback = &renderer->readbacks[i];
+        SDL_RenderReadbackState state;
+
+        SDL_LockMutex(renderer->readback_lock);
+        state = readback->state;
+        SDL_UnlockMutex(renderer->readback_lock);
+        if (state != SDL_RENDERREADBACK_PENDING) {
+            continue;
+        }
+
+        if (renderer->target) {
+            readback->retval = -1;
+        } else if (window_format == SDL_PIXELFORMAT_UNKNOWN || window_format == readback->format ||
+                   SDL_ISPIXELFORMAT_FOURCC(window_format)) {
+            /* Nothing to convert, or we don't know how */
+            SDL_memset(readback->pixels, 0, (size_t)readback->pitch * readback->rect.h);
+            readback->retval = ReadPixelsFromTarget(renderer, &readback->rect, readback->format, readback->pixels, readback->pitch);
+        } else {
+            const int read_pitch = ((readback->rect.w * SDL_BYTESPERPIXEL(window_format)) + 3) & ~3;
+
+            if (!GrowReadbackBuffer(&readback->read_pixels, &readback->read_pixels_size, (size_t)read_pitch * readback->rect.h)) {
+                readback->retval = -1;
+            } else {
+                readback->read_format = window_format;
+                readback->read_pitch = read_pitch;
+                SDL_memset(readback->read_pixels, 0, (size_t)read_pitch * readback->rect.h);
+                readback->retval = ReadPixelsFromTarget(renderer, &readback->rect, window_format, readback->read_pixels, read_pitch);
+                if (readback->retval == 0) {
+                    converting = SDL_TRUE;
+                    SDL_LockMutex(renderer->readback_lock);
+                    readback->state = SDL_RENDERREADBACK_CONVERTING;
+                    SDL_UnlockMutex(renderer->readback_lock);
+                    continue;
+                }
+            }
+        }
+        SDL_LockMutex(renderer->readback_lock);
+        readback->state = SDL_RENDERREADBACK_READY;
+        SDL_UnlockMutex(renderer->readback_lock);
+    }
+
+    if (converting) {
+        if (!renderer->readback_thread) {
+            renderer->readback_quit = SDL_FALSE;
+            renderer->readback_thread = SDL_CreateThreadInternal(SDL_RenderReadbackThread, "SDLRenderReadback", 0, renderer);
+        }
+        if (renderer->readback_thread) {
+            SDL_LockMutex(renderer->readback_lock);
+            SDL_CondSignal(renderer->readback_cond);
+            SDL_UnlockMutex(renderer->readback_lock);
+        } else {
+            /* No thread, convert them here */
+            SDL_LockMutex(renderer->readback_lock);
+            for (i = 0; i < renderer->num_readbacks; ++i) {
+                SDL_RenderReadback *readback = &renderer->readbacks[i];
+
+                if (readback->state == SDL_RENDERREADBACK_CONVERTING) {
+                    readback->retval = SDL_ConvertPixels(readback->rect.w, readback->rect.h,
+                                                         readback->read_format, readback->read_pixels, readback->read_pitch,
+                                                         readback->format, readback->pixels, readback->pitch);
+                    readback->state = SDL_RENDERREADBACK_READY;
+                }
+            }
+            SDL_UnlockMutex(renderer->readback_lock);
+        }
+    }
+}
+
+SDL_RenderReadback *SDL_RenderReadPixelsAsync(SDL_Renderer *renderer, const SDL_Rect *rect, Uint32 format)
+{
+    SDL_RenderReadback *readback = NULL;
+    SDL_Rect real_rect;
+    int i, pitch;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    if (!renderer->RenderReadPixels) {
+        SDL_Unsupported();
+        return NULL;
+    }
+
+    if (!format) {
+        if (!renderer->window) {
+            SDL_InvalidParamError("format");
+            return NULL;
+        }
+        format = SDL_GetWindowPixelFormat(renderer->window);
+    }
+    if (format == SDL_PIXELFORMAT_UNKNOWN || SDL_ISPIXELFORMAT_FOURCC(format)) {
+        SDL_SetError("Unsupported readback format: %s", SDL_GetPixelFormatName(format));
+        return NULL;
+    }
+
+    if (rect) {
+        real_rect = *rect;
+    } else {
+        real_rect.x = 0;
+        real_rect.y = 0;
+        if (SDL_GetRendererOutputSize(renderer, &real_rect.w, &real_rect.h) < 0) {
+            return NULL;
+        }
+    }
+    if (real_rect.w <= 0 || real_rect.h <= 0) {
+        SDL_InvalidParamError("rect");
+        return NULL;
+    }
+
+    if (!renderer->readbacks && InitRenderReadbacks(renderer) < 0) {
+        return NULL;
+    }
+
+    /* Claim a free readback under the lock, the readback thread looks at all their states */
+    SDL_LockMutex(renderer->readback_lock);
+    for (i = 0; i < renderer->num_readbacks; ++i) {
+        if (renderer->readbacks[i].state == SDL_RENDERREADBACK_FREE) {
+            readback = &renderer->readbacks[i];
+            break;
+        }
+    }
+    SDL_UnlockMutex(renderer->readback_lock);
+    if (!readback) {
+        SDL_SetError("All %d readback buffers are in use", renderer->num_readbacks);
+        return NULL;
+    }
+
+    pitch = ((real_rect.w * SDL_BYTESPERPIXEL(format)) + 3) & ~3;
+    if (!GrowReadbackBuffer(&readback->pixels, &readback->pixels_size, (size_t)pitch * real_rect.h)) {
+        return NULL;
+    }
+    readback->rect = real_rect;
+    readback->format = format;
+    readback->pitch = pitch;
+    readback->retval = 0;
+
+    SDL_LockMutex(renderer->readback_lock);
+    readback->state = SDL_RENDERREADBACK_PENDING;
+    SDL_UnlockMutex(renderer->readback_lock);
+    return readback;
+}
+
+int SDL_RenderGetReadbackPixels(SDL_RenderReadback *readback, SDL_bool wait, const void **pixels, int *pitch)
+{
+    SDL_Renderer *renderer;
+    SDL_RenderReadbackState state;
+
+    if (!readback) {
+        return SDL_InvalidParamError("readback");
+    }
+    renderer = readback->renderer;
+
+    SDL_LockMutex(renderer->readback_lock);
+    while (wait && readback->state == SDL_RENDERREADBACK_CONVERTING) {
+        SDL_CondWait(renderer->readback_cond, renderer->readback_lock);
+    }
+    state = readback->state;
+    SDL_UnlockMutex(renderer->readback_lock);
+
+    switch (state) {
+    case SDL_RENDERREADBACK_FREE:
+        return SDL_InvalidParamError("readback");
+    case SDL_RENDERREADBACK_PENDING:
+    case SDL_RENDERREADBACK_CONVERTING:
+        return 1;
+    default:
+        break;
+    }
+
+    if (readback->retval < 0) {
+        return SDL_SetError("Couldn't read back the frame");
+    }
+    if (pixels) {
+        *pixels = readback->pixels;
+    }
+    if (pitch) {
+        *pitch = readback->pitch;
+    }
+    return 0;
+}
+
+void SDL_RenderReleaseReadback(SDL_RenderReadback *readback)
+{
+    SDL_Renderer *renderer;
+
+    if (!readback) {
+        return;
+    }
+    renderer = readback->renderer;
+
+    SDL_LockMutex(renderer->readback_lock);
+    while (readback->state == SDL_RENDERREADBACK_CONVERTING) {
+        SDL_CondWait(renderer->readback_cond, renderer->readback_lock);
+    }
+    readback->state = SDL_RENDERREADBACK_FREE;
+    SDL_UnlockMutex(renderer->readback_lock);
+}
+
 static void SDL_RenderSimulateVSync(SDL_Renderer *renderer)
 {
     Uint32 now, elapsed;
@@ -4260,6 +5061,8 @@ void SDL_RenderPresent(SDL_Renderer *renderer)
 
     FlushRenderCommands(renderer); /* time to send everything to the GPU! */
 
+    CaptureRenderReadbacks(renderer);
+
 #if DONT_DRAW_WHILE_HIDDEN
     /* Don't present while we're hidden */
     if (renderer->hidden) {
@@ -4320,31 +5123,29 @@ void SDL_DestroyTexture(SDL_Texture *texture)
 
 void SDL_DestroyRenderer(SDL_Renderer *renderer)
 {
-    SDL_RenderCommand *cmd;
+    SDL_RenderCommandBlock *block;
 
     CHECK_RENDERER_MAGIC(renderer, );
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
-    if (renderer->render_commands_tail) {
-        renderer->render_commands_tail->next = renderer->render_commands_pool;
-        cmd = renderer->render_commands;
-    } else {
-        cmd = renderer->render_commands_pool;
-    }
-
     renderer->render_commands_pool = NULL;
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
+    renderer->last_queued_draw = NULL;
 
-    while (cmd) {
-        SDL_RenderCommand *next = cmd->next;
-        SDL_free(cmd);
-        cmd = next;
+    block = renderer->render_command_blocks;
+    while (block) {
+        SDL_RenderCommandBlock *next = block->next;
+        SDL_free(block);
+        block = next;
     }
+    renderer->render_command_blocks = NULL;
 
     SDL_free(renderer->vertex_data);
 
+    QuitRenderReadbacks(renderer);
+
     /* Free existing textures for this renderer */
     while (renderer->textures) {
         SDL_Texture *tex = renderer->textures;
@@ -4439,6 +5240,9 @@ static SDL_BlendMode SDL_GetShortBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MUL_FULL) {
         return SDL_BLENDMODE_MUL;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+    }
     return blendMode;
 }
 
@@ -4459,6 +5263,9 @@ static SDL_BlendMode SDL_GetLongBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MUL) {
         return SDL_BLENDMODE_MUL_FULL;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL;
+    }
     return blendMode;
 }
 
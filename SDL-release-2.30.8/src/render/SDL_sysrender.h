@@ -26,6 +26,7 @@
 #include "SDL_render.h"
 #include "SDL_events.h"
 #include "SDL_mutex.h"
+#include "SDL_thread.h"
 #include "SDL_yuv_sw_c.h"
 
 /* Set up for C function definitions, even when using C++ */
@@ -127,6 +128,40 @@ typedef struct SDL_RenderCommand
     struct SDL_RenderCommand *next;
 } SDL_RenderCommand;
 
+/* Render commands are allocated in blocks, which are kept until the renderer is destroyed */
+#define SDL_RENDER_COMMAND_BLOCK_SIZE 64
+
+typedef struct SDL_RenderCommandBlock
+{
+    SDL_RenderCommand commands[SDL_RENDER_COMMAND_BLOCK_SIZE];
+    struct SDL_RenderCommandBlock *next;
+} SDL_RenderCommandBlock;
+
+typedef enum
+{
+    SDL_RENDERREADBACK_FREE,
+    SDL_RENDERREADBACK_PENDING,    /* waiting for the next present */
+    SDL_RENDERREADBACK_CONVERTING, /* waiting for the readback thread */
+    SDL_RENDERREADBACK_READY
+} SDL_RenderReadbackState;
+
+/* Define the SDL render readback structure */
+struct SDL_RenderReadback
+{
+    SDL_Renderer *renderer;
+    SDL_RenderReadbackState state;
+    int retval;           /**< The result of reading and converting the pixels */
+    SDL_Rect rect;        /**< The area to read */
+    Uint32 format;        /**< The format requested */
+    void *pixels;         /**< The pixels in the format requested */
+    int pitch;
+    size_t pixels_size;
+    Uint32 read_format;   /**< The format the pixels were read in, if it needs converting */
+    void *read_pixels;
+    int read_pitch;
+    size_t read_pixels_size;
+};
+
 typedef struct SDL_VertexSolid
 {
     SDL_FPoint position;
@@ -269,6 +304,7 @@ struct SDL_Renderer
     SDL_RenderCommand *render_commands;
     SDL_RenderCommand *render_commands_tail;
     SDL_RenderCommand *render_commands_pool;
+    SDL_RenderCommandBlock *render_command_blocks;
     Uint32 render_command_generation;
     Uint32 last_queued_color;
     SDL_DRect last_queued_viewport;
@@ -277,11 +313,21 @@ struct SDL_Renderer
     SDL_bool color_queued;
     SDL_bool viewport_queued;
     SDL_bool cliprect_queued;
+    SDL_RenderCommand *last_queued_draw; /* the draw later draws may be merged into, if still the tail */
+    size_t last_queued_draw_size;        /* the bytes of vertex data it uses */
 
     void *vertex_data;
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    /* Frames read back asynchronously, converted on the readback thread */
+    SDL_RenderReadback *readbacks;
+    int num_readbacks;
+    SDL_mutex *readback_lock;
+    SDL_cond *readback_cond;
+    SDL_Thread *readback_thread;
+    SDL_bool readback_quit;
+
     void *driverdata;
 };
 
@@ -323,6 +369,7 @@ extern void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t num
 
 extern int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
 extern int SDL_PrivateUpperBlitScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
+extern int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
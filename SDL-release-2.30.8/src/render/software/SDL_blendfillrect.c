@@ -235,6 +235,9 @@ int SDL_BlendFillRect(SDL_Surface *dst, const SDL_Rect *rect,
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
         b = DRAW_MUL(b, a);
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        blendMode = SDL_BLENDMODE_BLEND;
     }
 
     switch (dst->format->BitsPerPixel) {
@@ -294,6 +297,9 @@ int SDL_BlendFillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
         b = DRAW_MUL(b, a);
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        blendMode = SDL_BLENDMODE_BLEND;
     }
 
     /* FIXME: Does this function pointer slow things down significantly? */
@@ -38,6 +38,13 @@ static void SDL_BlendLine_RGB2(SDL_Surface *dst, int x1, int y1, int x2, int y2,
         g = DRAW_MUL(_g, _a);
         b = DRAW_MUL(_b, _a);
         a = _a;
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        r = _r;
+        g = _g;
+        b = _b;
+        a = _a;
+        blendMode = SDL_BLENDMODE_BLEND;
     } else {
         r = _r;
         g = _g;
@@ -142,6 +149,13 @@ static void SDL_BlendLine_RGB555(SDL_Surface *dst, int x1, int y1, int x2, int y
         g = DRAW_MUL(_g, _a);
         b = DRAW_MUL(_b, _a);
         a = _a;
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        r = _r;
+        g = _g;
+        b = _b;
+        a = _a;
+        blendMode = SDL_BLENDMODE_BLEND;
     } else {
         r = _r;
         g = _g;
@@ -246,6 +260,13 @@ static void SDL_BlendLine_RGB565(SDL_Surface *dst, int x1, int y1, int x2, int y
         g = DRAW_MUL(_g, _a);
         b = DRAW_MUL(_b, _a);
         a = _a;
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        r = _r;
+        g = _g;
+        b = _b;
+        a = _a;
+        blendMode = SDL_BLENDMODE_BLEND;
     } else {
         r = _r;
         g = _g;
@@ -351,6 +372,13 @@ static void SDL_BlendLine_RGB4(SDL_Surface *dst, int x1, int y1, int x2, int y2,
         g = DRAW_MUL(_g, _a);
         b = DRAW_MUL(_b, _a);
         a = _a;
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        r = _r;
+        g = _g;
+        b = _b;
+        a = _a;
+        blendMode = SDL_BLENDMODE_BLEND;
     } else {
         r = _r;
         g = _g;
@@ -456,6 +484,13 @@ static void SDL_BlendLine_RGBA4(SDL_Surface *dst, int x1, int y1, int x2, int y2
         g = DRAW_MUL(_g, _a);
         b = DRAW_MUL(_b, _a);
         a = _a;
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        r = _r;
+        g = _g;
+        b = _b;
+        a = _a;
+        blendMode = SDL_BLENDMODE_BLEND;
     } else {
         r = _r;
         g = _g;
@@ -560,6 +595,13 @@ static void SDL_BlendLine_RGB888(SDL_Surface *dst, int x1, int y1, int x2, int y
         g = DRAW_MUL(_g, _a);
         b = DRAW_MUL(_b, _a);
         a = _a;
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        r = _r;
+        g = _g;
+        b = _b;
+        a = _a;
+        blendMode = SDL_BLENDMODE_BLEND;
     } else {
         r = _r;
         g = _g;
@@ -664,6 +706,13 @@ static void SDL_BlendLine_ARGB8888(SDL_Surface *dst, int x1, int y1, int x2, int
         g = DRAW_MUL(_g, _a);
         b = DRAW_MUL(_b, _a);
         a = _a;
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        r = _r;
+        g = _g;
+        b = _b;
+        a = _a;
+        blendMode = SDL_BLENDMODE_BLEND;
     } else {
         r = _r;
         g = _g;
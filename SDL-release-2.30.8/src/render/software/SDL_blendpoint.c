@@ -229,6 +229,9 @@ int SDL_BlendPoint(SDL_Surface *dst, int x, int y, SDL_BlendMode blendMode, Uint
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
         b = DRAW_MUL(b, a);
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        blendMode = SDL_BLENDMODE_BLEND;
     }
 
     switch (dst->format->BitsPerPixel) {
@@ -290,6 +293,9 @@ int SDL_BlendPoints(SDL_Surface *dst, const SDL_Point *points, int count,
         r = DRAW_MUL(r, a);
         g = DRAW_MUL(g, a);
         b = DRAW_MUL(b, a);
+    } else if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        /* The color is already premultiplied, the rest is a normal blend */
+        blendMode = SDL_BLENDMODE_BLEND;
     }
 
     /* FIXME: Does this function pointer slow things down significantly? */
@@ -25,6 +25,9 @@
 #include "../SDL_sysrender.h"
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
+#include "../../thread/SDL_systhread.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -44,10 +47,117 @@ typedef struct
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+/* Tiled rendering, see SDL_HINT_RENDER_SOFTWARE_THREADS.
+
+   Draw commands that produce the same pixels whatever the extent of the clip
+   rect are split into operations, which are binned by the tiles their bounds
+   touch. Each tile is then drawn by one thread, in command order, through its
+   own surface sharing the target's pixels, with the clip rect narrowed to the
+   tile. Lines and scaled or rotated copies don't have that property, so the
+   pending tiles are drawn first and these commands run on the calling thread.
+ */
+#define SW_TILE_SIZE   128
+#define SW_MAX_THREADS 16
+
+typedef enum
+{
+    SW_TILEOP_FILL_RECT,
+    SW_TILEOP_DRAW_POINTS,
+    SW_TILEOP_COPY,
+    SW_TILEOP_FILL_TRIANGLE,
+    SW_TILEOP_BLIT_TRIANGLE
+} SW_TileOpType;
+
+typedef struct
+{
+    SW_TileOpType type;
+    SDL_Rect clip;     /* the clip rect of the command */
+    SDL_Rect bounds;   /* the pixels the operation can touch, inside clip */
+    const void *verts; /* rect, points, rects of a copy or triangle vertices */
+    int count;
+    SDL_Surface *src;
+    SDL_BlendMode blend;
+    Uint8 r, g, b, a;
+    Uint32 color; /* r, g, b, a mapped to the target format */
+} SW_TileOp;
+
+struct SW_TileState;
+
+typedef struct
+{
+    struct SW_TileState *tiles;
+    SDL_Thread *thread; /* NULL for the calling thread */
+    SDL_Surface *view;  /* one of the views of the current target */
+} SW_TileWorker;
+
+/* Surfaces sharing the pixels of a recent target, one per worker, kept between command queues */
+#define SW_MAX_TILE_TARGETS 4
+
+typedef struct
+{
+    SDL_Surface *views[SW_MAX_THREADS];
+    Uint32 last_used;
+} SW_TileTarget;
+
+typedef struct SW_TileState
+{
+    SW_TileOp *ops;
+    int num_ops;
+    int max_ops;
+
+    /* Operation indices grouped by tile, in command order */
+    int *tile_ops;
+    int max_tile_ops;
+    int *tile_first; /* num_tiles + 1 offsets into tile_ops */
+    int *tile_next;
+    int max_tiles;
+    int tiles_x;
+    int num_tiles;
+
+    /* Textures read by pending operations, their state is fixed until drawn */
+    SDL_Surface **textures;
+    int num_textures;
+    int max_textures;
+
+    SDL_mutex *lock;
+    SDL_cond *work_ready;
+    SDL_cond *work_done;
+    SW_TileWorker workers[SW_MAX_THREADS]; /* workers[0] is the calling thread */
+    SW_TileTarget targets[SW_MAX_TILE_TARGETS];
+    Uint32 target_clock;
+    int hint_threads; /* from SDL_HINT_RENDER_SOFTWARE_THREADS */
+    int num_threads;
+    int num_active; /* workers drawing this frame, including the calling thread */
+    SDL_bool quit;
+    int num_dispatched;
+    int next_tile;
+    int tiles_left;
+} SW_TileState;
+
+/* Temporary surfaces of SW_RenderCopyEx(), kept between calls */
+#define SW_MAX_SCRATCH_SURFACES 8
+
+typedef struct
+{
+    SDL_Surface *surface;
+    SDL_bool in_use;
+    Uint32 last_used;
+} SW_ScratchSurface;
+
+/* Window surface areas drawn since the last present */
+#define SW_MAX_DIRTY_RECTS  16
+#define SW_DIRTY_MERGE_AREA (64 * 64) /* pixels a merge may add for a rect less */
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SW_TileState tiles;
+    SDL_Rect dirty[SW_MAX_DIRTY_RECTS];
+    int num_dirty;
+    SDL_bool dirty_all;
+    SW_ScratchSurface scratch[SW_MAX_SCRATCH_SURFACES];
+    Uint32 scratch_clock;
 } SW_RenderData;
 
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
@@ -61,6 +171,7 @@ static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
+            data->dirty_all = SDL_TRUE;
         }
     }
     return data->surface;
@@ -73,6 +184,8 @@ static void SW_WindowEvent(SDL_Renderer *renderer, const SDL_WindowEvent *event)
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
         data->surface = NULL;
         data->window = NULL;
+    } else if (event->event == SDL_WINDOWEVENT_EXPOSED) {
+        data->dirty_all = SDL_TRUE;
     }
 }
 
@@ -98,6 +211,12 @@ static int SW_GetOutputSize(SDL_Renderer *renderer, int *w, int *h)
     return SDL_SetError("Software renderer doesn't have an output surface");
 }
 
+static SDL_bool SW_SupportsBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendMode)
+{
+    /* Besides the required ones, only premultiplied alpha has surface blitters */
+    return blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+}
+
 static int SW_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 {
     int bpp;
@@ -309,13 +428,78 @@ static int Blit_to_Screen(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *surf
     return retval;
 }
 
+/* Returns a surface of the given size and format, wrapping 'pixels' if not
+   NULL, in the state of a new surface but with undefined pixel values */
+static SDL_Surface *SW_GetScratchSurface(SW_RenderData *data, int w, int h, Uint32 format, void *pixels, int pitch)
+{
+    SW_ScratchSurface *slot = NULL;
+    SDL_Surface *surface;
+    int i;
+
+    for (i = 0; i < SW_MAX_SCRATCH_SURFACES; ++i) {
+        SW_ScratchSurface *scratch = &data->scratch[i];
+
+        if (scratch->in_use) {
+            continue;
+        }
+        surface = scratch->surface;
+        if (surface && surface->w == w && surface->h == h && surface->format->format == format &&
+            (pixels ? (surface->pixels == pixels && surface->pitch == pitch) : !(surface->flags & SDL_PREALLOC))) {
+            /* Undo what the previous user changed */
+            SDL_SetClipRect(surface, NULL);
+            SDL_SetColorKey(surface, SDL_FALSE, 0);
+            SDL_SetSurfaceColorMod(surface, 255, 255, 255);
+            SDL_SetSurfaceAlphaMod(surface, 255);
+            SDL_SetSurfaceBlendMode(surface, surface->format->Amask ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+            scratch->in_use = SDL_TRUE;
+            scratch->last_used = ++data->scratch_clock;
+            return surface;
+        }
+        /* Otherwise replace an empty slot, or the least recently used surface */
+        if (!slot || (slot->surface && (!surface || scratch->last_used < slot->last_used))) {
+            slot = scratch;
+        }
+    }
+
+    if (pixels) {
+        surface = SDL_CreateRGBSurfaceWithFormatFrom(pixels, w, h, 0, pitch, format);
+    } else {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, format);
+    }
+    if (surface && slot) {
+        SDL_FreeSurface(slot->surface);
+        slot->surface = surface;
+        slot->in_use = SDL_TRUE;
+        slot->last_used = ++data->scratch_clock;
+    }
+    return surface;
+}
+
+static void SW_ReleaseScratchSurface(SW_RenderData *data, SDL_Surface *surface)
+{
+    int i;
+
+    if (!surface) {
+        return;
+    }
+    for (i = 0; i < SW_MAX_SCRATCH_SURFACES; ++i) {
+        if (data->scratch[i].surface == surface) {
+            data->scratch[i].in_use = SDL_FALSE;
+            return;
+        }
+    }
+    /* All the slots were busy */
+    SDL_FreeSurface(surface);
+}
+
 static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Texture *texture,
                            const SDL_Rect *srcrect, const SDL_Rect *final_rect,
                            const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip, float scale_x, float scale_y)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Surface *src = (SDL_Surface *)texture->driverdata;
     SDL_Rect tmp_rect;
-    SDL_Surface *src_clone, *src_rotated, *src_scaled;
+    SDL_Surface *src_clone, *src_rotated = NULL, *src_scaled;
     SDL_Surface *mask = NULL, *mask_rotated = NULL;
     int retval = 0;
     SDL_BlendMode blendmode;
@@ -323,10 +507,14 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
     int applyModulation = SDL_FALSE;
     int blitRequired = SDL_FALSE;
     int isOpaque = SDL_FALSE;
+    int rotozoom = SDL_FALSE;
 
     if (!surface) {
         return -1;
     }
+    if (final_rect->w <= 0 || final_rect->h <= 0) {
+        return 0;
+    }
 
     tmp_rect.x = 0;
     tmp_rect.y = 0;
@@ -343,9 +531,7 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
     /* Clone the source surface but use its pixel buffer directly.
      * The original source surface must be treated as read-only.
      */
-    src_clone = SDL_CreateRGBSurfaceFrom(src->pixels, src->w, src->h, src->format->BitsPerPixel, src->pitch,
-                                         src->format->Rmask, src->format->Gmask,
-                                         src->format->Bmask, src->format->Amask);
+    src_clone = SW_GetScratchSurface(data, src->w, src->h, src->format->format, src->pixels, src->pitch);
     if (!src_clone) {
         if (SDL_MUSTLOCK(src)) {
             SDL_UnlockSurface(src);
@@ -379,6 +565,16 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
         SDL_SetSurfaceColorMod(src_clone, rMod, gMod, bMod);
     }
 
+    /* Scaling and cropping alone are done while rotating, sampling the source pixels once,
+     * unless they need a filter the rotation doesn't have. Multiples of 90 degrees keep
+     * the separate blit, their rotation is an exact copy.
+     */
+    if (blitRequired && !applyModulation && texture->scaleMode <= SDL_ScaleModeBest && (int)(angle / 90) != angle / 90 &&
+        src->format->BitsPerPixel == 32 && SDL_PIXELLAYOUT(src->format->format) == SDL_PACKEDLAYOUT_8888 && src->format->Amask) {
+        blitRequired = SDL_FALSE;
+        rotozoom = SDL_TRUE;
+    }
+
     /* Opaque surfaces are much easier to handle with the NONE blend mode. */
     if (blendmode == SDL_BLENDMODE_NONE && !src->format->Amask && alphaMod == 255) {
         isOpaque = SDL_TRUE;
@@ -388,11 +584,11 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
      * to clear the pixels in the destination surface. The other steps are explained below.
      */
     if (blendmode == SDL_BLENDMODE_NONE && !isOpaque) {
-        mask = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
-                                    0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+        mask = SW_GetScratchSurface(data, final_rect->w, final_rect->h, SDL_PIXELFORMAT_ARGB8888, NULL, 0);
         if (!mask) {
             retval = -1;
         } else {
+            SDL_FillRect(mask, NULL, 0);
             SDL_SetSurfaceBlendMode(mask, SDL_BLENDMODE_MOD);
         }
     }
@@ -402,14 +598,13 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
      */
     if (!retval && (blitRequired || applyModulation)) {
         SDL_Rect scale_rect = tmp_rect;
-        src_scaled = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
-                                          0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+        src_scaled = SW_GetScratchSurface(data, final_rect->w, final_rect->h, SDL_PIXELFORMAT_ARGB8888, NULL, 0);
         if (!src_scaled) {
             retval = -1;
         } else {
             SDL_SetSurfaceBlendMode(src_clone, SDL_BLENDMODE_NONE);
             retval = SDL_PrivateUpperBlitScaled(src_clone, srcrect, src_scaled, &scale_rect, texture->scaleMode);
-            SDL_FreeSurface(src_clone);
+            SW_ReleaseScratchSurface(data, src_clone);
             src_clone = src_scaled;
             src_scaled = NULL;
         }
@@ -424,18 +619,20 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
 
         SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, angle, center,
                                        &rect_dest, &cangle, &sangle);
-        src_rotated = SDLgfx_rotateSurface(src_clone, angle,
-                                           (texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL,
-                                           &rect_dest, cangle, sangle, center);
-        if (!src_rotated) {
+        src_rotated = SW_GetScratchSurface(data, rect_dest.w, rect_dest.h, src_clone->format->format, NULL, 0);
+        if (!src_rotated ||
+            SDLgfx_rotozoomSurfaceInto(src_clone, rotozoom ? srcrect : NULL, tmp_rect.w, tmp_rect.h, src_rotated, angle,
+                                       (texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL,
+                                       &rect_dest, cangle, sangle, center) < 0) {
             retval = -1;
         }
         if (!retval && mask) {
             /* The mask needed for the NONE blend mode gets rotated with the same parameters. */
-            mask_rotated = SDLgfx_rotateSurface(mask, angle,
-                                                SDL_FALSE, 0, 0,
-                                                &rect_dest, cangle, sangle, center);
-            if (!mask_rotated) {
+            mask_rotated = SW_GetScratchSurface(data, rect_dest.w, rect_dest.h, SDL_PIXELFORMAT_ARGB8888, NULL, 0);
+            if (!mask_rotated ||
+                SDLgfx_rotozoomSurfaceInto(mask, NULL, tmp_rect.w, tmp_rect.h, mask_rotated, angle,
+                                           SDL_FALSE, 0, 0,
+                                           &rect_dest, cangle, sangle, center) < 0) {
                 retval = -1;
             }
         }
@@ -483,24 +680,21 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
                          * to be created. This makes all source pixels opaque and the colors get copied correctly.
                          */
                         SDL_Surface *src_rotated_rgb;
-                        src_rotated_rgb = SDL_CreateRGBSurfaceFrom(src_rotated->pixels, src_rotated->w, src_rotated->h,
-                                                                   src_rotated->format->BitsPerPixel, src_rotated->pitch,
-                                                                   src_rotated->format->Rmask, src_rotated->format->Gmask,
-                                                                   src_rotated->format->Bmask, 0);
+                        src_rotated_rgb = SW_GetScratchSurface(data, src_rotated->w, src_rotated->h,
+                                                               SDL_MasksToPixelFormatEnum(src_rotated->format->BitsPerPixel,
+                                                                                          src_rotated->format->Rmask, src_rotated->format->Gmask,
+                                                                                          src_rotated->format->Bmask, 0),
+                                                               src_rotated->pixels, src_rotated->pitch);
                         if (!src_rotated_rgb) {
                             retval = -1;
                         } else {
                             SDL_SetSurfaceBlendMode(src_rotated_rgb, SDL_BLENDMODE_ADD);
                             /* Renderer scaling, if needed */
                             retval = Blit_to_Screen(src_rotated_rgb, NULL, surface, &tmp_rect, scale_x, scale_y, texture->scaleMode);
-                            SDL_FreeSurface(src_rotated_rgb);
+                            SW_ReleaseScratchSurface(data, src_rotated_rgb);
                         }
                     }
                 }
-                SDL_FreeSurface(mask_rotated);
-            }
-            if (src_rotated) {
-                SDL_FreeSurface(src_rotated);
             }
         }
     }
@@ -508,12 +702,10 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
     if (SDL_MUSTLOCK(src)) {
         SDL_UnlockSurface(src);
     }
-    if (mask) {
-        SDL_FreeSurface(mask);
-    }
-    if (src_clone) {
-        SDL_FreeSurface(src_clone);
-    }
+    SW_ReleaseScratchSurface(data, mask_rotated);
+    SW_ReleaseScratchSurface(data, src_rotated);
+    SW_ReleaseScratchSurface(data, mask);
+    SW_ReleaseScratchSurface(data, src_clone);
     return retval;
 }
 
@@ -624,7 +816,7 @@ static void PrepTextureForCopy(const SDL_RenderCommand *cmd)
     SDL_Surface *surface = (SDL_Surface *)texture->driverdata;
     const SDL_bool colormod = ((r & g & b) != 0xFF);
     const SDL_bool alphamod = (a != 0xFF);
-    const SDL_bool blending = ((blend == SDL_BLENDMODE_ADD) || (blend == SDL_BLENDMODE_MOD) || (blend == SDL_BLENDMODE_MUL));
+    const SDL_bool blending = ((blend == SDL_BLENDMODE_ADD) || (blend == SDL_BLENDMODE_MOD) || (blend == SDL_BLENDMODE_MUL) || (blend == SDL_BLENDMODE_BLEND_PREMULTIPLIED));
 
     if (colormod || alphamod || blending) {
         SDL_SetSurfaceRLE(surface, 0);
@@ -658,10 +850,917 @@ static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
     }
 }
 
+static void SDLCALL SW_TileThreadsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SW_TileState *tiles = (SW_TileState *)userdata;
+    int num_threads;
+
+    if (!hint || !*hint) {
+        num_threads = 1;
+    } else {
+        num_threads = SDL_atoi(hint);
+        if (num_threads < 0) {
+            num_threads = SDL_GetCPUCount();
+        }
+    }
+    tiles->hint_threads = SDL_clamp(num_threads, 1, SW_MAX_THREADS);
+}
+
+/* The clipping of SDL_UpperBlit(), with clip as the destination clip rect */
+static SDL_bool SW_ClipBlit(const SDL_Surface *src, const SDL_Rect *srcrect, const SDL_Rect *dstrect,
+                            const SDL_Rect *clip, SDL_Rect *r_src, SDL_Rect *r_dst)
+{
+    SDL_Rect tmp;
+
+    r_src->x = 0;
+    r_src->y = 0;
+    r_src->w = src->w;
+    r_src->h = src->h;
+    if (!SDL_IntersectRect(srcrect, r_src, &tmp)) {
+        return SDL_FALSE;
+    }
+    r_dst->x = dstrect->x + tmp.x - srcrect->x;
+    r_dst->y = dstrect->y + tmp.y - srcrect->y;
+    r_dst->w = tmp.w;
+    r_dst->h = tmp.h;
+    *r_src = tmp;
+
+    if (!SDL_IntersectRect(r_dst, clip, &tmp)) {
+        return SDL_FALSE;
+    }
+    r_src->x += tmp.x - r_dst->x;
+    r_src->y += tmp.y - r_dst->y;
+    r_src->w = tmp.w;
+    r_src->h = tmp.h;
+    *r_dst = tmp;
+    return SDL_TRUE;
+}
+
+/* SDL_BlitSurface() with a mapping validated by the calling thread. The
+   blit info shared by all the users of the map is copied, not filled in. */
+static void SW_BlitTile(SDL_Surface *src, const SDL_Rect *srcrect, const SDL_Rect *dstrect, SDL_Surface *dst)
+{
+    SDL_Rect r_src, r_dst;
+
+    if (!SW_ClipBlit(src, srcrect, dstrect, &dst->clip_rect, &r_src, &r_dst)) {
+        return;
+    }
+
+    if (src->flags & SDL_RLEACCEL) {
+        /* The RLE blitter only reads the map */
+        src->map->blit(src, &r_src, dst, &r_dst);
+    } else {
+        SDL_BlitInfo info = src->map->info;
+
+        info.src = (Uint8 *)src->pixels +
+                   (Uint16)r_src.y * src->pitch +
+                   (Uint16)r_src.x * info.src_fmt->BytesPerPixel;
+        info.src_w = r_src.w;
+        info.src_h = r_src.h;
+        info.src_pitch = src->pitch;
+        info.src_skip = info.src_pitch - info.src_w * info.src_fmt->BytesPerPixel;
+        info.dst = (Uint8 *)dst->pixels +
+                   (Uint16)r_dst.y * dst->pitch +
+                   (Uint16)r_dst.x * info.dst_fmt->BytesPerPixel;
+        info.dst_w = r_dst.w;
+        info.dst_h = r_dst.h;
+        info.dst_pitch = dst->pitch;
+        info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->BytesPerPixel;
+        ((SDL_BlitFunc)src->map->data)(&info);
+    }
+}
+
+static void SW_DrawTileOp(SDL_Surface *view, const SW_TileOp *op)
+{
+    switch (op->type) {
+    case SW_TILEOP_FILL_RECT:
+        if (op->blend == SDL_BLENDMODE_NONE) {
+            SDL_FillRect(view, (const SDL_Rect *)op->verts, op->color);
+        } else {
+            SDL_BlendFillRect(view, (const SDL_Rect *)op->verts, op->blend, op->r, op->g, op->b, op->a);
+        }
+        break;
+
+    case SW_TILEOP_DRAW_POINTS:
+        if (op->blend == SDL_BLENDMODE_NONE) {
+            SDL_DrawPoints(view, (const SDL_Point *)op->verts, op->count, op->color);
+        } else {
+            SDL_BlendPoints(view, (const SDL_Point *)op->verts, op->count, op->blend, op->r, op->g, op->b, op->a);
+        }
+        break;
+
+    case SW_TILEOP_COPY:
+    {
+        const SDL_Rect *rects = (const SDL_Rect *)op->verts;
+        SW_BlitTile(op->src, &rects[0], &rects[1], view);
+        break;
+    }
+
+    case SW_TILEOP_FILL_TRIANGLE:
+    {
+        const GeometryFillData *ptr = (const GeometryFillData *)op->verts;
+        SDL_Point d0 = ptr[0].dst, d1 = ptr[1].dst, d2 = ptr[2].dst;
+        SDL_SW_FillTriangle(view, &d0, &d1, &d2, op->blend, ptr[0].color, ptr[1].color, ptr[2].color);
+        break;
+    }
+
+    case SW_TILEOP_BLIT_TRIANGLE:
+    {
+        /* SDL_SW_BlitTriangle() adjusts the texture coordinates in place */
+        const GeometryCopyData *ptr = (const GeometryCopyData *)op->verts;
+        SDL_Point s0 = ptr[0].src, s1 = ptr[1].src, s2 = ptr[2].src;
+        SDL_Point d0 = ptr[0].dst, d1 = ptr[1].dst, d2 = ptr[2].dst;
+        SDL_SW_BlitTriangle(op->src, &s0, &s1, &s2, view, &d0, &d1, &d2, ptr[0].color, ptr[1].color, ptr[2].color);
+        break;
+    }
+    }
+}
+
+static void SW_DrawTile(SW_TileState *tiles, SDL_Surface *view, int tile)
+{
+    SDL_Rect rect, clip;
+    int i;
+
+    rect.x = (tile % tiles->tiles_x) * SW_TILE_SIZE;
+    rect.y = (tile / tiles->tiles_x) * SW_TILE_SIZE;
+    rect.w = SW_TILE_SIZE;
+    rect.h = SW_TILE_SIZE;
+
+    for (i = tiles->tile_first[tile]; i < tiles->tile_first[tile + 1]; ++i) {
+        const SW_TileOp *op = &tiles->ops[tiles->tile_ops[i]];
+
+        SDL_IntersectRect(&op->clip, &rect, &clip);
+        SDL_SetClipRect(view, &clip);
+        SW_DrawTileOp(view, op);
+    }
+}
+
+static int SDLCALL SW_TileThread(void *data)
+{
+    SW_TileWorker *worker = (SW_TileWorker *)data;
+    SW_TileState *tiles = worker->tiles;
+    const int index = (int)(worker - tiles->workers);
+
+    SDL_LockMutex(tiles->lock);
+    while (!tiles->quit) {
+        if (index < tiles->num_active && tiles->next_tile < tiles->num_dispatched) {
+            const int tile = tiles->next_tile++;
+
+            SDL_UnlockMutex(tiles->lock);
+            SW_DrawTile(tiles, worker->view, tile);
+            SDL_LockMutex(tiles->lock);
+
+            if (--tiles->tiles_left == 0) {
+                SDL_CondSignal(tiles->work_done);
+            }
+        } else {
+            SDL_CondWait(tiles->work_ready, tiles->lock);
+        }
+    }
+    SDL_UnlockMutex(tiles->lock);
+    return 0;
+}
+
+/* Grows the pool up to num_threads workers besides the calling thread */
+static void SW_StartTileThreads(SW_TileState *tiles, int num_threads)
+{
+    if (!tiles->lock) {
+        tiles->lock = SDL_CreateMutex();
+        tiles->work_ready = SDL_CreateCond();
+        tiles->work_done = SDL_CreateCond();
+        if (!tiles->lock || !tiles->work_ready || !tiles->work_done) {
+            SDL_DestroyCond(tiles->work_done);
+            SDL_DestroyCond(tiles->work_ready);
+            SDL_DestroyMutex(tiles->lock);
+            tiles->work_done = NULL;
+            tiles->work_ready = NULL;
+            tiles->lock = NULL;
+            return;
+        }
+        tiles->workers[0].tiles = tiles;
+    }
+
+    while (tiles->num_threads < num_threads) {
+        SW_TileWorker *worker = &tiles->workers[tiles->num_threads + 1];
+
+        worker->tiles = tiles;
+        worker->thread = SDL_CreateThreadInternal(SW_TileThread, "SDLRenderTiles", 0, worker);
+        if (!worker->thread) {
+            /* Run with the threads we have, the calling thread draws too */
+            break;
+        }
+        ++tiles->num_threads;
+    }
+}
+
+static void SW_FreeTileTarget(SW_TileTarget *target)
+{
+    int i;
+
+    for (i = 0; i < SW_MAX_THREADS; ++i) {
+        SDL_FreeSurface(target->views[i]);
+        target->views[i] = NULL;
+    }
+}
+
+static void SW_QuitTileThreads(SW_TileState *tiles)
+{
+    int i;
+
+    if (tiles->lock) {
+        SDL_LockMutex(tiles->lock);
+        tiles->quit = SDL_TRUE;
+        SDL_CondBroadcast(tiles->work_ready);
+        SDL_UnlockMutex(tiles->lock);
+
+        for (i = 1; i <= tiles->num_threads; ++i) {
+            SDL_WaitThread(tiles->workers[i].thread, NULL);
+        }
+
+        SDL_DestroyCond(tiles->work_done);
+        SDL_DestroyCond(tiles->work_ready);
+        SDL_DestroyMutex(tiles->lock);
+    }
+    for (i = 0; i < SW_MAX_TILE_TARGETS; ++i) {
+        SW_FreeTileTarget(&tiles->targets[i]);
+    }
+    SDL_free(tiles->ops);
+    SDL_free(tiles->tile_ops);
+    SDL_free(tiles->tile_first);
+    SDL_free(tiles->textures);
+    SDL_zerop(tiles);
+}
+
+static void SW_EndTiles(SW_TileState *tiles)
+{
+    int i;
+
+    if (tiles->lock) {
+        SDL_LockMutex(tiles->lock);
+        tiles->num_active = 0;
+        SDL_UnlockMutex(tiles->lock);
+    }
+
+    for (i = 0; i < SW_MAX_THREADS; ++i) {
+        tiles->workers[i].view = NULL;
+    }
+}
+
+/* Returns the views of surface, reusing the ones of an earlier command queue if they
+   share its pixels and layout, or replacing the least recently used target */
+static SW_TileTarget *SW_GetTileTarget(SW_TileState *tiles, SDL_Surface *surface, int num_views)
+{
+    SW_TileTarget *target = NULL;
+    int i;
+
+    for (i = 0; i < SW_MAX_TILE_TARGETS; ++i) {
+        const SDL_Surface *view = tiles->targets[i].views[0];
+
+        if (view && view->pixels == surface->pixels && view->w == surface->w && view->h == surface->h &&
+            view->pitch == surface->pitch && view->format->format == surface->format->format) {
+            target = &tiles->targets[i];
+            break;
+        }
+        if (!target || tiles->targets[i].last_used < target->last_used) {
+            target = &tiles->targets[i];
+        }
+    }
+    if (i == SW_MAX_TILE_TARGETS) {
+        SW_FreeTileTarget(target);
+    }
+    target->last_used = ++tiles->target_clock;
+
+    for (i = 0; i < num_views; ++i) {
+        if (!target->views[i]) {
+            target->views[i] = SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels, surface->w, surface->h, 0,
+                                                                  surface->pitch, surface->format->format);
+            if (!target->views[i]) {
+                return NULL;
+            }
+        }
+    }
+    return target;
+}
+
+/* Returns SDL_TRUE if the commands for this surface should be drawn by tile */
+static SDL_bool SW_BeginTiles(SW_TileState *tiles, SDL_Surface *surface)
+{
+    const int num_threads = tiles->hint_threads;
+    SW_TileTarget *target;
+    int num_tiles, num_active, i;
+
+    if (num_threads <= 1 || SDL_MUSTLOCK(surface) ||
+        SDL_ISPIXELFORMAT_INDEXED(surface->format->format) || surface->format->BytesPerPixel < 2 ||
+        surface->w * surface->h < 4 * SW_TILE_SIZE * SW_TILE_SIZE) {
+        return SDL_FALSE;
+    }
+
+    tiles->tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    num_tiles = tiles->tiles_x * ((surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE);
+    if (num_tiles > tiles->max_tiles) {
+        int *tile_first = (int *)SDL_realloc(tiles->tile_first, (2 * num_tiles + 1) * sizeof(*tile_first));
+        if (!tile_first) {
+            return SDL_FALSE;
+        }
+        tiles->tile_first = tile_first;
+        tiles->max_tiles = num_tiles;
+    }
+    tiles->tile_next = tiles->tile_first + num_tiles + 1;
+    tiles->num_tiles = num_tiles;
+
+    SW_StartTileThreads(tiles, num_threads - 1);
+    if (!tiles->lock) {
+        return SDL_FALSE;
+    }
+
+    num_active = SDL_min(num_threads, tiles->num_threads + 1);
+    target = SW_GetTileTarget(tiles, surface, num_active);
+    if (!target) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < num_active; ++i) {
+        tiles->workers[i].view = target->views[i];
+    }
+
+    SDL_LockMutex(tiles->lock);
+    tiles->num_active = num_active;
+    SDL_UnlockMutex(tiles->lock);
+
+    tiles->num_ops = 0;
+    tiles->num_textures = 0;
+    return SDL_TRUE;
+}
+
+/* Draws the pending operations, tile by tile */
+static void SW_FlushTiles(SW_TileState *tiles)
+{
+    const int num_tiles = tiles->num_tiles;
+    int i, x, y;
+
+    if (tiles->num_ops == 0) {
+        return;
+    }
+
+    /* Count the operations of each tile and turn the counts into offsets */
+    SDL_memset(tiles->tile_first, 0, (num_tiles + 1) * sizeof(*tiles->tile_first));
+    for (i = 0; i < tiles->num_ops; ++i) {
+        const SDL_Rect *bounds = &tiles->ops[i].bounds;
+        for (y = bounds->y / SW_TILE_SIZE; y <= (bounds->y + bounds->h - 1) / SW_TILE_SIZE; ++y) {
+            for (x = bounds->x / SW_TILE_SIZE; x <= (bounds->x + bounds->w - 1) / SW_TILE_SIZE; ++x) {
+                ++tiles->tile_first[y * tiles->tiles_x + x + 1];
+            }
+        }
+    }
+    for (i = 0; i < num_tiles; ++i) {
+        tiles->tile_next[i] = tiles->tile_first[i];
+        tiles->tile_first[i + 1] += tiles->tile_first[i];
+    }
+
+    if (tiles->tile_first[num_tiles] > tiles->max_tile_ops) {
+        const int max_tile_ops = tiles->tile_first[num_tiles];
+        int *tile_ops = (int *)SDL_realloc(tiles->tile_ops, max_tile_ops * sizeof(*tile_ops));
+        if (!tile_ops) {
+            /* Draw everything as a single tile */
+            for (i = 0; i < tiles->num_ops; ++i) {
+                SDL_SetClipRect(tiles->workers[0].view, &tiles->ops[i].clip);
+                SW_DrawTileOp(tiles->workers[0].view, &tiles->ops[i]);
+            }
+            tiles->num_ops = 0;
+            tiles->num_textures = 0;
+            return;
+        }
+        tiles->tile_ops = tile_ops;
+        tiles->max_tile_ops = max_tile_ops;
+    }
+
+    for (i = 0; i < tiles->num_ops; ++i) {
+        const SDL_Rect *bounds = &tiles->ops[i].bounds;
+        for (y = bounds->y / SW_TILE_SIZE; y <= (bounds->y + bounds->h - 1) / SW_TILE_SIZE; ++y) {
+            for (x = bounds->x / SW_TILE_SIZE; x <= (bounds->x + bounds->w - 1) / SW_TILE_SIZE; ++x) {
+                tiles->tile_ops[tiles->tile_next[y * tiles->tiles_x + x]++] = i;
+            }
+        }
+    }
+
+    SDL_LockMutex(tiles->lock);
+    tiles->num_dispatched = num_tiles;
+    tiles->next_tile = 0;
+    tiles->tiles_left = num_tiles;
+    SDL_CondBroadcast(tiles->work_ready);
+
+    /* The calling thread takes tiles too, so this completes even without workers */
+    while (tiles->next_tile < tiles->num_dispatched) {
+        const int tile = tiles->next_tile++;
+
+        SDL_UnlockMutex(tiles->lock);
+        SW_DrawTile(tiles, tiles->workers[0].view, tile);
+        SDL_LockMutex(tiles->lock);
+
+        --tiles->tiles_left;
+    }
+    while (tiles->tiles_left > 0) {
+        SDL_CondWait(tiles->work_done, tiles->lock);
+    }
+    tiles->num_dispatched = 0;
+    tiles->next_tile = 0;
+    SDL_UnlockMutex(tiles->lock);
+
+    tiles->num_ops = 0;
+    tiles->num_textures = 0;
+}
+
+static SDL_bool SW_ReserveTileOps(SW_TileState *tiles, int count)
+{
+    if (tiles->num_ops + count > tiles->max_ops) {
+        const int max_ops = SDL_max(tiles->num_ops + count, 2 * tiles->max_ops);
+        SW_TileOp *ops = (SW_TileOp *)SDL_realloc(tiles->ops, max_ops * sizeof(*ops));
+        if (!ops) {
+            return SDL_FALSE;
+        }
+        tiles->ops = ops;
+        tiles->max_ops = max_ops;
+    }
+    return SDL_TRUE;
+}
+
+static SDL_bool SW_IsTileTexture(const SW_TileState *tiles, const SDL_Surface *src)
+{
+    int i;
+
+    for (i = 0; i < tiles->num_textures; ++i) {
+        if (tiles->textures[i] == src) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+/* PrepTextureForCopy(), after drawing the pending operations that read the
+   texture with a different color mod, alpha mod or blend mode */
+static SDL_bool SW_PrepTileTexture(SW_TileState *tiles, const SDL_RenderCommand *cmd)
+{
+    SDL_Surface *src = (SDL_Surface *)cmd->data.draw.texture->driverdata;
+
+    if (SW_IsTileTexture(tiles, src)) {
+        Uint8 r, g, b, a;
+        SDL_BlendMode blend;
+
+        SDL_GetSurfaceColorMod(src, &r, &g, &b);
+        SDL_GetSurfaceAlphaMod(src, &a);
+        SDL_GetSurfaceBlendMode(src, &blend);
+        if (r != cmd->data.draw.r || g != cmd->data.draw.g || b != cmd->data.draw.b ||
+            a != cmd->data.draw.a || blend != cmd->data.draw.blend) {
+            SW_FlushTiles(tiles);
+        }
+    }
+
+    if (tiles->num_textures == tiles->max_textures) {
+        const int max_textures = SDL_max(8, 2 * tiles->max_textures);
+        SDL_Surface **textures = (SDL_Surface **)SDL_realloc(tiles->textures, max_textures * sizeof(*textures));
+        if (!textures) {
+            return SDL_FALSE;
+        }
+        tiles->textures = textures;
+        tiles->max_textures = max_textures;
+    }
+
+    PrepTextureForCopy(cmd);
+    return SDL_TRUE;
+}
+
+static void SW_AddTileTexture(SW_TileState *tiles, SDL_Surface *src)
+{
+    if (!SW_IsTileTexture(tiles, src)) {
+        tiles->textures[tiles->num_textures++] = src;
+    }
+}
+
+/* The clip rect SetDrawState() would set, clipped to the surface */
+static void SW_GetDrawClip(SDL_Surface *surface, const SW_DrawStateCache *drawstate, SDL_Rect *clip)
+{
+    const SDL_Rect *viewport = drawstate->viewport;
+    const SDL_Rect *cliprect = drawstate->cliprect;
+    SDL_Rect full;
+
+    SDL_assert_release(viewport != NULL); /* the higher level should have forced a SDL_RENDERCMD_SETVIEWPORT */
+
+    if (cliprect) {
+        clip->x = cliprect->x + viewport->x;
+        clip->y = cliprect->y + viewport->y;
+        clip->w = cliprect->w;
+        clip->h = cliprect->h;
+        SDL_IntersectRect(viewport, clip, clip);
+    } else {
+        *clip = *viewport;
+    }
+
+    full.x = 0;
+    full.y = 0;
+    full.w = surface->w;
+    full.h = surface->h;
+    SDL_IntersectRect(clip, &full, clip);
+}
+
+static SW_TileOp *SW_AddTileOp(SW_TileState *tiles, SW_TileOpType type, const SDL_Rect *clip, const SDL_Rect *bounds,
+                               const SDL_RenderCommand *cmd, const void *verts)
+{
+    SW_TileOp *op = &tiles->ops[tiles->num_ops];
+
+    if (!SDL_IntersectRect(bounds, clip, &op->bounds)) {
+        return NULL;
+    }
+    ++tiles->num_ops;
+    op->type = type;
+    op->clip = *clip;
+    op->verts = verts;
+    op->count = 1;
+    op->src = NULL;
+    op->blend = cmd->data.draw.blend;
+    op->r = cmd->data.draw.r;
+    op->g = cmd->data.draw.g;
+    op->b = cmd->data.draw.b;
+    op->a = cmd->data.draw.a;
+    op->color = 0;
+    return op;
+}
+
+/* Queues the operations of a draw command, returns SDL_FALSE if it has to
+   run serially, once the pending operations are drawn. Vertices are only
+   moved to the viewport once nothing can fail. */
+static SDL_bool SW_TileCommand(SW_TileState *tiles, SDL_Surface *surface, const SW_DrawStateCache *drawstate,
+                               SDL_RenderCommand *cmd, void *vertices)
+{
+    const SDL_Rect *viewport = drawstate->viewport;
+    SDL_Rect clip;
+    int i;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_SETDRAWCOLOR:
+    case SDL_RENDERCMD_SETVIEWPORT:
+    case SDL_RENDERCMD_SETCLIPRECT:
+    case SDL_RENDERCMD_NO_OP:
+        /* State changes are tracked by the serial code */
+        return SDL_FALSE;
+
+    case SDL_RENDERCMD_CLEAR:
+    {
+        SW_TileOp *op;
+
+        if (!SW_ReserveTileOps(tiles, 1)) {
+            break;
+        }
+        /* By definition the clear ignores the clip rect */
+        clip.x = 0;
+        clip.y = 0;
+        clip.w = surface->w;
+        clip.h = surface->h;
+        op = &tiles->ops[tiles->num_ops++];
+        op->type = SW_TILEOP_FILL_RECT;
+        op->clip = clip;
+        op->bounds = clip;
+        op->verts = NULL;
+        op->count = 1;
+        op->src = NULL;
+        op->blend = SDL_BLENDMODE_NONE;
+        op->color = SDL_MapRGBA(surface->format, cmd->data.color.r, cmd->data.color.g, cmd->data.color.b, cmd->data.color.a);
+        return SDL_TRUE;
+    }
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+    {
+        const int count = (int)cmd->data.draw.count;
+        SDL_Point *verts = (SDL_Point *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        SDL_Rect bounds;
+        SW_TileOp *op;
+
+        if (!SW_ReserveTileOps(tiles, 1)) {
+            break;
+        }
+        if (count <= 0) {
+            return SDL_TRUE;
+        }
+
+        SW_GetDrawClip(surface, drawstate, &clip);
+        SDL_EnclosePoints(verts, count, NULL, &bounds);
+        bounds.x += viewport->x;
+        bounds.y += viewport->y;
+        op = SW_AddTileOp(tiles, SW_TILEOP_DRAW_POINTS, &clip, &bounds, cmd, verts);
+        if (op) {
+            op->count = count;
+            op->color = SDL_MapRGBA(surface->format, op->r, op->g, op->b, op->a);
+        }
+
+        if (viewport->x || viewport->y) {
+            for (i = 0; i < count; i++) {
+                verts[i].x += viewport->x;
+                verts[i].y += viewport->y;
+            }
+        }
+        return SDL_TRUE;
+    }
+
+    case SDL_RENDERCMD_FILL_RECTS:
+    {
+        const int count = (int)cmd->data.draw.count;
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const Uint32 color = SDL_MapRGBA(surface->format, cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+
+        if (!SW_ReserveTileOps(tiles, count)) {
+            break;
+        }
+
+        SW_GetDrawClip(surface, drawstate, &clip);
+        for (i = 0; i < count; i++) {
+            SW_TileOp *op;
+
+            verts[i].x += viewport->x;
+            verts[i].y += viewport->y;
+            op = SW_AddTileOp(tiles, SW_TILEOP_FILL_RECT, &clip, &verts[i], cmd, &verts[i]);
+            if (op) {
+                op->color = color;
+            }
+        }
+        return SDL_TRUE;
+    }
+
+    case SDL_RENDERCMD_COPY:
+    {
+        SDL_Rect *verts = (SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+        const SDL_Rect *srcrect = verts;
+        SDL_Rect *dstrect = verts + 1;
+        SDL_Surface *src = (SDL_Surface *)cmd->data.draw.texture->driverdata;
+        SDL_Rect dst, r_src, r_dst;
+        SW_TileOp *op;
+
+        if (srcrect->w != dstrect->w || srcrect->h != dstrect->h || src->locked || src->pixels == surface->pixels) {
+            break;
+        }
+        if (!SW_ReserveTileOps(tiles, 1) || !SW_PrepTileTexture(tiles, cmd)) {
+            break;
+        }
+
+        /* The blit map checks of SDL_UpperBlit() and SDL_LowerBlit() */
+        if ((src->map->info.flags & SDL_COPY_NEAREST) ||
+            (src->map->dst != surface) ||
+            (src->format->palette &&
+             src->map->src_palette_version != src->format->palette->version)) {
+            SW_FlushTiles(tiles);
+            if (src->map->info.flags & SDL_COPY_NEAREST) {
+                src->map->info.flags &= ~SDL_COPY_NEAREST;
+                SDL_InvalidateMap(src->map);
+            }
+            if (src->map->dst != surface ||
+                (src->format->palette &&
+                 src->map->src_palette_version != src->format->palette->version)) {
+                if (SDL_MapSurface(src, surface) < 0) {
+                    break;
+                }
+            }
+        }
+
+        SW_GetDrawClip(surface, drawstate, &clip);
+        dst = *dstrect;
+        dst.x += viewport->x;
+        dst.y += viewport->y;
+        if (SW_ClipBlit(src, srcrect, &dst, &clip, &r_src, &r_dst)) {
+            op = SW_AddTileOp(tiles, SW_TILEOP_COPY, &clip, &r_dst, cmd, verts);
+            if (op) {
+                op->src = src;
+                SW_AddTileTexture(tiles, src);
+            }
+        }
+
+        *dstrect = dst;
+        return SDL_TRUE;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        void *verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+        const int count = (int)cmd->data.draw.count;
+        SDL_Texture *texture = cmd->data.draw.texture;
+        SDL_Point vp;
+        SDL_Rect bounds;
+
+        if (!SW_ReserveTileOps(tiles, count / 3 + 1)) {
+            break;
+        }
+
+        SW_GetDrawClip(surface, drawstate, &clip);
+        vp.x = viewport->x;
+        vp.y = viewport->y;
+        trianglepoint_2_fixedpoint(&vp);
+
+        if (texture) {
+            SDL_Surface *src = (SDL_Surface *)texture->driverdata;
+            GeometryCopyData *ptr = (GeometryCopyData *)verts;
+
+            /* Locking an RLE texture decodes it */
+            if (src->pixels == surface->pixels || !SW_PrepTileTexture(tiles, cmd) || (src->flags & SDL_RLEACCEL)) {
+                break;
+            }
+
+            for (i = 0; i < count; i++) {
+                ptr[i].dst.x += vp.x;
+                ptr[i].dst.y += vp.y;
+            }
+            for (i = 0; i + 2 < count; i += 3, ptr += 3) {
+                SW_TileOp *op;
+
+                SDL_SW_TriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &bounds);
+                op = SW_AddTileOp(tiles, SW_TILEOP_BLIT_TRIANGLE, &clip, &bounds, cmd, ptr);
+                if (op) {
+                    op->src = src;
+                    SW_AddTileTexture(tiles, src);
+                }
+            }
+        } else {
+            GeometryFillData *ptr = (GeometryFillData *)verts;
+
+            for (i = 0; i < count; i++) {
+                ptr[i].dst.x += vp.x;
+                ptr[i].dst.y += vp.y;
+            }
+            for (i = 0; i + 2 < count; i += 3, ptr += 3) {
+                SDL_SW_TriangleBounds(&ptr[0].dst, &ptr[1].dst, &ptr[2].dst, &bounds);
+                SW_AddTileOp(tiles, SW_TILEOP_FILL_TRIANGLE, &clip, &bounds, cmd, ptr);
+            }
+        }
+        return SDL_TRUE;
+    }
+
+    default:
+        /* Lines, scaled and rotated copies */
+        break;
+    }
+
+    SW_FlushTiles(tiles);
+    return SDL_FALSE;
+}
+
+static Sint64 SW_RectArea(const SDL_Rect *rect)
+{
+    return (Sint64)rect->w * rect->h;
+}
+
+/* Adds a drawn area of the window surface. Overlapping and nearby rects are
+   merged, so are the closest ones once there are too many to track. */
+static void SW_AddDirtyRect(SW_RenderData *data, SDL_Surface *surface, const SDL_Rect *rect, const SDL_Rect *clip)
+{
+    SDL_Rect dirty;
+    Sint64 area;
+    int i;
+
+    if (data->dirty_all || !SDL_IntersectRect(rect, clip, &dirty)) {
+        return;
+    }
+
+    for (i = 0; i < data->num_dirty; ++i) {
+        SDL_Rect merged;
+
+        SDL_UnionRect(&data->dirty[i], &dirty, &merged);
+        if (SW_RectArea(&merged) - SW_RectArea(&data->dirty[i]) - SW_RectArea(&dirty) <= SW_DIRTY_MERGE_AREA) {
+            /* The merged rect may now reach others, check them all again */
+            dirty = merged;
+            data->dirty[i] = data->dirty[--data->num_dirty];
+            i = -1;
+        }
+    }
+
+    if (data->num_dirty == SW_MAX_DIRTY_RECTS) {
+        Sint64 best_growth = 0;
+        int best = 0;
+
+        for (i = 0; i < data->num_dirty; ++i) {
+            SDL_Rect merged;
+            Sint64 growth;
+
+            SDL_UnionRect(&data->dirty[i], &dirty, &merged);
+            growth = SW_RectArea(&merged) - SW_RectArea(&data->dirty[i]);
+            if (i == 0 || growth < best_growth) {
+                best_growth = growth;
+                best = i;
+            }
+        }
+        SDL_UnionRect(&data->dirty[best], &dirty, &dirty);
+        data->dirty[best] = data->dirty[--data->num_dirty];
+    }
+    data->dirty[data->num_dirty++] = dirty;
+
+    /* Past this, a single update is cheaper than many */
+    area = 0;
+    for (i = 0; i < data->num_dirty; ++i) {
+        area += SW_RectArea(&data->dirty[i]);
+    }
+    if (area * 4 > (Sint64)surface->w * surface->h * 3) {
+        data->dirty_all = SDL_TRUE;
+    }
+}
+
+/* Records the window surface area a draw command can touch */
+static void SW_MarkDirty(SW_RenderData *data, SDL_Surface *surface, const SW_DrawStateCache *drawstate,
+                         const SDL_RenderCommand *cmd, const void *vertices)
+{
+    const void *verts = ((const Uint8 *)vertices) + cmd->data.draw.first;
+    SDL_Rect clip, rect;
+    int i;
+
+    switch (cmd->command) {
+    case SDL_RENDERCMD_CLEAR:
+        data->dirty_all = SDL_TRUE;
+        return;
+
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES:
+        if (cmd->data.draw.count > 0) {
+            SW_GetDrawClip(surface, drawstate, &clip);
+            SDL_EnclosePoints((const SDL_Point *)verts, (int)cmd->data.draw.count, NULL, &rect);
+            rect.x += drawstate->viewport->x;
+            rect.y += drawstate->viewport->y;
+            SW_AddDirtyRect(data, surface, &rect, &clip);
+        }
+        break;
+
+    case SDL_RENDERCMD_FILL_RECTS:
+        SW_GetDrawClip(surface, drawstate, &clip);
+        for (i = 0; i < (int)cmd->data.draw.count; ++i) {
+            rect = ((const SDL_Rect *)verts)[i];
+            rect.x += drawstate->viewport->x;
+            rect.y += drawstate->viewport->y;
+            SW_AddDirtyRect(data, surface, &rect, &clip);
+        }
+        break;
+
+    case SDL_RENDERCMD_COPY:
+        SW_GetDrawClip(surface, drawstate, &clip);
+        rect = ((const SDL_Rect *)verts)[1];
+        rect.x += drawstate->viewport->x;
+        rect.y += drawstate->viewport->y;
+        SW_AddDirtyRect(data, surface, &rect, &clip);
+        break;
+
+    case SDL_RENDERCMD_COPY_EX:
+    {
+        /* The placement done by SW_RenderCopyEx() and Blit_to_Screen() */
+        const CopyExData *copydata = (const CopyExData *)verts;
+        double cangle, sangle;
+
+        SW_GetDrawClip(surface, drawstate, &clip);
+        SDLgfx_rotozoomSurfaceSizeTrig(copydata->dstrect.w, copydata->dstrect.h, copydata->angle, &copydata->center,
+                                       &rect, &cangle, &sangle);
+        rect.x += copydata->dstrect.x + drawstate->viewport->x;
+        rect.y += copydata->dstrect.y + drawstate->viewport->y;
+        if (copydata->scale_x != 1.0f || copydata->scale_y != 1.0f) {
+            /* Blit_to_Screen() truncates the scaled rect, which never
+               reaches past the floored origin or the ceiled far edge */
+            SDL_Rect scaled;
+            scaled.x = (int)SDL_floorf((float)rect.x * copydata->scale_x);
+            scaled.y = (int)SDL_floorf((float)rect.y * copydata->scale_y);
+            scaled.w = (int)SDL_ceilf((float)(rect.x + rect.w) * copydata->scale_x) - scaled.x;
+            scaled.h = (int)SDL_ceilf((float)(rect.y + rect.h) * copydata->scale_y) - scaled.y;
+            rect = scaled;
+        }
+        SW_AddDirtyRect(data, surface, &rect, &clip);
+        break;
+    }
+
+    case SDL_RENDERCMD_GEOMETRY:
+    {
+        const int count = (int)cmd->data.draw.count;
+        SDL_Point vp, d[3];
+        int j;
+
+        SW_GetDrawClip(surface, drawstate, &clip);
+        vp.x = drawstate->viewport->x;
+        vp.y = drawstate->viewport->y;
+        trianglepoint_2_fixedpoint(&vp);
+        for (i = 0; i + 2 < count; i += 3) {
+            for (j = 0; j < 3; ++j) {
+                if (cmd->data.draw.texture) {
+                    d[j] = ((const GeometryCopyData *)verts)[i + j].dst;
+                } else {
+                    d[j] = ((const GeometryFillData *)verts)[i + j].dst;
+                }
+                d[j].x += vp.x;
+                d[j].y += vp.y;
+            }
+            SDL_SW_TriangleBounds(&d[0], &d[1], &d[2], &rect);
+            SW_AddDirtyRect(data, surface, &rect, &clip);
+        }
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
 static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SW_DrawStateCache drawstate;
+    SDL_bool tiled;
 
     if (!surface) {
         return -1;
@@ -671,7 +1770,17 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
     drawstate.cliprect = NULL;
     drawstate.surface_cliprect_dirty = SDL_TRUE;
 
+    tiled = SW_BeginTiles(&data->tiles, surface);
+
     while (cmd) {
+        if (surface == data->window) {
+            SW_MarkDirty(data, surface, &drawstate, cmd, vertices);
+        }
+        if (tiled && SW_TileCommand(&data->tiles, surface, &drawstate, cmd, vertices)) {
+            cmd = cmd->next;
+            continue;
+        }
+
         switch (cmd->command) {
             case SDL_RENDERCMD_SETDRAWCOLOR: {
                 break;  /* Not used in this backend. */
@@ -928,6 +2037,11 @@ static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, vo
         cmd = cmd->next;
     }
 
+    if (tiled) {
+        SW_FlushTiles(&data->tiles);
+        SW_EndTiles(&data->tiles);
+    }
+
     return 0;
 }
 
@@ -963,12 +2077,25 @@ static int SW_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
 
 static int SW_RenderPresent(SDL_Renderer *renderer)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Window *window = renderer->window;
+    int retval;
 
     if (!window) {
         return -1;
     }
-    return SDL_UpdateWindowSurface(window);
+
+    /* Only push the areas drawn since the last present */
+    if (data->dirty_all || !data->window) {
+        retval = SDL_UpdateWindowSurface(window);
+    } else {
+        retval = SDL_UpdateWindowSurfaceRects(window, data->dirty, data->num_dirty);
+    }
+    if (retval == 0) {
+        data->num_dirty = 0;
+        data->dirty_all = SDL_FALSE;
+    }
+    return retval;
 }
 
 static void SW_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
@@ -982,10 +2109,18 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
 {
     SDL_Window *window = renderer->window;
     SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
+    int i;
 
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
+    if (data) {
+        SDL_DelHintCallback(SDL_HINT_RENDER_SOFTWARE_THREADS, SW_TileThreadsChanged, &data->tiles);
+        SW_QuitTileThreads(&data->tiles);
+        for (i = 0; i < SW_MAX_SCRATCH_SURFACES; ++i) {
+            SDL_FreeSurface(data->scratch[i].surface);
+        }
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -1014,9 +2149,11 @@ SDL_Renderer *SW_CreateRendererForSurface(SDL_Surface *surface)
     }
     data->surface = surface;
     data->window = surface;
+    SDL_AddHintCallback(SDL_HINT_RENDER_SOFTWARE_THREADS, SW_TileThreadsChanged, &data->tiles);
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
+    renderer->SupportsBlendMode = SW_SupportsBlendMode;
     renderer->CreateTexture = SW_CreateTexture;
     renderer->UpdateTexture = SW_UpdateTexture;
     renderer->LockTexture = SW_LockTexture;
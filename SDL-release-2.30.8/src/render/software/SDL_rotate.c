@@ -249,6 +249,413 @@ static void transformSurfaceY90(SDL_Surface *src, SDL_Surface *dst, int angle, i
 
 #undef TRANSFORM_SURFACE_90
 
+#ifdef SDL_SSE4_1_INTRINSICS
+/* !
+\brief Transforms a run of destination pixels of transformSurfaceRGBA() with SIMD.
+
+Each function handles whole vectors of pixels from the start of 'pc' and returns how
+many it did, with 'psdx' and 'psdy' advanced past them; the caller finishes the row.
+The results are exactly those of the scalar code. When all pixels of a vector sample
+the same source row, close enough together, the row is loaded directly and shuffled,
+which is the common case for small angles. Otherwise the pixels are fetched one by one,
+or gathered with AVX2.
+*/
+typedef int (*tTransformRowRGBA)(SDL_Surface *src, tColorRGBA *pc, int width, int *psdx, int *psdy,
+                                 int icos, int isin, int flipx, int flipy);
+
+/* Lowest and highest of four integers */
+SDL_TARGETING("sse4.1") static SDL_INLINE int hmin_epi32_SSE41(__m128i v)
+{
+    v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_min_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+SDL_TARGETING("sse4.1") static SDL_INLINE int hmax_epi32_SSE41(__m128i v)
+{
+    v = _mm_max_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_max_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+/* Loads the pixels at the byte offsets 'off' where 'mask' is set, keeping 'v' elsewhere */
+SDL_TARGETING("sse4.1") static SDL_INLINE __m128i fetch_epi32_SSE41(const Uint8 *pixels, __m128i off, int mask, __m128i v)
+{
+    int offsets[4], i;
+    Uint32 values[4];
+
+    _mm_storeu_si128((__m128i *)offsets, off);
+    _mm_storeu_si128((__m128i *)values, v);
+    for (i = 0; i < 4; i++) {
+        if (mask & (1 << i)) {
+            values[i] = *(const Uint32 *)(pixels + offsets[i]);
+        }
+    }
+    return _mm_loadu_si128((const __m128i *)values);
+}
+
+/* pshufb control moving the pixels at 'idx' of a vector into place */
+SDL_TARGETING("sse4.1") static SDL_INLINE __m128i pixel_shuffle_SSE41(__m128i idx)
+{
+    return _mm_add_epi32(_mm_mullo_epi32(idx, _mm_set1_epi32(0x04040404)), _mm_set1_epi32(0x03020100));
+}
+
+/* ((((b - a) * e) >> 16) + a) & 0xff for 16-bit lanes, with e an unsigned 16-bit weight.
+   The signed multiply sees e - 65536 for weights of 32768 and more, which is fixed up
+   by adding (b - a) back. */
+SDL_TARGETING("sse4.1") static SDL_INLINE __m128i lerp_epi16_SSE41(__m128i a, __m128i b, __m128i e)
+{
+    __m128i d = _mm_sub_epi16(b, a);
+    __m128i m = _mm_add_epi16(_mm_mulhi_epi16(d, e), _mm_and_si128(d, _mm_srai_epi16(e, 15)));
+    return _mm_and_si128(_mm_add_epi16(m, a), _mm_set1_epi16(0xff));
+}
+
+/* Bilinear interpolation of two pixels, c00 to c11 hold their channels in 16-bit lanes */
+SDL_TARGETING("sse4.1") static SDL_INLINE __m128i interpolate_epi16_SSE41(__m128i c00, __m128i c01, __m128i c10, __m128i c11, __m128i ex, __m128i ey)
+{
+    __m128i t1 = lerp_epi16_SSE41(c00, c01, ex);
+    __m128i t2 = lerp_epi16_SSE41(c10, c11, ex);
+    return lerp_epi16_SSE41(t1, t2, ey);
+}
+
+SDL_TARGETING("sse4.1") static int transformRowRGBASSE41(SDL_Surface *src, tColorRGBA *pc, int width, int *psdx, int *psdy,
+                                                         int icos, int isin, int flipx, int flipy)
+{
+    const Uint8 *pixels = (const Uint8 *)src->pixels;
+    const __m128i steps = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i sw = _mm_set1_epi32(src->w - 1);
+    const __m128i sh = _mm_set1_epi32(src->h - 1);
+    const __m128i pitch = _mm_set1_epi32(src->pitch);
+    const __m128i incx = _mm_set1_epi32(icos * 4);
+    const __m128i incy = _mm_set1_epi32(isin * 4);
+    __m128i sdx = _mm_add_epi32(_mm_set1_epi32(*psdx), _mm_mullo_epi32(_mm_set1_epi32(icos), steps));
+    __m128i sdy = _mm_add_epi32(_mm_set1_epi32(*psdy), _mm_mullo_epi32(_mm_set1_epi32(isin), steps));
+    int x;
+
+    for (x = 0; x + 4 <= width; x += 4) {
+        __m128i dx = _mm_srai_epi32(sdx, 16);
+        __m128i dy = _mm_srai_epi32(sdy, 16);
+        __m128i valid = _mm_and_si128(_mm_cmpeq_epi32(_mm_min_epu32(dx, sw), dx),
+                                      _mm_cmpeq_epi32(_mm_min_epu32(dy, sh), dy));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(valid));
+
+        if (mask) {
+            __m128i p = _mm_loadu_si128((const __m128i *)pc);
+            int row, dxmin;
+
+            if (flipx) {
+                dx = _mm_sub_epi32(sw, dx);
+            }
+            if (flipy) {
+                dy = _mm_sub_epi32(sh, dy);
+            }
+            row = _mm_cvtsi128_si32(dy);
+            dxmin = hmin_epi32_SSE41(dx);
+            if (mask == 0xf && _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(dy, _mm_set1_epi32(row)))) == 0xf &&
+                hmax_epi32_SSE41(dx) - dxmin < 4 && dxmin + 4 <= src->w) {
+                __m128i line = _mm_loadu_si128((const __m128i *)(pixels + row * src->pitch + dxmin * 4));
+                p = _mm_shuffle_epi8(line, pixel_shuffle_SSE41(_mm_sub_epi32(dx, _mm_set1_epi32(dxmin))));
+            } else {
+                __m128i off = _mm_add_epi32(_mm_mullo_epi32(dy, pitch), _mm_slli_epi32(dx, 2));
+                p = fetch_epi32_SSE41(pixels, off, mask, p);
+            }
+            _mm_storeu_si128((__m128i *)pc, p);
+        }
+        sdx = _mm_add_epi32(sdx, incx);
+        sdy = _mm_add_epi32(sdy, incy);
+        pc += 4;
+    }
+    *psdx = _mm_cvtsi128_si32(sdx);
+    *psdy = _mm_cvtsi128_si32(sdy);
+    return x;
+}
+
+SDL_TARGETING("sse4.1") static int transformRowRGBASmoothSSE41(SDL_Surface *src, tColorRGBA *pc, int width, int *psdx, int *psdy,
+                                                               int icos, int isin, int flipx, int flipy)
+{
+    const Uint8 *pixels = (const Uint8 *)src->pixels;
+    const __m128i steps = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i sw = _mm_set1_epi32(src->w - 1);
+    const __m128i sh = _mm_set1_epi32(src->h - 1);
+    const __m128i last_x = _mm_set1_epi32(src->w - 2);
+    const __m128i last_y = _mm_set1_epi32(src->h - 2);
+    const __m128i pitch = _mm_set1_epi32(src->pitch);
+    const __m128i fraction = _mm_set1_epi32(0xffff);
+    const __m128i weights_lo = _mm_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 4, 5, 4, 5, 4, 5, 4, 5);
+    const __m128i weights_hi = _mm_setr_epi8(8, 9, 8, 9, 8, 9, 8, 9, 12, 13, 12, 13, 12, 13, 12, 13);
+    const __m128i incx = _mm_set1_epi32(icos * 4);
+    const __m128i incy = _mm_set1_epi32(isin * 4);
+    __m128i sdx = _mm_add_epi32(_mm_set1_epi32(*psdx), _mm_mullo_epi32(_mm_set1_epi32(icos), steps));
+    __m128i sdy = _mm_add_epi32(_mm_set1_epi32(*psdy), _mm_mullo_epi32(_mm_set1_epi32(isin), steps));
+    int x;
+
+    /* The pixels of the last row and column are never interpolated from */
+    if (src->w < 2 || src->h < 2) {
+        return 0;
+    }
+
+    for (x = 0; x + 4 <= width; x += 4) {
+        __m128i dx = _mm_srai_epi32(sdx, 16);
+        __m128i dy = _mm_srai_epi32(sdy, 16);
+        __m128i valid;
+        int mask;
+
+        if (flipx) {
+            dx = _mm_sub_epi32(sw, dx);
+        }
+        if (flipy) {
+            dy = _mm_sub_epi32(sh, dy);
+        }
+        valid = _mm_and_si128(_mm_cmpeq_epi32(_mm_min_epu32(dx, last_x), dx),
+                              _mm_cmpeq_epi32(_mm_min_epu32(dy, last_y), dy));
+        mask = _mm_movemask_ps(_mm_castsi128_ps(valid));
+
+        if (mask) {
+            __m128i p = _mm_loadu_si128((const __m128i *)pc);
+            __m128i c00, c01, c10, c11, ex, ey, lo, hi, tmp;
+            int row, dxmin;
+
+            row = _mm_cvtsi128_si32(dy);
+            dxmin = hmin_epi32_SSE41(dx);
+            if (mask == 0xf && _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(dy, _mm_set1_epi32(row)))) == 0xf &&
+                hmax_epi32_SSE41(dx) - dxmin < 4 && dxmin + 5 <= src->w) {
+                const Uint8 *line = pixels + row * src->pitch + dxmin * 4;
+                __m128i shuffle = pixel_shuffle_SSE41(_mm_sub_epi32(dx, _mm_set1_epi32(dxmin)));
+                c00 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)line), shuffle);
+                c01 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(line + 4)), shuffle);
+                line += src->pitch;
+                c10 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)line), shuffle);
+                c11 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(line + 4)), shuffle);
+            } else {
+                __m128i off = _mm_add_epi32(_mm_mullo_epi32(dy, pitch), _mm_slli_epi32(dx, 2));
+                c00 = fetch_epi32_SSE41(pixels, off, mask, p);
+                c01 = fetch_epi32_SSE41(pixels + 4, off, mask, p);
+                c10 = fetch_epi32_SSE41(pixels + src->pitch, off, mask, p);
+                c11 = fetch_epi32_SSE41(pixels + src->pitch + 4, off, mask, p);
+            }
+            if (flipx) {
+                tmp = c00;
+                c00 = c01;
+                c01 = tmp;
+                tmp = c10;
+                c10 = c11;
+                c11 = tmp;
+            }
+            if (flipy) {
+                tmp = c00;
+                c00 = c10;
+                c10 = tmp;
+                tmp = c01;
+                c01 = c11;
+                c11 = tmp;
+            }
+
+            /* Interpolate two pixels at a time, with every channel in a 16-bit lane */
+            ex = _mm_and_si128(sdx, fraction);
+            ey = _mm_and_si128(sdy, fraction);
+            lo = interpolate_epi16_SSE41(_mm_cvtepu8_epi16(c00), _mm_cvtepu8_epi16(c01),
+                                         _mm_cvtepu8_epi16(c10), _mm_cvtepu8_epi16(c11),
+                                         _mm_shuffle_epi8(ex, weights_lo), _mm_shuffle_epi8(ey, weights_lo));
+            hi = interpolate_epi16_SSE41(_mm_unpackhi_epi8(c00, _mm_setzero_si128()), _mm_unpackhi_epi8(c01, _mm_setzero_si128()),
+                                         _mm_unpackhi_epi8(c10, _mm_setzero_si128()), _mm_unpackhi_epi8(c11, _mm_setzero_si128()),
+                                         _mm_shuffle_epi8(ex, weights_hi), _mm_shuffle_epi8(ey, weights_hi));
+            p = _mm_blendv_epi8(p, _mm_packus_epi16(lo, hi), valid);
+            _mm_storeu_si128((__m128i *)pc, p);
+        }
+        sdx = _mm_add_epi32(sdx, incx);
+        sdy = _mm_add_epi32(sdy, incy);
+        pc += 4;
+    }
+    *psdx = _mm_cvtsi128_si32(sdx);
+    *psdy = _mm_cvtsi128_si32(sdy);
+    return x;
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+SDL_TARGETING("avx2") static SDL_INLINE int hmin_epi32_AVX2(__m256i v)
+{
+    return hmin_epi32_SSE41(_mm_min_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE int hmax_epi32_AVX2(__m256i v)
+{
+    return hmax_epi32_SSE41(_mm_max_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1)));
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i lerp_epi16_AVX2(__m256i a, __m256i b, __m256i e)
+{
+    __m256i d = _mm256_sub_epi16(b, a);
+    __m256i m = _mm256_add_epi16(_mm256_mulhi_epi16(d, e), _mm256_and_si256(d, _mm256_srai_epi16(e, 15)));
+    return _mm256_and_si256(_mm256_add_epi16(m, a), _mm256_set1_epi16(0xff));
+}
+
+/* Bilinear interpolation of four pixels, the weights are per pixel in the low 16 bits of 'ex' and 'ey' */
+SDL_TARGETING("avx2") static SDL_INLINE __m256i interpolate_epi16_AVX2(__m128i c00, __m128i c01, __m128i c10, __m128i c11, __m128i ex, __m128i ey)
+{
+    const __m256i weights = _mm256_setr_epi8(0, 1, 0, 1, 0, 1, 0, 1, 4, 5, 4, 5, 4, 5, 4, 5,
+                                             8, 9, 8, 9, 8, 9, 8, 9, 12, 13, 12, 13, 12, 13, 12, 13);
+    __m256i wx = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(ex), weights);
+    __m256i wy = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(ey), weights);
+    __m256i t1 = lerp_epi16_AVX2(_mm256_cvtepu8_epi16(c00), _mm256_cvtepu8_epi16(c01), wx);
+    __m256i t2 = lerp_epi16_AVX2(_mm256_cvtepu8_epi16(c10), _mm256_cvtepu8_epi16(c11), wx);
+    return lerp_epi16_AVX2(t1, t2, wy);
+}
+
+SDL_TARGETING("avx2") static int transformRowRGBAAVX2(SDL_Surface *src, tColorRGBA *pc, int width, int *psdx, int *psdy,
+                                                      int icos, int isin, int flipx, int flipy)
+{
+    const int *pixels = (const int *)src->pixels;
+    const __m256i steps = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch);
+    const __m256i incx = _mm256_set1_epi32(icos * 8);
+    const __m256i incy = _mm256_set1_epi32(isin * 8);
+    __m256i sdx = _mm256_add_epi32(_mm256_set1_epi32(*psdx), _mm256_mullo_epi32(_mm256_set1_epi32(icos), steps));
+    __m256i sdy = _mm256_add_epi32(_mm256_set1_epi32(*psdy), _mm256_mullo_epi32(_mm256_set1_epi32(isin), steps));
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        __m256i dx = _mm256_srai_epi32(sdx, 16);
+        __m256i dy = _mm256_srai_epi32(sdy, 16);
+        __m256i valid = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_min_epu32(dx, sw), dx),
+                                         _mm256_cmpeq_epi32(_mm256_min_epu32(dy, sh), dy));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(valid));
+
+        if (mask) {
+            __m256i p = _mm256_loadu_si256((const __m256i *)pc);
+            int row, dxmin;
+
+            if (flipx) {
+                dx = _mm256_sub_epi32(sw, dx);
+            }
+            if (flipy) {
+                dy = _mm256_sub_epi32(sh, dy);
+            }
+            row = _mm256_cvtsi256_si32(dy);
+            dxmin = hmin_epi32_AVX2(dx);
+            if (mask == 0xff && _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(dy, _mm256_set1_epi32(row)))) == 0xff &&
+                hmax_epi32_AVX2(dx) - dxmin < 8 && dxmin + 8 <= src->w) {
+                __m256i line = _mm256_loadu_si256((const __m256i *)((const Uint8 *)pixels + row * src->pitch + dxmin * 4));
+                p = _mm256_permutevar8x32_epi32(line, _mm256_sub_epi32(dx, _mm256_set1_epi32(dxmin)));
+            } else {
+                __m256i off = _mm256_add_epi32(_mm256_mullo_epi32(dy, pitch), _mm256_slli_epi32(dx, 2));
+                p = _mm256_mask_i32gather_epi32(p, pixels, off, valid, 1);
+            }
+            _mm256_storeu_si256((__m256i *)pc, p);
+        }
+        sdx = _mm256_add_epi32(sdx, incx);
+        sdy = _mm256_add_epi32(sdy, incy);
+        pc += 8;
+    }
+    *psdx = _mm256_cvtsi256_si32(sdx);
+    *psdy = _mm256_cvtsi256_si32(sdy);
+    return x;
+}
+
+SDL_TARGETING("avx2") static int transformRowRGBASmoothAVX2(SDL_Surface *src, tColorRGBA *pc, int width, int *psdx, int *psdy,
+                                                            int icos, int isin, int flipx, int flipy)
+{
+    const int *pixels = (const int *)src->pixels;
+    const __m256i steps = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i sw = _mm256_set1_epi32(src->w - 1);
+    const __m256i sh = _mm256_set1_epi32(src->h - 1);
+    const __m256i last_x = _mm256_set1_epi32(src->w - 2);
+    const __m256i last_y = _mm256_set1_epi32(src->h - 2);
+    const __m256i pitch = _mm256_set1_epi32(src->pitch);
+    const __m256i fraction = _mm256_set1_epi32(0xffff);
+    const __m256i incx = _mm256_set1_epi32(icos * 8);
+    const __m256i incy = _mm256_set1_epi32(isin * 8);
+    __m256i sdx = _mm256_add_epi32(_mm256_set1_epi32(*psdx), _mm256_mullo_epi32(_mm256_set1_epi32(icos), steps));
+    __m256i sdy = _mm256_add_epi32(_mm256_set1_epi32(*psdy), _mm256_mullo_epi32(_mm256_set1_epi32(isin), steps));
+    int x;
+
+    /* The pixels of the last row and column are never interpolated from */
+    if (src->w < 2 || src->h < 2) {
+        return 0;
+    }
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        __m256i dx = _mm256_srai_epi32(sdx, 16);
+        __m256i dy = _mm256_srai_epi32(sdy, 16);
+        __m256i valid;
+        int mask;
+
+        if (flipx) {
+            dx = _mm256_sub_epi32(sw, dx);
+        }
+        if (flipy) {
+            dy = _mm256_sub_epi32(sh, dy);
+        }
+        valid = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_min_epu32(dx, last_x), dx),
+                                 _mm256_cmpeq_epi32(_mm256_min_epu32(dy, last_y), dy));
+        mask = _mm256_movemask_ps(_mm256_castsi256_ps(valid));
+
+        if (mask) {
+            __m256i p = _mm256_loadu_si256((const __m256i *)pc);
+            __m256i c00, c01, c10, c11, ex, ey, lo, hi, tmp;
+            int row, dxmin;
+
+            row = _mm256_cvtsi256_si32(dy);
+            dxmin = hmin_epi32_AVX2(dx);
+            if (mask == 0xff && _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(dy, _mm256_set1_epi32(row)))) == 0xff &&
+                hmax_epi32_AVX2(dx) - dxmin < 8 && dxmin + 9 <= src->w) {
+                const Uint8 *line = (const Uint8 *)pixels + row * src->pitch + dxmin * 4;
+                __m256i idx = _mm256_sub_epi32(dx, _mm256_set1_epi32(dxmin));
+                c00 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)line), idx);
+                c01 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(line + 4)), idx);
+                line += src->pitch;
+                c10 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)line), idx);
+                c11 = _mm256_permutevar8x32_epi32(_mm256_loadu_si256((const __m256i *)(line + 4)), idx);
+            } else {
+                __m256i off = _mm256_add_epi32(_mm256_mullo_epi32(dy, pitch), _mm256_slli_epi32(dx, 2));
+                c00 = _mm256_mask_i32gather_epi32(p, pixels, off, valid, 1);
+                c01 = _mm256_mask_i32gather_epi32(p, pixels + 1, off, valid, 1);
+                off = _mm256_add_epi32(off, pitch);
+                c10 = _mm256_mask_i32gather_epi32(p, pixels, off, valid, 1);
+                c11 = _mm256_mask_i32gather_epi32(p, pixels + 1, off, valid, 1);
+            }
+            if (flipx) {
+                tmp = c00;
+                c00 = c01;
+                c01 = tmp;
+                tmp = c10;
+                c10 = c11;
+                c11 = tmp;
+            }
+            if (flipy) {
+                tmp = c00;
+                c00 = c10;
+                c10 = tmp;
+                tmp = c01;
+                c01 = c11;
+                c11 = tmp;
+            }
+
+            /* Interpolate four pixels at a time, with every channel in a 16-bit lane */
+            ex = _mm256_and_si256(sdx, fraction);
+            ey = _mm256_and_si256(sdy, fraction);
+            lo = interpolate_epi16_AVX2(_mm256_castsi256_si128(c00), _mm256_castsi256_si128(c01),
+                                        _mm256_castsi256_si128(c10), _mm256_castsi256_si128(c11),
+                                        _mm256_castsi256_si128(ex), _mm256_castsi256_si128(ey));
+            hi = interpolate_epi16_AVX2(_mm256_extracti128_si256(c00, 1), _mm256_extracti128_si256(c01, 1),
+                                        _mm256_extracti128_si256(c10, 1), _mm256_extracti128_si256(c11, 1),
+                                        _mm256_extracti128_si256(ex, 1), _mm256_extracti128_si256(ey, 1));
+            /* packus works within 128-bit lanes, which leaves the pixel pairs as 0 2 1 3 */
+            p = _mm256_blendv_epi8(p, _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), _MM_SHUFFLE(3, 1, 2, 0)), valid);
+            _mm256_storeu_si256((__m256i *)pc, p);
+        }
+        sdx = _mm256_add_epi32(sdx, incx);
+        sdy = _mm256_add_epi32(sdy, incy);
+        pc += 8;
+    }
+    *psdx = _mm256_cvtsi256_si32(sdx);
+    *psdy = _mm256_cvtsi256_si32(sdy);
+    return x;
+}
+#endif /* SDL_AVX2_INTRINSICS */
+#endif /* SDL_SSE4_1_INTRINSICS */
+
 /* !
 \brief Internal 32 bit rotozoomer with optional anti-aliasing.
 
@@ -279,6 +686,9 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
     tColorRGBA *pc, *sp;
     int gap;
     const int fp_half = (1 << 15);
+#ifdef SDL_SSE4_1_INTRINSICS
+    tTransformRowRGBA transform_row = NULL;
+#endif
 
     /*
      * Variable setup
@@ -289,6 +699,16 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
     gap = dst->pitch - dst->w * 4;
     cx = (int)(center->x * 65536.0);
     cy = (int)(center->y * 65536.0);
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        transform_row = smooth ? transformRowRGBASmoothAVX2 : transformRowRGBAAVX2;
+    } else
+#endif
+    if (SDL_HasSSE41()) {
+        transform_row = smooth ? transformRowRGBASmoothSSE41 : transformRowRGBASSE41;
+    }
+#endif
 
     /*
      * Switch between interpolating and non-interpolating code
@@ -301,7 +721,14 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
             double src_y = (rect_dest->y + y + 0.5 - center->y);
             int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
             int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-            for (x = 0; x < dst->w; x++) {
+            x = 0;
+#ifdef SDL_SSE4_1_INTRINSICS
+            if (transform_row) {
+                x = transform_row(src, pc, dst->w, &sdx, &sdy, icos, isin, flipx, flipy);
+                pc += x;
+            }
+#endif
+            for (; x < dst->w; x++) {
                 int dx = (sdx >> 16);
                 int dy = (sdy >> 16);
                 if (flipx) {
@@ -369,7 +796,14 @@ static void transformSurfaceRGBA(SDL_Surface *src, SDL_Surface *dst, int isin, i
             double src_y = (rect_dest->y + y + 0.5 - center->y);
             int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
             int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
-            for (x = 0; x < dst->w; x++) {
+            x = 0;
+#ifdef SDL_SSE4_1_INTRINSICS
+            if (transform_row) {
+                x = transform_row(src, pc, dst->w, &sdx, &sdy, icos, isin, flipx, flipy);
+                pc += x;
+            }
+#endif
+            for (; x < dst->w; x++) {
                 int dx = (sdx >> 16);
                 int dy = (sdy >> 16);
                 if ((unsigned)dx < (unsigned)src->w && (unsigned)dy < (unsigned)src->h) {
@@ -462,6 +896,157 @@ static void transformSurfaceY(SDL_Surface *src, SDL_Surface *dst, int isin, int
     }
 }
 
+/* !
+\brief Scales, rotates and flips an area of a 32 bit surface with optional anti-aliasing.
+
+Gives the result of stretching 'srcrect' to 'width' x 'height' pixels and rotating that
+with transformSurfaceRGBA(), without the intermediate surface: the rotation is done in
+the stretched coordinates, which then select or interpolate the source pixels directly.
+
+Assumes src and dst surfaces are of 32 bit depth.
+Assumes dst surface was allocated with the correct dimensions.
+
+\param src Source surface.
+\param srcrect The area of the source surface to use.
+\param width The width 'srcrect' is stretched to.
+\param height The height 'srcrect' is stretched to.
+\param dst Destination surface.
+\param isin Integer version of sine of angle.
+\param icos Integer version of cosine of angle.
+\param flipx Flag indicating horizontal mirroring should be applied.
+\param flipy Flag indicating vertical mirroring should be applied.
+\param smooth Flag indicating anti-aliasing should be used.
+\param dst_rect destination coordinates
+\param center true center.
+*/
+static void transformSurfaceRGBAZoom(SDL_Surface *src, const SDL_Rect *srcrect, int width, int height,
+                                     SDL_Surface *dst, int isin, int icos,
+                                     int flipx, int flipy, int smooth,
+                                     const SDL_Rect *rect_dest,
+                                     const SDL_FPoint *center)
+{
+    int sw, sh;
+    int cx, cy;
+    Sint64 zincx, zincy;
+    tColorRGBA c00, c01, c10, c11;
+    tColorRGBA *pc, *sp;
+    int gap;
+    const int fp_half = (1 << 15);
+
+    /*
+     * Variable setup, the increments step through the source like SDL_SoftStretch()
+     */
+    sw = width - 1;
+    sh = height - 1;
+    zincx = ((Sint64)srcrect->w << 16) / width;
+    zincy = ((Sint64)srcrect->h << 16) / height;
+    pc = (tColorRGBA *)dst->pixels;
+    gap = dst->pitch - dst->w * 4;
+    cx = (int)(center->x * 65536.0);
+    cy = (int)(center->y * 65536.0);
+
+    /*
+     * Switch between interpolating and non-interpolating code
+     */
+    if (smooth) {
+        int y;
+        for (y = 0; y < dst->h; y++) {
+            int x;
+            double src_x = (rect_dest->x + 0 + 0.5 - center->x);
+            double src_y = (rect_dest->y + y + 0.5 - center->y);
+            int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
+            int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
+            for (x = 0; x < dst->w; x++) {
+                int dx = (sdx >> 16);
+                int dy = (sdy >> 16);
+                if (flipx) {
+                    dx = sw - dx;
+                }
+                if (flipy) {
+                    dy = sh - dy;
+                }
+                if ((dx > -1) && (dy > -1) && (dx < sw) && (dy < sh)) {
+                    /* Same coverage and mirroring as transformSurfaceRGBA(), then the
+                     * stretched position is mapped to the source pixel centers.
+                     */
+                    int px = flipx ? ((width << 16) - sdx) : sdx;
+                    int py = flipy ? ((height << 16) - sdy) : sdy;
+                    int qx = (int)((((Sint64)px + fp_half) * zincx) >> 16) - fp_half;
+                    int qy = (int)((((Sint64)py + fp_half) * zincy) >> 16) - fp_half;
+                    int sx = qx >> 16, sy = qy >> 16;
+                    int sx2 = sx + 1, sy2 = sy + 1;
+                    int ex = (qx & 0xffff);
+                    int ey = (qy & 0xffff);
+                    int t1, t2;
+                    if (sx < 0) {
+                        sx = sx2 = 0;
+                    } else if (sx2 >= srcrect->w) {
+                        sx = sx2 = srcrect->w - 1;
+                    }
+                    if (sy < 0) {
+                        sy = sy2 = 0;
+                    } else if (sy2 >= srcrect->h) {
+                        sy = sy2 = srcrect->h - 1;
+                    }
+                    sp = (tColorRGBA *)((Uint8 *)src->pixels + src->pitch * (srcrect->y + sy)) + srcrect->x;
+                    c00 = sp[sx];
+                    c01 = sp[sx2];
+                    sp = (tColorRGBA *)((Uint8 *)src->pixels + src->pitch * (srcrect->y + sy2)) + srcrect->x;
+                    c10 = sp[sx];
+                    c11 = sp[sx2];
+                    /*
+                     * Interpolate colors
+                     */
+                    t1 = ((((c01.r - c00.r) * ex) >> 16) + c00.r) & 0xff;
+                    t2 = ((((c11.r - c10.r) * ex) >> 16) + c10.r) & 0xff;
+                    pc->r = (((t2 - t1) * ey) >> 16) + t1;
+                    t1 = ((((c01.g - c00.g) * ex) >> 16) + c00.g) & 0xff;
+                    t2 = ((((c11.g - c10.g) * ex) >> 16) + c10.g) & 0xff;
+                    pc->g = (((t2 - t1) * ey) >> 16) + t1;
+                    t1 = ((((c01.b - c00.b) * ex) >> 16) + c00.b) & 0xff;
+                    t2 = ((((c11.b - c10.b) * ex) >> 16) + c10.b) & 0xff;
+                    pc->b = (((t2 - t1) * ey) >> 16) + t1;
+                    t1 = ((((c01.a - c00.a) * ex) >> 16) + c00.a) & 0xff;
+                    t2 = ((((c11.a - c10.a) * ex) >> 16) + c10.a) & 0xff;
+                    pc->a = (((t2 - t1) * ey) >> 16) + t1;
+                }
+                sdx += icos;
+                sdy += isin;
+                pc++;
+            }
+            pc = (tColorRGBA *)((Uint8 *)pc + gap);
+        }
+    } else {
+        int y;
+        for (y = 0; y < dst->h; y++) {
+            int x;
+            double src_x = (rect_dest->x + 0 + 0.5 - center->x);
+            double src_y = (rect_dest->y + y + 0.5 - center->y);
+            int sdx = (int)((icos * src_x - isin * src_y) + cx - fp_half);
+            int sdy = (int)((isin * src_x + icos * src_y) + cy - fp_half);
+            for (x = 0; x < dst->w; x++) {
+                int dx = (sdx >> 16);
+                int dy = (sdy >> 16);
+                if ((unsigned)dx < (unsigned)width && (unsigned)dy < (unsigned)height) {
+                    if (flipx) {
+                        dx = sw - dx;
+                    }
+                    if (flipy) {
+                        dy = sh - dy;
+                    }
+                    dx = srcrect->x + (int)((dx * zincx + zincx / 2) >> 16);
+                    dy = srcrect->y + (int)((dy * zincy + zincy / 2) >> 16);
+                    *pc = *((tColorRGBA *)((Uint8 *)src->pixels + src->pitch * dy) + dx);
+                }
+                sdx += icos;
+                sdy += isin;
+                pc++;
+            }
+            pc = (tColorRGBA *)((Uint8 *)pc + gap);
+        }
+    }
+}
+
 /* !
 \brief Rotates and zooms a surface with different horizontal and vertival scaling factors and optional anti-aliasing.
 
@@ -492,46 +1077,24 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
                      const SDL_Rect *rect_dest, double cangle, double sangle, const SDL_FPoint *center)
 {
     SDL_Surface *rz_dst;
-    int is8bit, angle90;
-    int i;
-    SDL_BlendMode blendmode;
-    Uint32 colorkey = 0;
-    int colorKeyAvailable = SDL_FALSE;
-    double sangleinv, cangleinv;
+    int is8bit;
 
     /* Sanity check */
     if (!src) {
         return NULL;
     }
 
-    if (SDL_HasColorKey(src)) {
-        if (SDL_GetColorKey(src, &colorkey) == 0) {
-            colorKeyAvailable = SDL_TRUE;
-        }
-    }
     /* This function requires a 32-bit surface or 8-bit surface with a colorkey */
-    is8bit = src->format->BitsPerPixel == 8 && colorKeyAvailable;
+    is8bit = src->format->BitsPerPixel == 8 && SDL_HasColorKey(src);
     if (!(is8bit || (src->format->BitsPerPixel == 32 && src->format->Amask))) {
         return NULL;
     }
 
-    /* Calculate target factors from sine/cosine and zoom */
-    sangleinv = sangle * 65536.0;
-    cangleinv = cangle * 65536.0;
-
     /* Alloc space to completely contain the rotated surface */
     rz_dst = NULL;
     if (is8bit) {
         /* Target surface is 8 bit */
         rz_dst = SDL_CreateRGBSurfaceWithFormat(0, rect_dest->w, rect_dest->h + GUARD_ROWS, 8, src->format->format);
-        if (rz_dst) {
-            if (src->format->palette) {
-                for (i = 0; i < src->format->palette->ncolors; i++) {
-                    rz_dst->format->palette->colors[i] = src->format->palette->colors[i];
-                }
-                rz_dst->format->palette->ncolors = src->format->palette->ncolors;
-            }
-        }
     } else {
         /* Target surface is 32 bit with source RGBA ordering */
         rz_dst = SDL_CreateRGBSurface(0, rect_dest->w, rect_dest->h + GUARD_ROWS, 32,
@@ -547,28 +1110,132 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
     /* Adjust for guard rows */
     rz_dst->h = rect_dest->h;
 
+    if (SDLgfx_rotozoomSurfaceInto(src, NULL, src->w, src->h, rz_dst, angle, smooth, flipx, flipy,
+                                   rect_dest, cangle, sangle, center) < 0) {
+        SDL_FreeSurface(rz_dst);
+        return NULL;
+    }
+
+    /* Return rotated surface */
+    return rz_dst;
+}
+
+/* !
+\brief Scales, rotates and flips an area of a surface into an existing surface.
+
+Works like SDLgfx_rotateSurface(), with 'srcrect' first stretched to 'width' x 'height'
+pixels, which is what 'rect_dest', 'cangle', 'sangle' and 'center' are relative to. Both
+steps are done at once, sampling 'src' a single time for each destination pixel, which
+is only supported for 32 bit surfaces. 'dst' is cleared, it must have the size of 'rect_dest' and the format that
+SDLgfx_rotateSurface() would create.
+
+\param src The surface to rotozoom.
+\param srcrect The area of 'src' to use, or NULL for all of it.
+\param width The width 'srcrect' is stretched to before the rotation.
+\param height The height 'srcrect' is stretched to before the rotation.
+\param dst The surface receiving the result.
+\param angle The angle to rotate in degrees.
+\param smooth Antialiasing flag; set to SMOOTHING_ON to enable.
+\param flipx Set to 1 to flip the image horizontally
+\param flipy Set to 1 to flip the image vertically
+\param rect_dest The destination rect bounding box
+\param cangle The angle cosine
+\param sangle The angle sine
+\param center The true coordinate of the center of rotation
+\return 0 on success, -1 if the surfaces can't be rotated.
+
+*/
+
+int SDLgfx_rotozoomSurfaceInto(SDL_Surface *src, const SDL_Rect *srcrect, int width, int height, SDL_Surface *dst,
+                               double angle, int smooth, int flipx, int flipy,
+                               const SDL_Rect *rect_dest, double cangle, double sangle, const SDL_FPoint *center)
+{
+    SDL_Rect full_rect;
+    int is8bit, angle90;
+    int i;
+    SDL_BlendMode blendmode;
+    Uint32 colorkey = 0;
+    int colorKeyAvailable = SDL_FALSE;
+    double sangleinv, cangleinv;
+    int zoom;
+
+    /* Sanity check */
+    if (!src || !dst || width <= 0 || height <= 0) {
+        return -1;
+    }
+
+    if (SDL_HasColorKey(src)) {
+        if (SDL_GetColorKey(src, &colorkey) == 0) {
+            colorKeyAvailable = SDL_TRUE;
+        }
+    }
+    /* This function requires a 32-bit surface or 8-bit surface with a colorkey */
+    is8bit = src->format->BitsPerPixel == 8 && colorKeyAvailable;
+    if (!(is8bit || (src->format->BitsPerPixel == 32 && src->format->Amask))) {
+        return -1;
+    }
+    if (dst->format->BitsPerPixel != src->format->BitsPerPixel || dst->w != rect_dest->w || dst->h != rect_dest->h) {
+        return -1;
+    }
+
+    if (!srcrect) {
+        full_rect.x = 0;
+        full_rect.y = 0;
+        full_rect.w = src->w;
+        full_rect.h = src->h;
+        srcrect = &full_rect;
+    }
+    if (srcrect->x < 0 || srcrect->y < 0 || srcrect->w <= 0 || srcrect->h <= 0 ||
+        srcrect->x + srcrect->w > src->w || srcrect->y + srcrect->h > src->h) {
+        return -1;
+    }
+    zoom = (srcrect->x != 0 || srcrect->y != 0 || srcrect->w != src->w || srcrect->h != src->h ||
+            width != src->w || height != src->h);
+    /* Only 32-bit surfaces can be scaled or cropped */
+    if (zoom && is8bit) {
+        return -1;
+    }
+
+    /* Calculate target factors from sine/cosine and zoom */
+    sangleinv = sangle * 65536.0;
+    cangleinv = cangle * 65536.0;
+
+    if (is8bit && src->format->palette && dst->format->palette) {
+        for (i = 0; i < src->format->palette->ncolors; i++) {
+            dst->format->palette->colors[i] = src->format->palette->colors[i];
+        }
+        dst->format->palette->ncolors = src->format->palette->ncolors;
+    }
+
     SDL_GetSurfaceBlendMode(src, &blendmode);
 
     if (colorKeyAvailable == SDL_TRUE) {
         /* If available, the colorkey will be used to discard the pixels that are outside of the rotated area. */
-        SDL_SetColorKey(rz_dst, SDL_TRUE, colorkey);
-        SDL_FillRect(rz_dst, NULL, colorkey);
-    } else if (blendmode == SDL_BLENDMODE_NONE) {
-        blendmode = SDL_BLENDMODE_BLEND;
+        SDL_SetColorKey(dst, SDL_TRUE, colorkey);
+        SDL_FillRect(dst, NULL, colorkey);
     } else if (blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) {
         /* Without a colorkey, the target texture has to be white for the MOD and MUL blend mode so
          * that the pixels outside the rotated area don't affect the destination surface.
          */
-        colorkey = SDL_MapRGBA(rz_dst->format, 255, 255, 255, 0);
-        SDL_FillRect(rz_dst, NULL, colorkey);
+        colorkey = SDL_MapRGBA(dst->format, 255, 255, 255, 0);
+        SDL_FillRect(dst, NULL, colorkey);
         /* Setting a white colorkey for the destination surface makes the final blit discard
          * all pixels outside of the rotated area. This doesn't interfere with anything because
          * white pixels are already a no-op and the MOD blend mode does not interact with alpha.
          */
-        SDL_SetColorKey(rz_dst, SDL_TRUE, colorkey);
+        SDL_SetColorKey(dst, SDL_TRUE, colorkey);
+    } else {
+        /* The pixels outside of the rotated area are transparent */
+        SDL_SetColorKey(dst, SDL_FALSE, 0);
+        for (i = 0; i < dst->h; i++) {
+            SDL_memset((Uint8 *)dst->pixels + i * dst->pitch, 0, (size_t)dst->w * 4);
+        }
+        if (blendmode == SDL_BLENDMODE_NONE) {
+            blendmode = SDL_BLENDMODE_BLEND;
+        }
     }
 
-    SDL_SetSurfaceBlendMode(rz_dst, blendmode);
+    SDL_SetSurfaceBlendMode(dst, blendmode);
 
     /* Lock source surface */
     if (SDL_MUSTLOCK(src)) {
@@ -580,7 +1247,7 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
      * multiples of 90 degrees.
      */
     angle90 = (int)(angle / 90);
-    if (angle90 == angle / 90) {
+    if (angle90 == angle / 90 && !zoom) {
         angle90 %= 4;
         if (angle90 < 0) {
             angle90 += 4; /* 0:0 deg, 1:90 deg, 2:180 deg, 3:270 deg */
@@ -593,17 +1260,20 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
     if (is8bit) {
         /* Call the 8-bit transformation routine to do the rotation */
         if (angle90 >= 0) {
-            transformSurfaceY90(src, rz_dst, angle90, flipx, flipy);
+            transformSurfaceY90(src, dst, angle90, flipx, flipy);
         } else {
-            transformSurfaceY(src, rz_dst, (int)sangleinv, (int)cangleinv,
+            transformSurfaceY(src, dst, (int)sangleinv, (int)cangleinv,
                               flipx, flipy, rect_dest, center);
         }
     } else {
         /* Call the 32-bit transformation routine to do the rotation */
         if (angle90 >= 0) {
-            transformSurfaceRGBA90(src, rz_dst, angle90, flipx, flipy);
+            transformSurfaceRGBA90(src, dst, angle90, flipx, flipy);
+        } else if (zoom) {
+            transformSurfaceRGBAZoom(src, srcrect, width, height, dst, (int)sangleinv, (int)cangleinv,
+                                     flipx, flipy, smooth, rect_dest, center);
         } else {
-            transformSurfaceRGBA(src, rz_dst, (int)sangleinv, (int)cangleinv,
+            transformSurfaceRGBA(src, dst, (int)sangleinv, (int)cangleinv,
                                  flipx, flipy, smooth, rect_dest, center);
         }
     }
@@ -613,8 +1283,7 @@ SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, in
         SDL_UnlockSurface(src);
     }
 
-    /* Return rotated surface */
-    return rz_dst;
+    return 0;
 }
 
 #endif /* SDL_VIDEO_RENDER_SW */
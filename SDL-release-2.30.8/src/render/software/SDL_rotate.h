@@ -24,6 +24,9 @@
 
 extern SDL_Surface *SDLgfx_rotateSurface(SDL_Surface *src, double angle, int smooth, int flipx, int flipy,
                                          const SDL_Rect *rect_dest, double cangle, double sangle, const SDL_FPoint *center);
+extern int SDLgfx_rotozoomSurfaceInto(SDL_Surface *src, const SDL_Rect *srcrect, int width, int height, SDL_Surface *dst,
+                                      double angle, int smooth, int flipx, int flipy,
+                                      const SDL_Rect *rect_dest, double cangle, double sangle, const SDL_FPoint *center);
 extern void SDLgfx_rotozoomSurfaceSizeTrig(int width, int height, double angle, const SDL_FPoint *center,
                                            SDL_Rect *rect_dest, double *cangle, double *sangle);
 
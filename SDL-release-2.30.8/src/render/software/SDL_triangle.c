@@ -148,6 +148,12 @@ static void bounding_rect_fixedpoint(const SDL_Point *a, const SDL_Point *b, con
     r->h = (max_y - min_y) >> FP_BITS;
 }
 
+/* Pixels that SDL_SW_FillTriangle() and SDL_SW_BlitTriangle() may touch, before clipping */
+void SDL_SW_TriangleBounds(const SDL_Point *d0, const SDL_Point *d1, const SDL_Point *d2, SDL_Rect *rect)
+{
+    bounding_rect_fixedpoint(d0, d1, d2, rect);
+}
+
 /* bounding rect of three points */
 static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Point *c, SDL_Rect *r)
 {
@@ -168,44 +174,116 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
  *
  */
 
-#define TRIANGLE_BEGIN_LOOP                                                        \
-    {                                                                              \
-        int x, y;                                                                  \
-        for (y = 0; y < dstrect.h; y++) {                                          \
-            /* y start */                                                          \
-            Sint64 w0 = w0_row;                                                    \
-            Sint64 w1 = w1_row;                                                    \
-            Sint64 w2 = w2_row;                                                    \
-            for (x = 0; x < dstrect.w; x++) {                                      \
-                /* In triangle */                                                  \
-                if (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0) { \
-                    Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
-
-/* Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles */
-#define TRIANGLE_GET_TEXTCOORD                                                          \
-    int srcx = (int)(((Sint64)w0 * s2s0_x + (Sint64)w1 * s2s1_x + s2_x_area.x) / area); \
-    int srcy = (int)(((Sint64)w0 * s2s0_y + (Sint64)w1 * s2s1_y + s2_x_area.y) / area);
-
-#define TRIANGLE_GET_MAPPED_COLOR                                                      \
-    int r = (int)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    int g = (int)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    int b = (int)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    int a = (int)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area); \
-    int color = SDL_MapRGBA(format, r, g, b, a);
+/* Restricts [*x_begin, *x_end) to the x where 'w + x * step >= 0', the pixels of a row
+ * on the inner side of an edge */
+static SDL_INLINE void triangle_span(Sint64 w, int step, int *x_begin, int *x_end)
+{
+    if (step > 0) {
+        if (w < 0) {
+            Sint64 first = (-w + step - 1) / step;
+            if (first >= *x_end) {
+                *x_begin = *x_end;
+            } else if (first > *x_begin) {
+                *x_begin = (int)first;
+            }
+        }
+    } else if (step < 0) {
+        Sint64 last = (w < 0) ? -1 : (w / -step);
+        if (last < *x_begin) {
+            *x_end = *x_begin;
+        } else if (last + 1 < *x_end) {
+            *x_end = (int)(last + 1);
+        }
+    } else if (w < 0) {
+        *x_end = *x_begin;
+    }
+}
 
-#define TRIANGLE_GET_COLOR                                                             \
-    int r = (int)(((Sint64)w0 * c0.r + (Sint64)w1 * c1.r + (Sint64)w2 * c2.r) / area); \
-    int g = (int)(((Sint64)w0 * c0.g + (Sint64)w1 * c1.g + (Sint64)w2 * c2.g) / area); \
-    int b = (int)(((Sint64)w0 * c0.b + (Sint64)w1 * c1.b + (Sint64)w2 * c2.b) / area); \
-    int a = (int)(((Sint64)w0 * c0.a + (Sint64)w1 * c1.a + (Sint64)w2 * c2.a) / area);
+/* A value 'n / area' where 'n' changes by a constant step from one pixel to the next,
+ * kept as a quotient and a remainder so that stepping needs no division */
+typedef struct
+{
+    Sint64 q, r;   /* floor(n / area) and the remainder, 0 <= r < area */
+    Sint64 dq, dr; /* the same for the step */
+} TriangleInterp;
 
-#define TRIANGLE_END_LOOP \
-    }                     \
-    /* x += 1 */          \
-    w0 += d2d1_y;         \
-    w1 += d0d2_y;         \
-    w2 += d1d0_y;         \
-    }                     \
+static SDL_INLINE void triangle_interp_init(TriangleInterp *interp, Sint64 n, Sint64 dn, Sint64 area)
+{
+    interp->q = n / area;
+    interp->r = n % area;
+    if (interp->r < 0) {
+        interp->q--;
+        interp->r += area;
+    }
+    interp->dq = dn / area;
+    interp->dr = dn % area;
+    if (interp->dr < 0) {
+        interp->dq--;
+        interp->dr += area;
+    }
+}
+
+static SDL_INLINE void triangle_interp_step(TriangleInterp *interp, Sint64 area)
+{
+    interp->q += interp->dq;
+    interp->r += interp->dr;
+    if (interp->r >= area) {
+        interp->r -= area;
+        interp->q++;
+    }
+}
+
+/* 'n / area', truncated like the division */
+static SDL_INLINE int triangle_interp_value(const TriangleInterp *interp)
+{
+    return (int)(interp->q + (interp->q < 0 && interp->r != 0));
+}
+
+/* w0 * v0 + w1 * v1 + w2 * v2 at pixel x of the row, and its change per pixel.
+ * Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles */
+#define TRIANGLE_WEIGHTED(v0, v1, v2)                                                 \
+    ((w0_row + (Sint64)x * d2d1_y) * (v0) + (w1_row + (Sint64)x * d0d2_y) * (v1) + \
+     (w2_row + (Sint64)x * d1d0_y) * (v2))
+#define TRIANGLE_WEIGHTED_STEP(v0, v1, v2) \
+    ((Sint64)d2d1_y * (v0) + (Sint64)d0d2_y * (v1) + (Sint64)d1d0_y * (v2))
+
+/* What TRIANGLE_BEGIN_LOOP interpolates: nothing, the color, the texture coordinates or both */
+#define TRIANGLE_INIT_NONE
+#define TRIANGLE_STEP_NONE (void)0
+
+#define TRIANGLE_INIT_COLOR                                                                                                   \
+    triangle_interp_init(&r_interp, TRIANGLE_WEIGHTED(c0.r, c1.r, c2.r), TRIANGLE_WEIGHTED_STEP(c0.r, c1.r, c2.r), area); \
+    triangle_interp_init(&g_interp, TRIANGLE_WEIGHTED(c0.g, c1.g, c2.g), TRIANGLE_WEIGHTED_STEP(c0.g, c1.g, c2.g), area); \
+    triangle_interp_init(&b_interp, TRIANGLE_WEIGHTED(c0.b, c1.b, c2.b), TRIANGLE_WEIGHTED_STEP(c0.b, c1.b, c2.b), area); \
+    triangle_interp_init(&a_interp, TRIANGLE_WEIGHTED(c0.a, c1.a, c2.a), TRIANGLE_WEIGHTED_STEP(c0.a, c1.a, c2.a), area);
+#define TRIANGLE_STEP_COLOR                                                                  \
+    triangle_interp_step(&r_interp, area), triangle_interp_step(&g_interp, area), \
+        triangle_interp_step(&b_interp, area), triangle_interp_step(&a_interp, area)
+
+#define TRIANGLE_INIT_TEXTCOORD                                                                                                \
+    triangle_interp_init(&srcx_interp, TRIANGLE_WEIGHTED(s2s0_x, s2s1_x, 0) + s2_x_area.x, TRIANGLE_WEIGHTED_STEP(s2s0_x, s2s1_x, 0), area); \
+    triangle_interp_init(&srcy_interp, TRIANGLE_WEIGHTED(s2s0_y, s2s1_y, 0) + s2_x_area.y, TRIANGLE_WEIGHTED_STEP(s2s0_y, s2s1_y, 0), area);
+#define TRIANGLE_STEP_TEXTCOORD \
+    triangle_interp_step(&srcx_interp, area), triangle_interp_step(&srcy_interp, area)
+
+#define TRIANGLE_INIT_TEXTCOORD_COLOR \
+    TRIANGLE_INIT_TEXTCOORD           \
+    TRIANGLE_INIT_COLOR
+#define TRIANGLE_STEP_TEXTCOORD_COLOR \
+    TRIANGLE_STEP_TEXTCOORD, TRIANGLE_STEP_COLOR
+
+/* Goes through the rows of dstrect, with [x, x_end) the pixels in the triangle */
+#define TRIANGLE_BEGIN_ROWS                                         \
+    {                                                               \
+        int x, y;                                                   \
+        for (y = 0; y < dstrect.h; y++) {                           \
+            int x_end = dstrect.w;                                  \
+            x = 0;                                                  \
+            triangle_span(w0_row + bias_w0, d2d1_y, &x, &x_end); \
+            triangle_span(w1_row + bias_w1, d0d2_y, &x, &x_end); \
+            triangle_span(w2_row + bias_w2, d1d0_y, &x, &x_end);
+
+#define TRIANGLE_END_ROWS \
     /* y += 1 */          \
     w0_row += d1d2_x;     \
     w1_row += d2d0_x;     \
@@ -214,6 +292,35 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
     }                     \
     }
 
+/* The interpolators are set up on every row, even an empty one, so they are
+   never read uninitialized */
+#define TRIANGLE_BEGIN_LOOP(interp)                                 \
+    TRIANGLE_BEGIN_ROWS                                             \
+    TRIANGLE_INIT_##interp                                          \
+    for (; x < x_end; x++, TRIANGLE_STEP_##interp) {                \
+        Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
+
+#define TRIANGLE_GET_TEXTCOORD                             \
+    int srcx = triangle_interp_value(&srcx_interp); \
+    int srcy = triangle_interp_value(&srcy_interp);
+
+#define TRIANGLE_GET_MAPPED_COLOR                \
+    int r = triangle_interp_value(&r_interp); \
+    int g = triangle_interp_value(&g_interp); \
+    int b = triangle_interp_value(&b_interp); \
+    int a = triangle_interp_value(&a_interp); \
+    int color = SDL_MapRGBA(format, r, g, b, a);
+
+#define TRIANGLE_GET_COLOR                       \
+    int r = triangle_interp_value(&r_interp); \
+    int g = triangle_interp_value(&g_interp); \
+    int b = triangle_interp_value(&b_interp); \
+    int a = triangle_interp_value(&a_interp);
+
+#define TRIANGLE_END_LOOP \
+    }                     \
+    TRIANGLE_END_ROWS
+
 int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Point *d2, SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2)
 {
     int ret = 0;
@@ -366,13 +473,13 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
         }
 
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
-            {
-                *(Uint32 *)dptr = color;
+            TRIANGLE_BEGIN_ROWS
+            if (x < x_end) {
+                SDL_memset4(dst_ptr + x * 4, color, x_end - x);
             }
-            TRIANGLE_END_LOOP
+            TRIANGLE_END_ROWS
         } else if (dstbpp == 3) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(NONE)
             {
                 Uint8 *s = (Uint8 *)&color;
                 dptr[0] = s[0];
@@ -381,13 +488,13 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 2) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(NONE)
             {
                 *(Uint16 *)dptr = color;
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 1) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(NONE)
             {
                 *dptr = color;
             }
@@ -395,18 +502,19 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
         }
     } else {
         SDL_PixelFormat *format = dst->format;
+        TriangleInterp r_interp, g_interp, b_interp, a_interp;
         if (tmp) {
             format = tmp->format;
         }
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *(Uint32 *)dptr = color;
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 3) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 Uint8 *s = (Uint8 *)&color;
@@ -416,14 +524,14 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 2) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *(Uint16 *)dptr = color;
             }
             TRIANGLE_END_LOOP
         } else if (dstbpp == 1) {
-            TRIANGLE_BEGIN_LOOP
+            TRIANGLE_BEGIN_LOOP(COLOR)
             {
                 TRIANGLE_GET_MAPPED_COLOR
                 *dptr = color;
@@ -482,6 +590,8 @@ int SDL_SW_BlitTriangle(
 
     int has_modulation;
 
+    TriangleInterp srcx_interp, srcy_interp;
+
     if (!src) {
         return SDL_InvalidParamError("src");
     }
@@ -716,7 +826,7 @@ int SDL_SW_BlitTriangle(
     }
 
     if (dstbpp == 4) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint32 *sptr = (Uint32 *)((Uint8 *)src_ptr + srcy * src_pitch);
@@ -724,7 +834,7 @@ int SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 3) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint8 *sptr = (Uint8 *)src_ptr + srcy * src_pitch;
@@ -734,7 +844,7 @@ int SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 2) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint16 *sptr = (Uint16 *)((Uint8 *)src_ptr + srcy * src_pitch);
@@ -742,7 +852,7 @@ int SDL_SW_BlitTriangle(
         }
         TRIANGLE_END_LOOP
     } else if (dstbpp == 1) {
-        TRIANGLE_BEGIN_LOOP
+        TRIANGLE_BEGIN_LOOP(TEXTCOORD)
         {
             TRIANGLE_GET_TEXTCOORD
             Uint8 *sptr = (Uint8 *)src_ptr + srcy * src_pitch;
@@ -805,10 +915,13 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
     Uint8 *dst_ptr = info->dst;
     int dst_pitch = info->dst_pitch;
 
+    TriangleInterp srcx_interp, srcy_interp;
+    TriangleInterp r_interp, g_interp, b_interp, a_interp;
+
     srcfmt_val = detect_format(src_fmt);
     dstfmt_val = detect_format(dst_fmt);
 
-    TRIANGLE_BEGIN_LOOP
+    TRIANGLE_BEGIN_LOOP(TEXTCOORD_COLOR)
     {
         Uint8 *src;
         Uint8 *dst = dptr;
@@ -834,7 +947,7 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
                 continue;
             }
         }
-        if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL))) {
+        if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED))) {
             if (FORMAT_HAS_ALPHA(dstfmt_val)) {
                 DISEMBLE_RGBA(dst, dstbpp, dst_fmt, dstpixel, dstR, dstG, dstB, dstA);
             } else if (FORMAT_HAS_NO_ALPHA(dstfmt_val)) {
@@ -874,7 +987,7 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
                 srcB = (srcB * srcA) / 255;
             }
         }
-        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED)) {
         case 0:
             dstR = srcR;
             dstG = srcG;
@@ -887,6 +1000,24 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
             dstB = srcB + ((255 - srcA) * dstB) / 255;
             dstA = srcA + ((255 - srcA) * dstA) / 255;
             break;
+        case SDL_COPY_BLEND_PREMULTIPLIED:
+            dstR = srcR + ((255 - srcA) * dstR + 127) / 255;
+            if (dstR > 255) {
+                dstR = 255;
+            }
+            dstG = srcG + ((255 - srcA) * dstG + 127) / 255;
+            if (dstG > 255) {
+                dstG = 255;
+            }
+            dstB = srcB + ((255 - srcA) * dstB + 127) / 255;
+            if (dstB > 255) {
+                dstB = 255;
+            }
+            dstA = srcA + ((255 - srcA) * dstA + 127) / 255;
+            if (dstA > 255) {
+                dstA = 255;
+            }
+            break;
         case SDL_COPY_ADD:
             dstR = srcR + dstR;
             if (dstR > 255) {
@@ -35,6 +35,8 @@ extern int SDL_SW_BlitTriangle(
     SDL_Point *d0, SDL_Point *d1, SDL_Point *d2,
     SDL_Color c0, SDL_Color c1, SDL_Color c2);
 
+extern void SDL_SW_TriangleBounds(const SDL_Point *d0, const SDL_Point *d1, const SDL_Point *d2, SDL_Rect *rect);
+
 extern void trianglepoint_2_fixedpoint(SDL_Point *a);
 
 #endif /* SDL_triangle_h_ */
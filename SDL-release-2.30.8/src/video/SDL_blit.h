@@ -45,6 +45,7 @@ extern Uint8 *SDL_expand_byte[9];
 #define SDL_COPY_MUL            0x00000080
 #define SDL_COPY_COLORKEY       0x00000100
 #define SDL_COPY_NEAREST        0x00000200
+#define SDL_COPY_BLEND_PREMULTIPLIED 0x00000400
 #define SDL_COPY_RLE_DESIRED    0x00001000
 #define SDL_COPY_RLE_COLORKEY   0x00002000
 #define SDL_COPY_RLE_ALPHAKEY   0x00004000
@@ -58,6 +59,8 @@ extern Uint8 *SDL_expand_byte[9];
 #define SDL_CPU_SSE2               0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000020
+#define SDL_CPU_SSE41              0x00000040
+#define SDL_CPU_AVX2               0x00000080
 
 typedef struct
 {
@@ -412,6 +412,577 @@ static void BlitRGBtoRGBPixelAlphaMMX(SDL_BlitInfo *info)
 
 #endif /* __MMX__ */
 
+#ifdef __SSE2__
+
+/* The SSE2 and wider blitters work a row at a time. Each row function handles
+   as many whole vectors as it can and blends the pixels left over through a
+   small buffer, so every pixel goes through the same arithmetic. */
+typedef void (*BlitRowFuncA)(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info);
+
+static void BlitRowsA(SDL_BlitInfo *info, BlitRowFuncA blit_row)
+{
+    const int srcbpp = info->src_fmt->BytesPerPixel;
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        blit_row(src, dst, info->dst_w, info);
+        src += info->dst_w * srcbpp + info->src_skip;
+        dst += info->dst_w * dstbpp + info->dst_skip;
+    }
+}
+
+#define BLIT_ROW_TAIL_SSE2(srcbpp, dstbpp, blend)                                     \
+    if (x < width) {                                                                  \
+        Uint8 s[16] = { 0 }, d[16] = { 0 };                                           \
+        SDL_memcpy(s, src + (srcbpp) * x, (size_t)(width - x) * (srcbpp));            \
+        SDL_memcpy(d, dst + (dstbpp) * x, (size_t)(width - x) * (dstbpp));            \
+        _mm_storeu_si128((__m128i *)d, blend(_mm_loadu_si128((const __m128i *)s),     \
+                                             _mm_loadu_si128((const __m128i *)d)));   \
+        SDL_memcpy(dst + (dstbpp) * x, d, (size_t)(width - x) * (dstbpp));            \
+    }
+
+/* Same arithmetic as BlitRGBtoRGBPixelAlphaMMX(), 4 pixels at a time:
+   dstRGB = (srcRGB * srcA >> 8) + (dstRGB * (255 - srcA) >> 8)
+   dstA = srcA + (dstA * (255 - srcA) >> 8)
+   alpha_lane is 0xFFFF in the alpha channel of each unpacked pixel */
+static SDL_INLINE __m128i BlendPixelAlphaSSE2(__m128i s, __m128i d, __m128i amask, __m128i ashift, __m128i alpha_lane)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i sa = _mm_and_si128(s, amask);
+    const __m128i opaque = _mm_cmpeq_epi32(sa, amask);
+    const __m128i transparent = _mm_cmpeq_epi32(sa, zero);
+    const __m128i alpha_one = _mm_and_si128(alpha_lane, _mm_set1_epi16(0x100));
+    __m128i a, a_lo, a_hi, r_lo, r_hi, r;
+
+    /* srcA in every channel, and 256 in the alpha channel of the source multiplier so srcA is kept as is */
+    a = _mm_srl_epi32(sa, ashift);
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 8));
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+    a_lo = _mm_unpacklo_epi8(a, zero);
+    a_hi = _mm_unpackhi_epi8(a, zero);
+
+    r_lo = _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_or_si128(_mm_andnot_si128(alpha_lane, a_lo), alpha_one));
+    r_hi = _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_or_si128(_mm_andnot_si128(alpha_lane, a_hi), alpha_one));
+    a_lo = _mm_xor_si128(a_lo, _mm_set1_epi16(0xFF));
+    a_hi = _mm_xor_si128(a_hi, _mm_set1_epi16(0xFF));
+    r_lo = _mm_add_epi16(_mm_srli_epi16(r_lo, 8), _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), a_lo), 8));
+    r_hi = _mm_add_epi16(_mm_srli_epi16(r_hi, 8), _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), a_hi), 8));
+    r = _mm_packus_epi16(r_lo, r_hi);
+
+    /* Opaque pixels are copied and transparent ones left alone */
+    r = _mm_or_si128(_mm_and_si128(opaque, s), _mm_andnot_si128(opaque, r));
+    return _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, r));
+}
+
+static __m128i GetAlphaLaneSSE2(const SDL_PixelFormat *fmt)
+{
+    /* The alpha channel is 16 bit channel Ashift / 8 of each unpacked pixel */
+    const int lane = (int)(0xFFFFu << ((fmt->Ashift & 8) * 2));
+
+    if (fmt->Ashift < 16) {
+        return _mm_set_epi32(0, lane, 0, lane);
+    }
+    return _mm_set_epi32(lane, 0, lane, 0);
+}
+
+static void BlitRGBtoRGBPixelAlphaRowSSE2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m128i amask = _mm_set1_epi32(info->src_fmt->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(info->src_fmt->Ashift);
+    const __m128i alpha_lane = GetAlphaLaneSSE2(info->src_fmt);
+    int x;
+
+#define BLEND(s, d) BlendPixelAlphaSSE2(s, d, amask, ashift, alpha_lane)
+    for (x = 0; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + 4 * x));
+        const __m128i sa = _mm_and_si128(s, amask);
+
+        /* Sprites are mostly fully transparent or fully opaque */
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, _mm_setzero_si128())) == 0xFFFF) {
+            continue;
+        } else if (_mm_movemask_epi8(_mm_cmpeq_epi32(sa, amask)) == 0xFFFF) {
+            _mm_storeu_si128((__m128i *)(dst + 4 * x), s);
+        } else {
+            _mm_storeu_si128((__m128i *)(dst + 4 * x), BLEND(s, _mm_loadu_si128((const __m128i *)(dst + 4 * x))));
+        }
+    }
+    BLIT_ROW_TAIL_SSE2(4, 4, BLEND)
+#undef BLEND
+}
+
+static void BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoRGBPixelAlphaRowSSE2);
+}
+
+/* Same arithmetic as BlitRGBtoRGBSurfaceAlphaMMX(), 4 pixels at a time:
+   dst = dst + ((src - dst) * alpha >> 8), then the destination alpha mask is set.
+   alpha has the surface alpha in the color channels of each unpacked pixel, and
+   keep clears the alpha channel where the MMX version takes its alpha=128 shortcut */
+static SDL_INLINE __m128i BlendSurfaceAlphaSSE2(__m128i s, __m128i d, __m128i alpha, __m128i keep, __m128i dsta)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+    const __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+    __m128i r_lo, r_hi;
+
+    r_lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(s, zero), d_lo), alpha), 8);
+    r_hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(s, zero), d_hi), alpha), 8);
+    r_lo = _mm_add_epi8(r_lo, d_lo);
+    r_hi = _mm_add_epi8(r_hi, d_hi);
+    return _mm_or_si128(_mm_and_si128(_mm_packus_epi16(r_lo, r_hi), keep), dsta);
+}
+
+static void GetSurfaceAlphaSSE2(const SDL_BlitInfo *info, __m128i *alpha, __m128i *keep, __m128i *dsta)
+{
+    const SDL_PixelFormat *df = info->dst_fmt;
+    const Uint32 chanmask = (0xffu << df->Rshift) | (0xffu << df->Gshift) | (0xffu << df->Bshift);
+    Uint32 amult = info->a | (info->a << 8);
+
+    amult |= amult << 16;
+    *alpha = _mm_unpacklo_epi8(_mm_set1_epi32((int)(amult & chanmask)), _mm_setzero_si128());
+    if (info->a == 128 && (df->Rmask | df->Gmask | df->Bmask) == 0x00FFFFFF) {
+        *keep = _mm_set1_epi32(0x00FFFFFF);
+    } else {
+        *keep = _mm_set1_epi32(-1);
+    }
+    *dsta = _mm_set1_epi32((int)df->Amask);
+}
+
+static void BlitRGBtoRGBSurfaceAlphaRowSSE2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    __m128i alpha, keep, dsta;
+    int x;
+
+    GetSurfaceAlphaSSE2(info, &alpha, &keep, &dsta);
+#define BLEND(s, d) BlendSurfaceAlphaSSE2(s, d, alpha, keep, dsta)
+    for (x = 0; x + 4 <= width; x += 4) {
+        _mm_storeu_si128((__m128i *)(dst + 4 * x), BLEND(_mm_loadu_si128((const __m128i *)(src + 4 * x)),
+                                                          _mm_loadu_si128((const __m128i *)(dst + 4 * x))));
+    }
+    BLIT_ROW_TAIL_SSE2(4, 4, BLEND)
+#undef BLEND
+}
+
+static void BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoRGBSurfaceAlphaRowSSE2);
+}
+
+/* Premultiplied source: dst = src + dst * (255 - srcA) / 255 in all four channels,
+   rounded to nearest and saturated so that bad premultiplied data can't wrap.
+   The division by 255 is (t + (t >> 8)) >> 8 with t = dst * (255 - srcA) + 128,
+   which is exact for 8 bit values. */
+static SDL_INLINE __m128i BlendPremultipliedSSE2(__m128i s, __m128i d, __m128i amask, __m128i ashift)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(128);
+    __m128i ia, ia_lo, ia_hi, r_lo, r_hi;
+
+    ia = _mm_srl_epi32(_mm_and_si128(s, amask), ashift);
+    ia = _mm_or_si128(ia, _mm_slli_epi32(ia, 8));
+    ia = _mm_or_si128(ia, _mm_slli_epi32(ia, 16));
+    ia = _mm_xor_si128(ia, _mm_set1_epi32(-1));
+    ia_lo = _mm_unpacklo_epi8(ia, zero);
+    ia_hi = _mm_unpackhi_epi8(ia, zero);
+
+    r_lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), ia_lo), round);
+    r_hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), ia_hi), round);
+    r_lo = _mm_srli_epi16(_mm_add_epi16(r_lo, _mm_srli_epi16(r_lo, 8)), 8);
+    r_hi = _mm_srli_epi16(_mm_add_epi16(r_hi, _mm_srli_epi16(r_hi, 8)), 8);
+    return _mm_adds_epu8(s, _mm_packus_epi16(r_lo, r_hi));
+}
+
+static void BlitRGBtoRGBPremultipliedRowSSE2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m128i amask = _mm_set1_epi32(info->src_fmt->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(info->src_fmt->Ashift);
+    int x;
+
+#define BLEND(s, d) BlendPremultipliedSSE2(s, d, amask, ashift)
+    for (x = 0; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + 4 * x));
+
+        /* Transparent pixels are all zero, unless they're meant to be additive */
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(s, _mm_setzero_si128())) == 0xFFFF) {
+            continue;
+        } else if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(s, amask), amask)) == 0xFFFF) {
+            _mm_storeu_si128((__m128i *)(dst + 4 * x), s);
+        } else {
+            _mm_storeu_si128((__m128i *)(dst + 4 * x), BLEND(s, _mm_loadu_si128((const __m128i *)(dst + 4 * x))));
+        }
+    }
+    BLIT_ROW_TAIL_SSE2(4, 4, BLEND)
+#undef BLEND
+}
+
+static void BlitRGBtoRGBPremultipliedSSE2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoRGBPremultipliedRowSSE2);
+}
+
+/* Blend the 5 and 6 bit channels of 8 RGB565 pixels: dst = dst + ((src - dst) * alpha >> 5)
+   This is what the packed arithmetic of Blit565to565SurfaceAlpha() and BlitARGBto565PixelAlpha() works out to */
+static SDL_INLINE __m128i Blend565SSE2(__m128i sr, __m128i sg, __m128i sb, __m128i d, __m128i alpha)
+{
+    const __m128i dr = _mm_srli_epi16(d, 11);
+    const __m128i dg = _mm_and_si128(_mm_srli_epi16(d, 5), _mm_set1_epi16(0x3F));
+    const __m128i db = _mm_and_si128(d, _mm_set1_epi16(0x1F));
+    const __m128i r = _mm_add_epi16(dr, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(sr, dr), alpha), 5));
+    const __m128i g = _mm_add_epi16(dg, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(sg, dg), alpha), 5));
+    const __m128i b = _mm_add_epi16(db, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(sb, db), alpha), 5));
+
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+}
+
+static SDL_INLINE __m128i Blend565SurfaceAlphaSSE2(__m128i s, __m128i d, __m128i alpha)
+{
+    return Blend565SSE2(_mm_srli_epi16(s, 11), _mm_and_si128(_mm_srli_epi16(s, 5), _mm_set1_epi16(0x3F)),
+                        _mm_and_si128(s, _mm_set1_epi16(0x1F)), d, alpha);
+}
+
+static void Blit565to565SurfaceAlphaRowSSE2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    /* alpha=128 averages the channels, which is the same as alpha >> 3 = 16 */
+    const __m128i alpha = _mm_set1_epi16(info->a >> 3);
+    int x;
+
+#define BLEND(s, d) Blend565SurfaceAlphaSSE2(s, d, alpha)
+    for (x = 0; x + 8 <= width; x += 8) {
+        _mm_storeu_si128((__m128i *)(dst + 2 * x), BLEND(_mm_loadu_si128((const __m128i *)(src + 2 * x)),
+                                                          _mm_loadu_si128((const __m128i *)(dst + 2 * x))));
+    }
+    BLIT_ROW_TAIL_SSE2(2, 2, BLEND)
+#undef BLEND
+}
+
+static void Blit565to565SurfaceAlphaSSE2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, Blit565to565SurfaceAlphaRowSSE2);
+}
+
+/* 8 ARGB8888 pixels, in s0 and s1, blended onto RGB565 with the source alpha cut to 5 bits.
+   Opaque pixels are copied, which is the same as an alpha of 32 */
+static SDL_INLINE __m128i BlendARGBto565PixelAlphaSSE2(__m128i s0, __m128i s1, __m128i d)
+{
+    const __m128i m5 = _mm_set1_epi32(0x1F);
+    const __m128i sr = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 19), m5), _mm_and_si128(_mm_srli_epi32(s1, 19), m5));
+    const __m128i sg = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 10), _mm_set1_epi32(0x3F)), _mm_and_si128(_mm_srli_epi32(s1, 10), _mm_set1_epi32(0x3F)));
+    const __m128i sb = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 3), m5), _mm_and_si128(_mm_srli_epi32(s1, 3), m5));
+    __m128i alpha = _mm_packs_epi32(_mm_srli_epi32(s0, 27), _mm_srli_epi32(s1, 27));
+
+    alpha = _mm_sub_epi16(alpha, _mm_cmpeq_epi16(alpha, _mm_set1_epi16(0x1F)));
+    return Blend565SSE2(sr, sg, sb, d, alpha);
+}
+
+static void BlitARGBto565PixelAlphaRowSSE2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        const __m128i s0 = _mm_loadu_si128((const __m128i *)(src + 4 * x));
+        const __m128i s1 = _mm_loadu_si128((const __m128i *)(src + 4 * x + 16));
+        _mm_storeu_si128((__m128i *)(dst + 2 * x), BlendARGBto565PixelAlphaSSE2(s0, s1, _mm_loadu_si128((const __m128i *)(dst + 2 * x))));
+    }
+    if (x < width) {
+        Uint8 s[32] = { 0 }, d[16] = { 0 };
+        SDL_memcpy(s, src + 4 * x, (size_t)(width - x) * 4);
+        SDL_memcpy(d, dst + 2 * x, (size_t)(width - x) * 2);
+        _mm_storeu_si128((__m128i *)d, BlendARGBto565PixelAlphaSSE2(_mm_loadu_si128((const __m128i *)s), _mm_loadu_si128((const __m128i *)(s + 16)),
+                                                                    _mm_loadu_si128((const __m128i *)d)));
+        SDL_memcpy(dst + 2 * x, d, (size_t)(width - x) * 2);
+    }
+}
+
+static void BlitARGBto565PixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitARGBto565PixelAlphaRowSSE2);
+}
+
+#ifdef SDL_SSE4_1_INTRINSICS
+
+/* Same arithmetic as BlitRGBtoBGRPixelAlpha(), 4 pixels at a time. The C version
+   blends red and blue together in 32 bits, which needs a 32 bit multiply to match */
+SDL_TARGETING("sse4.1") static __m128i BlendRGBtoBGRPixelAlphaSSE41(__m128i s, __m128i d)
+{
+    const __m128i rb_mask = _mm_set1_epi32(0x00FF00FF);
+    const __m128i g_mask = _mm_set1_epi32(0x0000FF00);
+    const __m128i alpha = _mm_srli_epi32(s, 24);
+    const __m128i opaque = _mm_cmpeq_epi32(alpha, _mm_set1_epi32(0xFF));
+    const __m128i transparent = _mm_cmpeq_epi32(alpha, _mm_setzero_si128());
+    __m128i s1 = _mm_and_si128(s, rb_mask);
+    __m128i sg = _mm_and_si128(s, g_mask);
+    __m128i d1 = _mm_and_si128(d, rb_mask);
+    __m128i dg = _mm_and_si128(d, g_mask);
+    __m128i da = _mm_srli_epi32(d, 24);
+    __m128i r;
+
+    s1 = _mm_or_si128(_mm_srli_epi32(s1, 16), _mm_slli_epi32(s1, 16));
+    d1 = _mm_and_si128(_mm_add_epi32(d1, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s1, d1), alpha), 8)), rb_mask);
+    dg = _mm_and_si128(_mm_add_epi32(dg, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(sg, dg), alpha), 8)), g_mask);
+    da = _mm_add_epi32(alpha, _mm_srli_epi32(_mm_mullo_epi32(da, _mm_xor_si128(alpha, _mm_set1_epi32(0xFF))), 8));
+    r = _mm_or_si128(_mm_or_si128(d1, dg), _mm_slli_epi32(da, 24));
+
+    r = _mm_blendv_epi8(r, _mm_or_si128(_mm_or_si128(s1, sg), _mm_set1_epi32((int)0xFF000000)), opaque);
+    return _mm_blendv_epi8(r, d, transparent);
+}
+
+SDL_TARGETING("sse4.1") static void BlitRGBtoBGRPixelAlphaRowSSE41(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    int x;
+
+    for (x = 0; x + 4 <= width; x += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + 4 * x));
+        if (_mm_testz_si128(s, _mm_set1_epi32((int)0xFF000000))) {
+            continue;
+        }
+        _mm_storeu_si128((__m128i *)(dst + 4 * x), BlendRGBtoBGRPixelAlphaSSE41(s, _mm_loadu_si128((const __m128i *)(dst + 4 * x))));
+    }
+    BLIT_ROW_TAIL_SSE2(4, 4, BlendRGBtoBGRPixelAlphaSSE41)
+}
+
+static void BlitRGBtoBGRPixelAlphaSSE41(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoBGRPixelAlphaRowSSE41);
+}
+
+#endif /* SDL_SSE4_1_INTRINSICS */
+
+#ifdef SDL_AVX2_INTRINSICS
+
+/* The AVX2 versions do 8 or 16 pixels at a time with the same arithmetic as
+   the SSE2 ones, which finish the rows */
+
+SDL_TARGETING("avx2") static void BlitRGBtoRGBPixelAlphaRowAVX2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i amask = _mm256_set1_epi32(info->src_fmt->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(info->src_fmt->Ashift);
+    const __m256i alpha_lane = _mm256_broadcastsi128_si256(GetAlphaLaneSSE2(info->src_fmt));
+    const __m256i alpha_one = _mm256_and_si256(alpha_lane, _mm256_set1_epi16(0x100));
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + 4 * x));
+        const __m256i sa = _mm256_and_si256(s, amask);
+        const __m256i opaque = _mm256_cmpeq_epi32(sa, amask);
+        const __m256i transparent = _mm256_cmpeq_epi32(sa, zero);
+        __m256i d, a, a_lo, a_hi, r_lo, r_hi, r;
+
+        if (_mm256_movemask_epi8(transparent) == -1) {
+            continue;
+        } else if (_mm256_movemask_epi8(opaque) == -1) {
+            _mm256_storeu_si256((__m256i *)(dst + 4 * x), s);
+            continue;
+        }
+
+        d = _mm256_loadu_si256((const __m256i *)(dst + 4 * x));
+        a = _mm256_srl_epi32(sa, ashift);
+        a = _mm256_or_si256(a, _mm256_slli_epi32(a, 8));
+        a = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+        a_lo = _mm256_unpacklo_epi8(a, zero);
+        a_hi = _mm256_unpackhi_epi8(a, zero);
+
+        r_lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(s, zero), _mm256_or_si256(_mm256_andnot_si256(alpha_lane, a_lo), alpha_one));
+        r_hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(s, zero), _mm256_or_si256(_mm256_andnot_si256(alpha_lane, a_hi), alpha_one));
+        a_lo = _mm256_xor_si256(a_lo, _mm256_set1_epi16(0xFF));
+        a_hi = _mm256_xor_si256(a_hi, _mm256_set1_epi16(0xFF));
+        r_lo = _mm256_add_epi16(_mm256_srli_epi16(r_lo, 8), _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), a_lo), 8));
+        r_hi = _mm256_add_epi16(_mm256_srli_epi16(r_hi, 8), _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), a_hi), 8));
+        r = _mm256_packus_epi16(r_lo, r_hi);
+
+        r = _mm256_blendv_epi8(r, s, opaque);
+        _mm256_storeu_si256((__m256i *)(dst + 4 * x), _mm256_blendv_epi8(r, d, transparent));
+    }
+    BlitRGBtoRGBPixelAlphaRowSSE2(src + 4 * x, dst + 4 * x, width - x, info);
+}
+
+static void BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoRGBPixelAlphaRowAVX2);
+}
+
+SDL_TARGETING("avx2") static void BlitRGBtoRGBSurfaceAlphaRowAVX2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    __m128i alpha128, keep128, dsta128;
+    __m256i alpha, keep, dsta;
+    int x;
+
+    GetSurfaceAlphaSSE2(info, &alpha128, &keep128, &dsta128);
+    alpha = _mm256_broadcastsi128_si256(alpha128);
+    keep = _mm256_broadcastsi128_si256(keep128);
+    dsta = _mm256_broadcastsi128_si256(dsta128);
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + 4 * x));
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(dst + 4 * x));
+        const __m256i d_lo = _mm256_unpacklo_epi8(d, zero);
+        const __m256i d_hi = _mm256_unpackhi_epi8(d, zero);
+        __m256i r_lo, r_hi;
+
+        r_lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpacklo_epi8(s, zero), d_lo), alpha), 8);
+        r_hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpackhi_epi8(s, zero), d_hi), alpha), 8);
+        r_lo = _mm256_add_epi8(r_lo, d_lo);
+        r_hi = _mm256_add_epi8(r_hi, d_hi);
+        _mm256_storeu_si256((__m256i *)(dst + 4 * x), _mm256_or_si256(_mm256_and_si256(_mm256_packus_epi16(r_lo, r_hi), keep), dsta));
+    }
+    BlitRGBtoRGBSurfaceAlphaRowSSE2(src + 4 * x, dst + 4 * x, width - x, info);
+}
+
+static void BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoRGBSurfaceAlphaRowAVX2);
+}
+
+SDL_TARGETING("avx2") static void BlitRGBtoRGBPremultipliedRowAVX2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi16(128);
+    const __m256i amask = _mm256_set1_epi32(info->src_fmt->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(info->src_fmt->Ashift);
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + 4 * x));
+        const __m256i sa = _mm256_and_si256(s, amask);
+        __m256i d, ia, ia_lo, ia_hi, r_lo, r_hi;
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(s, zero)) == -1) {
+            continue;
+        } else if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(sa, amask)) == -1) {
+            _mm256_storeu_si256((__m256i *)(dst + 4 * x), s);
+            continue;
+        }
+
+        d = _mm256_loadu_si256((const __m256i *)(dst + 4 * x));
+        ia = _mm256_srl_epi32(sa, ashift);
+        ia = _mm256_or_si256(ia, _mm256_slli_epi32(ia, 8));
+        ia = _mm256_or_si256(ia, _mm256_slli_epi32(ia, 16));
+        ia = _mm256_xor_si256(ia, _mm256_set1_epi32(-1));
+        ia_lo = _mm256_unpacklo_epi8(ia, zero);
+        ia_hi = _mm256_unpackhi_epi8(ia, zero);
+
+        r_lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), ia_lo), round);
+        r_hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), ia_hi), round);
+        r_lo = _mm256_srli_epi16(_mm256_add_epi16(r_lo, _mm256_srli_epi16(r_lo, 8)), 8);
+        r_hi = _mm256_srli_epi16(_mm256_add_epi16(r_hi, _mm256_srli_epi16(r_hi, 8)), 8);
+        _mm256_storeu_si256((__m256i *)(dst + 4 * x), _mm256_adds_epu8(s, _mm256_packus_epi16(r_lo, r_hi)));
+    }
+    BlitRGBtoRGBPremultipliedRowSSE2(src + 4 * x, dst + 4 * x, width - x, info);
+}
+
+static void BlitRGBtoRGBPremultipliedAVX2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoRGBPremultipliedRowAVX2);
+}
+
+SDL_TARGETING("avx2") static __m256i Blend565AVX2(__m256i sr, __m256i sg, __m256i sb, __m256i d, __m256i alpha)
+{
+    const __m256i dr = _mm256_srli_epi16(d, 11);
+    const __m256i dg = _mm256_and_si256(_mm256_srli_epi16(d, 5), _mm256_set1_epi16(0x3F));
+    const __m256i db = _mm256_and_si256(d, _mm256_set1_epi16(0x1F));
+    const __m256i r = _mm256_add_epi16(dr, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(sr, dr), alpha), 5));
+    const __m256i g = _mm256_add_epi16(dg, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(sg, dg), alpha), 5));
+    const __m256i b = _mm256_add_epi16(db, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(sb, db), alpha), 5));
+
+    return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), b);
+}
+
+SDL_TARGETING("avx2") static void Blit565to565SurfaceAlphaRowAVX2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m256i alpha = _mm256_set1_epi16(info->a >> 3);
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + 2 * x));
+        const __m256i d = _mm256_loadu_si256((const __m256i *)(dst + 2 * x));
+        _mm256_storeu_si256((__m256i *)(dst + 2 * x),
+                            Blend565AVX2(_mm256_srli_epi16(s, 11), _mm256_and_si256(_mm256_srli_epi16(s, 5), _mm256_set1_epi16(0x3F)),
+                                         _mm256_and_si256(s, _mm256_set1_epi16(0x1F)), d, alpha));
+    }
+    Blit565to565SurfaceAlphaRowSSE2(src + 2 * x, dst + 2 * x, width - x, info);
+}
+
+static void Blit565to565SurfaceAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, Blit565to565SurfaceAlphaRowAVX2);
+}
+
+SDL_TARGETING("avx2") static void BlitARGBto565PixelAlphaRowAVX2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m256i m5 = _mm256_set1_epi32(0x1F);
+    const __m256i m6 = _mm256_set1_epi32(0x3F);
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        /* Packing works within 128 bit lanes, so pair up pixels 0-3 with 8-11 and 4-7 with 12-15 */
+        const __m256i s0 = _mm256_loadu_si256((const __m256i *)(src + 4 * x));
+        const __m256i s1 = _mm256_loadu_si256((const __m256i *)(src + 4 * x + 32));
+        const __m256i t0 = _mm256_permute2x128_si256(s0, s1, 0x20);
+        const __m256i t1 = _mm256_permute2x128_si256(s0, s1, 0x31);
+        const __m256i sr = _mm256_packs_epi32(_mm256_and_si256(_mm256_srli_epi32(t0, 19), m5), _mm256_and_si256(_mm256_srli_epi32(t1, 19), m5));
+        const __m256i sg = _mm256_packs_epi32(_mm256_and_si256(_mm256_srli_epi32(t0, 10), m6), _mm256_and_si256(_mm256_srli_epi32(t1, 10), m6));
+        const __m256i sb = _mm256_packs_epi32(_mm256_and_si256(_mm256_srli_epi32(t0, 3), m5), _mm256_and_si256(_mm256_srli_epi32(t1, 3), m5));
+        __m256i alpha = _mm256_packs_epi32(_mm256_srli_epi32(t0, 27), _mm256_srli_epi32(t1, 27));
+
+        alpha = _mm256_sub_epi16(alpha, _mm256_cmpeq_epi16(alpha, _mm256_set1_epi16(0x1F)));
+        _mm256_storeu_si256((__m256i *)(dst + 2 * x), Blend565AVX2(sr, sg, sb, _mm256_loadu_si256((const __m256i *)(dst + 2 * x)), alpha));
+    }
+    BlitARGBto565PixelAlphaRowSSE2(src + 4 * x, dst + 2 * x, width - x, info);
+}
+
+static void BlitARGBto565PixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitARGBto565PixelAlphaRowAVX2);
+}
+
+SDL_TARGETING("avx2") static void BlitRGBtoBGRPixelAlphaRowAVX2(const Uint8 *src, Uint8 *dst, int width, const SDL_BlitInfo *info)
+{
+    const __m256i rb_mask = _mm256_set1_epi32(0x00FF00FF);
+    const __m256i g_mask = _mm256_set1_epi32(0x0000FF00);
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        const __m256i s = _mm256_loadu_si256((const __m256i *)(src + 4 * x));
+        const __m256i alpha = _mm256_srli_epi32(s, 24);
+        __m256i d, s1, sg, d1, dg, da, r;
+
+        if (_mm256_testz_si256(s, _mm256_set1_epi32((int)0xFF000000))) {
+            continue;
+        }
+        d = _mm256_loadu_si256((const __m256i *)(dst + 4 * x));
+        s1 = _mm256_and_si256(s, rb_mask);
+        s1 = _mm256_or_si256(_mm256_srli_epi32(s1, 16), _mm256_slli_epi32(s1, 16));
+        sg = _mm256_and_si256(s, g_mask);
+        d1 = _mm256_and_si256(d, rb_mask);
+        dg = _mm256_and_si256(d, g_mask);
+        da = _mm256_srli_epi32(d, 24);
+        d1 = _mm256_and_si256(_mm256_add_epi32(d1, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(s1, d1), alpha), 8)), rb_mask);
+        dg = _mm256_and_si256(_mm256_add_epi32(dg, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(sg, dg), alpha), 8)), g_mask);
+        da = _mm256_add_epi32(alpha, _mm256_srli_epi32(_mm256_mullo_epi32(da, _mm256_xor_si256(alpha, _mm256_set1_epi32(0xFF))), 8));
+        r = _mm256_or_si256(_mm256_or_si256(d1, dg), _mm256_slli_epi32(da, 24));
+
+        r = _mm256_blendv_epi8(r, _mm256_or_si256(_mm256_or_si256(s1, sg), _mm256_set1_epi32((int)0xFF000000)),
+                               _mm256_cmpeq_epi32(alpha, _mm256_set1_epi32(0xFF)));
+        r = _mm256_blendv_epi8(r, d, _mm256_cmpeq_epi32(alpha, _mm256_setzero_si256()));
+        _mm256_storeu_si256((__m256i *)(dst + 4 * x), r);
+    }
+    BlitRGBtoBGRPixelAlphaRowSSE41(src + 4 * x, dst + 4 * x, width - x, info);
+}
+
+static void BlitRGBtoBGRPixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitRowsA(info, BlitRGBtoBGRPixelAlphaRowAVX2);
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
+#endif /* __SSE2__ */
+
 #ifdef SDL_ARM_SIMD_BLITTERS
 void BlitARGBto565PixelAlphaARMSIMDAsm(int32_t w, int32_t h, uint16_t *dst, int32_t dst_stride, uint32_t *src, int32_t src_stride);
 
@@ -589,6 +1160,47 @@ static void BlitRGBtoRGBPixelAlpha(SDL_BlitInfo *info)
     }
 }
 
+/* fast 32 bit premultiplied blending, any byte aligned channel order:
+   dst = src + dst * (255 - srcA) / 255, rounded and saturated like the SSE2 version */
+static void BlitRGBtoRGBPremultiplied(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    Uint32 Ashift = info->src_fmt->Ashift;
+
+    while (height--) {
+        /* *INDENT-OFF* */ /* clang-format off */
+        DUFFS_LOOP4({
+        Uint32 s = *srcp;
+        Uint32 ialpha = ((s >> Ashift) & 0xff) ^ 0xff;
+        if (ialpha == 0) {
+            *dstp = s;
+        } else if (s) {
+            /* two channels at a time, each in its own 16 bit half */
+            Uint32 d = *dstp;
+            Uint32 d1 = (d & 0xff00ff) * ialpha + 0x800080;
+            Uint32 d2 = ((d >> 8) & 0xff00ff) * ialpha + 0x800080;
+            d1 = ((d1 + ((d1 >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+            d2 = ((d2 + ((d2 >> 8) & 0xff00ff)) >> 8) & 0xff00ff;
+            d1 += s & 0xff00ff;
+            d2 += (s >> 8) & 0xff00ff;
+            d1 = (d1 | (((d1 >> 8) & 0x10001) * 0xff)) & 0xff00ff;
+            d2 = (d2 | (((d2 >> 8) & 0x10001) * 0xff)) & 0xff00ff;
+            *dstp = d1 | (d2 << 8);
+        }
+        ++srcp;
+        ++dstp;
+        }, width);
+        /* *INDENT-ON* */ /* clang-format on */
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
 /* fast ARGB888->(A)BGR888 blending with pixel alpha */
 static void BlitRGBtoBGRPixelAlpha(SDL_BlitInfo *info)
 {
@@ -1447,6 +2059,16 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 #endif
             if (sf->BytesPerPixel == 4 && sf->Amask == 0xff000000 && sf->Gmask == 0xff00 && ((sf->Rmask == 0xff && df->Rmask == 0x1f) || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
                 if (df->Gmask == 0x7e0) {
+#ifdef __SSE2__
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitARGBto565PixelAlphaAVX2;
+                    }
+#endif
+                    if (SDL_HasSSE2()) {
+                        return BlitARGBto565PixelAlphaSSE2;
+                    }
+#endif
                     return BlitARGBto565PixelAlpha;
                 } else if (df->Gmask == 0x3e0 && !df->Amask) {
                     return BlitARGBto555PixelAlpha;
@@ -1456,6 +2078,18 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 
         case 4:
             if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#ifdef __SSE2__
+                if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+                    }
+#endif
+                    if (SDL_HasSSE2()) {
+                        return BlitRGBtoRGBPixelAlphaSSE2;
+                    }
+                }
+#endif
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
 #ifdef __3dNOW__
@@ -1485,6 +2119,16 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                 }
             } else if (sf->Rmask == df->Bmask && sf->Gmask == df->Gmask && sf->Bmask == df->Rmask && sf->BytesPerPixel == 4) {
                 if (sf->Amask == 0xff000000) {
+#if defined(__SSE2__) && defined(SDL_AVX2_INTRINSICS)
+                    if (SDL_HasAVX2()) {
+                        return BlitRGBtoBGRPixelAlphaAVX2;
+                    }
+#endif
+#if defined(__SSE2__) && defined(SDL_SSE4_1_INTRINSICS)
+                    if (SDL_HasSSE41()) {
+                        return BlitRGBtoBGRPixelAlphaSSE41;
+                    }
+#endif
                     return BlitRGBtoBGRPixelAlpha;
                 }
             }
@@ -1511,6 +2155,16 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
             case 2:
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
+#ifdef __SSE2__
+#ifdef SDL_AVX2_INTRINSICS
+                        if (SDL_HasAVX2()) {
+                            return Blit565to565SurfaceAlphaAVX2;
+                        }
+#endif
+                        if (SDL_HasSSE2()) {
+                            return Blit565to565SurfaceAlphaSSE2;
+                        }
+#endif
 #ifdef __MMX__
                         if (SDL_HasMMX()) {
                             return Blit565to565SurfaceAlphaMMX;
@@ -1534,6 +2188,18 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 
             case 4:
                 if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#ifdef __SSE2__
+                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0) {
+#ifdef SDL_AVX2_INTRINSICS
+                        if (SDL_HasAVX2()) {
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+                        }
+#endif
+                        if (SDL_HasSSE2()) {
+                            return BlitRGBtoRGBSurfaceAlphaSSE2;
+                        }
+                    }
+#endif
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasMMX()) {
                         return BlitRGBtoRGBSurfaceAlphaMMX;
@@ -1567,6 +2233,24 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
             }
         }
         break;
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        /* Anything else goes through the generic blitter */
+        if (sf->BytesPerPixel == 4 && df->BytesPerPixel == 4 && sf->Amask && sf->Aloss == 0 &&
+            sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask &&
+            sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0) {
+#ifdef __SSE2__
+#ifdef SDL_AVX2_INTRINSICS
+            if (SDL_HasAVX2()) {
+                return BlitRGBtoRGBPremultipliedAVX2;
+            }
+#endif
+            if (SDL_HasSSE2()) {
+                return BlitRGBtoRGBPremultipliedSSE2;
+            }
+#endif
+            return BlitRGBtoRGBPremultiplied;
+        }
+        break;
     }
 
     return NULL;
@@ -45,7 +45,9 @@ enum blit_features
     BLIT_FEATURE_HAS_MMX = 1,
     BLIT_FEATURE_HAS_ALTIVEC = 2,
     BLIT_FEATURE_ALTIVEC_DONT_USE_PREFETCH = 4,
-    BLIT_FEATURE_HAS_ARM_SIMD = 8
+    BLIT_FEATURE_HAS_ARM_SIMD = 8,
+    BLIT_FEATURE_HAS_SSE41 = 16,
+    BLIT_FEATURE_HAS_AVX2 = 32
 };
 
 #ifdef SDL_ALTIVEC_BLITTERS
@@ -908,7 +910,8 @@ static enum blit_features GetBlitFeatures(void)
 #endif
 #else
 /* Feature 1 is has-MMX */
-#define GetBlitFeatures() ((SDL_HasMMX() ? BLIT_FEATURE_HAS_MMX : 0) | (SDL_HasARMSIMD() ? BLIT_FEATURE_HAS_ARM_SIMD : 0))
+#define GetBlitFeatures() ((SDL_HasMMX() ? BLIT_FEATURE_HAS_MMX : 0) | (SDL_HasARMSIMD() ? BLIT_FEATURE_HAS_ARM_SIMD : 0) | \
+                           (SDL_HasSSE41() ? BLIT_FEATURE_HAS_SSE41 : 0) | (SDL_HasAVX2() ? BLIT_FEATURE_HAS_AVX2 : 0))
 #endif
 
 #ifdef SDL_ARM_SIMD_BLITTERS
@@ -3202,6 +3205,306 @@ static void Blit_3or4_to_3or4__inversed_rgb(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+/* The x86 converters work a row at a time. Each row function handles as many
+   whole vectors as it can and converts the pixels left over through a small
+   buffer, so every pixel goes through the same arithmetic. */
+typedef void (*BlitRowFuncN)(const Uint8 *src, Uint8 *dst, int width, const void *data);
+
+static void BlitRowsN(SDL_BlitInfo *info, BlitRowFuncN blit_row, const void *data)
+{
+    const int srcbpp = info->src_fmt->BytesPerPixel;
+    const int dstbpp = info->dst_fmt->BytesPerPixel;
+    int height = info->dst_h;
+    const Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+
+    while (height--) {
+        blit_row(src, dst, info->dst_w, data);
+        src += info->dst_w * srcbpp + info->src_skip;
+        dst += info->dst_w * dstbpp + info->dst_skip;
+    }
+}
+
+/* Any 3 or 4 byte format with 8 bits per channel converts to any other with
+   a single byte shuffle, plus a constant for the alpha byte when it isn't
+   copied. This is the same permutation BlitNtoN() uses. */
+typedef struct
+{
+    Uint8 shuffle[16]; /* source byte for each destination byte of 4 pixels */
+    Uint8 alpha[16];   /* ORed into the shuffled pixels */
+    int srcbpp;
+    int dstbpp;
+} BlitShuffleInfo;
+
+static SDL_bool IsShuffleFormat(const SDL_PixelFormat *fmt)
+{
+    return (fmt->BytesPerPixel == 3 || fmt->BytesPerPixel == 4) &&
+           fmt->Rloss == 0 && fmt->Gloss == 0 && fmt->Bloss == 0 &&
+           (!fmt->Amask || fmt->Aloss == 0);
+}
+
+static void SetupBlitShuffle(SDL_BlitInfo *info, BlitShuffleInfo *ctx)
+{
+    SDL_PixelFormat *srcfmt = info->src_fmt;
+    SDL_PixelFormat *dstfmt = info->dst_fmt;
+    int alpha_channel, p[4], i, j;
+
+    get_permutation(srcfmt, dstfmt, &p[0], &p[1], &p[2], &p[3], &alpha_channel);
+    ctx->srcbpp = srcfmt->BytesPerPixel;
+    ctx->dstbpp = dstfmt->BytesPerPixel;
+    SDL_memset(ctx->shuffle, 0x80, sizeof(ctx->shuffle));
+    SDL_memset(ctx->alpha, 0, sizeof(ctx->alpha));
+    for (i = 0; i < 4; ++i) {
+        for (j = 0; j < ctx->dstbpp; ++j) {
+            if (j == alpha_channel && ctx->dstbpp == 4 && !(srcfmt->Amask && dstfmt->Amask)) {
+                ctx->alpha[i * 4 + j] = dstfmt->Amask ? info->a : 0;
+            } else {
+                ctx->shuffle[i * ctx->dstbpp + j] = (Uint8)(i * ctx->srcbpp + p[j]);
+            }
+        }
+    }
+}
+
+SDL_TARGETING("sse4.1") static SDL_INLINE void StoreShuffledSSE41(Uint8 *dst, __m128i v, int dstbpp)
+{
+    if (dstbpp == 4) {
+        _mm_storeu_si128((__m128i *)dst, v);
+    } else {
+        _mm_storel_epi64((__m128i *)dst, v);
+        *(Uint32 *)(dst + 8) = (Uint32)_mm_extract_epi32(v, 2);
+    }
+}
+
+SDL_TARGETING("sse4.1") static void BlitShuffleRowSSE41(const Uint8 *src, Uint8 *dst, int width, const void *data)
+{
+    const BlitShuffleInfo *ctx = (const BlitShuffleInfo *)data;
+    const __m128i shuffle = _mm_loadu_si128((const __m128i *)ctx->shuffle);
+    const __m128i alpha = _mm_loadu_si128((const __m128i *)ctx->alpha);
+    const int srcbpp = ctx->srcbpp;
+    const int dstbpp = ctx->dstbpp;
+    /* 24-bit sources load 4 bytes past the 4 pixels they convert */
+    const int end = (srcbpp == 3) ? width - 2 : width;
+    int x = 0;
+
+    for (; x + 4 <= end; x += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + x * srcbpp));
+        StoreShuffledSSE41(dst + x * dstbpp, _mm_or_si128(_mm_shuffle_epi8(v, shuffle), alpha), dstbpp);
+    }
+    while (x < width) {
+        const int n = SDL_min(width - x, 4);
+        Uint8 buf[16] = { 0 };
+        SDL_memcpy(buf, src + x * srcbpp, (size_t)n * srcbpp);
+        _mm_storeu_si128((__m128i *)buf, _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)buf), shuffle), alpha));
+        SDL_memcpy(dst + x * dstbpp, buf, (size_t)n * dstbpp);
+        x += n;
+    }
+}
+
+static void Blit_NtoN_SSE41(SDL_BlitInfo *info)
+{
+    BlitShuffleInfo ctx;
+    SetupBlitShuffle(info, &ctx);
+    BlitRowsN(info, BlitShuffleRowSSE41, &ctx);
+}
+
+/* Same arithmetic as RGB888_RGB565() and RGB888_RGB555() on 4 pixels */
+SDL_TARGETING("sse4.1") static SDL_INLINE __m128i RGB888to16SSE41(__m128i p, int green_bits)
+{
+    const __m128i r = _mm_and_si128(_mm_srli_epi32(p, 14 - green_bits), _mm_set1_epi32(0x1F << (5 + green_bits)));
+    const __m128i g = _mm_and_si128(_mm_srli_epi32(p, 11 - green_bits), _mm_set1_epi32(((1 << green_bits) - 1) << 5));
+    const __m128i b = _mm_and_si128(_mm_srli_epi32(p, 3), _mm_set1_epi32(0x1F));
+    return _mm_or_si128(_mm_or_si128(r, g), b);
+}
+
+SDL_TARGETING("sse4.1") static void BlitRGB888to16RowSSE41(const Uint8 *src, Uint8 *dst, int width, const void *data)
+{
+    const int green_bits = 8 - ((const SDL_PixelFormat *)data)->Gloss;
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m128i lo = RGB888to16SSE41(_mm_loadu_si128((const __m128i *)(src + x * 4)), green_bits);
+        const __m128i hi = RGB888to16SSE41(_mm_loadu_si128((const __m128i *)(src + x * 4 + 16)), green_bits);
+        _mm_storeu_si128((__m128i *)(dst + x * 2), _mm_packus_epi32(lo, hi));
+    }
+    if (x < width) {
+        Uint8 buf[32] = { 0 };
+        __m128i lo, hi;
+        SDL_memcpy(buf, src + x * 4, (size_t)(width - x) * 4);
+        lo = RGB888to16SSE41(_mm_loadu_si128((const __m128i *)buf), green_bits);
+        hi = RGB888to16SSE41(_mm_loadu_si128((const __m128i *)(buf + 16)), green_bits);
+        _mm_storeu_si128((__m128i *)buf, _mm_packus_epi32(lo, hi));
+        SDL_memcpy(dst + x * 2, buf, (size_t)(width - x) * 2);
+    }
+}
+
+static void Blit_RGB888_16SSE41(SDL_BlitInfo *info)
+{
+    BlitRowsN(info, BlitRGB888to16RowSSE41, info->dst_fmt);
+}
+
+#if SDL_HAVE_BLIT_N_RGB565
+/* Expands RGB 5-6-5 exactly like the RGB565_*_LUT tables: 5 bit channels
+   scale by 255/31 and green is the sum of its high and low 3 bits scaled
+   separately. The multipliers reproduce the truncating divisions. */
+static void SetupRGB565Shuffle(const SDL_PixelFormat *dstfmt, Uint8 *shuffle)
+{
+    int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        for (j = 0; j < 4; ++j) {
+            Uint8 channel = 3; /* alpha */
+            if (j == dstfmt->Rshift / 8) {
+                channel = 2;
+            } else if (j == dstfmt->Gshift / 8) {
+                channel = 1;
+            } else if (j == dstfmt->Bshift / 8) {
+                channel = 0;
+            }
+            shuffle[i * 4 + j] = (Uint8)(i * 4 + channel);
+        }
+    }
+}
+
+/* 8 pixels of RGB 5-6-5 to 16-bit BG and RA pairs (B in the low byte) */
+#define RGB565_EXPAND(p, bg, ra, PFX, BITS)                                                              \
+    {                                                                                                    \
+        const __m##BITS##i k5 = PFX##_set1_epi16((short)33693);                                          \
+        const __m##BITS##i k6 = PFX##_set1_epi16((short)33110);                                          \
+        const __m##BITS##i r = PFX##_and_si##BITS(PFX##_srli_epi16(p, 7), PFX##_set1_epi16(0x1F0));      \
+        const __m##BITS##i g = PFX##_and_si##BITS(PFX##_srli_epi16(p, 2), PFX##_set1_epi16(0x1F8));      \
+        const __m##BITS##i b = PFX##_and_si##BITS(PFX##_slli_epi16(p, 4), PFX##_set1_epi16(0x1F0));      \
+        bg = PFX##_or_si##BITS(PFX##_mulhi_epu16(b, k5), PFX##_slli_epi16(PFX##_mulhi_epu16(g, k6), 8)); \
+        ra = PFX##_or_si##BITS(PFX##_mulhi_epu16(r, k5), PFX##_set1_epi16((short)0xFF00));               \
+    }
+
+SDL_TARGETING("sse4.1") static void BlitRGB565to32RowSSE41(const Uint8 *src, Uint8 *dst, int width, const void *data)
+{
+    const __m128i shuffle = _mm_loadu_si128((const __m128i *)data);
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)(src + x * 2));
+        __m128i bg, ra;
+        RGB565_EXPAND(p, bg, ra, _mm, 128);
+        _mm_storeu_si128((__m128i *)(dst + x * 4), _mm_shuffle_epi8(_mm_unpacklo_epi16(bg, ra), shuffle));
+        _mm_storeu_si128((__m128i *)(dst + x * 4 + 16), _mm_shuffle_epi8(_mm_unpackhi_epi16(bg, ra), shuffle));
+    }
+    if (x < width) {
+        Uint8 buf[32] = { 0 };
+        __m128i p, bg, ra;
+        SDL_memcpy(buf, src + x * 2, (size_t)(width - x) * 2);
+        p = _mm_loadu_si128((const __m128i *)buf);
+        RGB565_EXPAND(p, bg, ra, _mm, 128);
+        _mm_storeu_si128((__m128i *)buf, _mm_shuffle_epi8(_mm_unpacklo_epi16(bg, ra), shuffle));
+        _mm_storeu_si128((__m128i *)(buf + 16), _mm_shuffle_epi8(_mm_unpackhi_epi16(bg, ra), shuffle));
+        SDL_memcpy(dst + x * 4, buf, (size_t)(width - x) * 4);
+    }
+}
+
+static void Blit_RGB565_32SSE41(SDL_BlitInfo *info)
+{
+    Uint8 shuffle[16];
+    SetupRGB565Shuffle(info->dst_fmt, shuffle);
+    BlitRowsN(info, BlitRGB565to32RowSSE41, shuffle);
+}
+#endif /* SDL_HAVE_BLIT_N_RGB565 */
+
+#ifdef SDL_AVX2_INTRINSICS
+SDL_TARGETING("avx2") static void BlitShuffleRowAVX2(const Uint8 *src, Uint8 *dst, int width, const void *data)
+{
+    const BlitShuffleInfo *ctx = (const BlitShuffleInfo *)data;
+    const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->shuffle));
+    const __m256i alpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->alpha));
+    const int srcbpp = ctx->srcbpp;
+    const int dstbpp = ctx->dstbpp;
+    const int end = (srcbpp == 3) ? width - 2 : width;
+    int x = 0;
+
+    for (; x + 8 <= end; x += 8) {
+        const Uint8 *s = src + x * srcbpp;
+        Uint8 *d = dst + x * dstbpp;
+        __m256i v;
+        if (srcbpp == 4) {
+            v = _mm256_loadu_si256((const __m256i *)s);
+        } else {
+            v = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)s)),
+                                        _mm_loadu_si128((const __m128i *)(s + 12)), 1);
+        }
+        v = _mm256_or_si256(_mm256_shuffle_epi8(v, shuffle), alpha);
+        if (dstbpp == 4) {
+            _mm256_storeu_si256((__m256i *)d, v);
+        } else {
+            StoreShuffledSSE41(d, _mm256_castsi256_si128(v), 3);
+            StoreShuffledSSE41(d + 12, _mm256_extracti128_si256(v, 1), 3);
+        }
+    }
+    BlitShuffleRowSSE41(src + x * srcbpp, dst + x * dstbpp, width - x, data);
+}
+
+static void Blit_NtoN_AVX2(SDL_BlitInfo *info)
+{
+    BlitShuffleInfo ctx;
+    SetupBlitShuffle(info, &ctx);
+    BlitRowsN(info, BlitShuffleRowAVX2, &ctx);
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i RGB888to16AVX2(__m256i p, int green_bits)
+{
+    const __m256i r = _mm256_and_si256(_mm256_srli_epi32(p, 14 - green_bits), _mm256_set1_epi32(0x1F << (5 + green_bits)));
+    const __m256i g = _mm256_and_si256(_mm256_srli_epi32(p, 11 - green_bits), _mm256_set1_epi32(((1 << green_bits) - 1) << 5));
+    const __m256i b = _mm256_and_si256(_mm256_srli_epi32(p, 3), _mm256_set1_epi32(0x1F));
+    return _mm256_or_si256(_mm256_or_si256(r, g), b);
+}
+
+SDL_TARGETING("avx2") static void BlitRGB888to16RowAVX2(const Uint8 *src, Uint8 *dst, int width, const void *data)
+{
+    const int green_bits = 8 - ((const SDL_PixelFormat *)data)->Gloss;
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m256i lo = RGB888to16AVX2(_mm256_loadu_si256((const __m256i *)(src + x * 4)), green_bits);
+        const __m256i hi = RGB888to16AVX2(_mm256_loadu_si256((const __m256i *)(src + x * 4 + 32)), green_bits);
+        /* packus works within each lane, so put the quarters back in order */
+        _mm256_storeu_si256((__m256i *)(dst + x * 2), _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8));
+    }
+    BlitRGB888to16RowSSE41(src + x * 4, dst + x * 2, width - x, data);
+}
+
+static void Blit_RGB888_16AVX2(SDL_BlitInfo *info)
+{
+    BlitRowsN(info, BlitRGB888to16RowAVX2, info->dst_fmt);
+}
+
+#if SDL_HAVE_BLIT_N_RGB565
+SDL_TARGETING("avx2") static void BlitRGB565to32RowAVX2(const Uint8 *src, Uint8 *dst, int width, const void *data)
+{
+    const __m256i shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)data));
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16) {
+        const __m256i p = _mm256_loadu_si256((const __m256i *)(src + x * 2));
+        __m256i bg, ra, lo, hi;
+        RGB565_EXPAND(p, bg, ra, _mm256, 256);
+        /* unpack works within each lane: lo has pixels 0-3 and 8-11 */
+        lo = _mm256_shuffle_epi8(_mm256_unpacklo_epi16(bg, ra), shuffle);
+        hi = _mm256_shuffle_epi8(_mm256_unpackhi_epi16(bg, ra), shuffle);
+        _mm256_storeu_si256((__m256i *)(dst + x * 4), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i *)(dst + x * 4 + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    BlitRGB565to32RowSSE41(src + x * 2, dst + x * 4, width - x, data);
+}
+
+static void Blit_RGB565_32AVX2(SDL_BlitInfo *info)
+{
+    Uint8 shuffle[16];
+    SetupRGB565Shuffle(info->dst_fmt, shuffle);
+    BlitRowsN(info, BlitRGB565to32RowAVX2, shuffle);
+}
+#endif /* SDL_HAVE_BLIT_N_RGB565 */
+#endif /* SDL_AVX2_INTRINSICS */
+#endif /* SDL_SSE4_1_INTRINSICS */
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -3233,6 +3536,26 @@ static const struct blit_table normal_blit_2[] = {
       BLIT_FEATURE_HAS_ARM_SIMD, Blit_RGB444_RGB888ARMSIMD, NO_ALPHA | COPY_ALPHA },
 #endif
 #if SDL_HAVE_BLIT_N_RGB565
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x00FF0000, 0x0000FF00, 0x000000FF,
+      BLIT_FEATURE_HAS_AVX2, Blit_RGB565_32AVX2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x000000FF, 0x0000FF00, 0x00FF0000,
+      BLIT_FEATURE_HAS_AVX2, Blit_RGB565_32AVX2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0xFF000000, 0x00FF0000, 0x0000FF00,
+      BLIT_FEATURE_HAS_AVX2, Blit_RGB565_32AVX2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x0000FF00, 0x00FF0000, 0xFF000000,
+      BLIT_FEATURE_HAS_AVX2, Blit_RGB565_32AVX2, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+#endif
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x00FF0000, 0x0000FF00, 0x000000FF,
+      BLIT_FEATURE_HAS_SSE41, Blit_RGB565_32SSE41, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x000000FF, 0x0000FF00, 0x00FF0000,
+      BLIT_FEATURE_HAS_SSE41, Blit_RGB565_32SSE41, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0xFF000000, 0x00FF0000, 0x0000FF00,
+      BLIT_FEATURE_HAS_SSE41, Blit_RGB565_32SSE41, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+    { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x0000FF00, 0x00FF0000, 0xFF000000,
+      BLIT_FEATURE_HAS_SSE41, Blit_RGB565_32SSE41, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
+#endif
     { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x00FF0000, 0x0000FF00, 0x000000FF,
       0, Blit_RGB565_ARGB8888, NO_ALPHA | COPY_ALPHA | SET_ALPHA },
     { 0x0000F800, 0x000007E0, 0x0000001F, 4, 0x000000FF, 0x0000FF00, 0x00FF0000,
@@ -3327,6 +3650,18 @@ static const struct blit_table normal_blit_4[] = {
 #endif
           SET_ALPHA | COPY_ALPHA },
     /* RGB 888 and RGB 565 */
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x0000F800, 0x000007E0, 0x0000001F,
+      BLIT_FEATURE_HAS_AVX2, Blit_RGB888_16AVX2, NO_ALPHA },
+    { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x00007C00, 0x000003E0, 0x0000001F,
+      BLIT_FEATURE_HAS_AVX2, Blit_RGB888_16AVX2, NO_ALPHA },
+#endif
+    { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x0000F800, 0x000007E0, 0x0000001F,
+      BLIT_FEATURE_HAS_SSE41, Blit_RGB888_16SSE41, NO_ALPHA },
+    { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x00007C00, 0x000003E0, 0x0000001F,
+      BLIT_FEATURE_HAS_SSE41, Blit_RGB888_16SSE41, NO_ALPHA },
+#endif
     { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x0000F800, 0x000007E0, 0x0000001F,
       0, Blit_RGB888_RGB565, NO_ALPHA },
     { 0x00FF0000, 0x0000FF00, 0x000000FF, 2, 0x00007C00, 0x000003E0, 0x0000001F,
@@ -3424,6 +3759,21 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
                     blitfun = BlitNtoNCopyAlpha;
                 }
             }
+#ifdef SDL_SSE4_1_INTRINSICS
+            /* The byte-at-a-time 24 and 32-bit converters are all one shuffle */
+            if ((blitfun == BlitNtoN || blitfun == BlitNtoNCopyAlpha ||
+                 blitfun == Blit_3or4_to_3or4__same_rgb || blitfun == Blit_3or4_to_3or4__inversed_rgb) &&
+                IsShuffleFormat(srcfmt) && IsShuffleFormat(dstfmt)) {
+#ifdef SDL_AVX2_INTRINSICS
+                if (GetBlitFeatures() & BLIT_FEATURE_HAS_AVX2) {
+                    blitfun = Blit_NtoN_AVX2;
+                } else
+#endif
+                if (GetBlitFeatures() & BLIT_FEATURE_HAS_SSE41) {
+                    blitfun = Blit_NtoN_SSE41;
+                }
+            }
+#endif
         }
         return blitfun;
 
@@ -29,6 +29,264 @@
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 
+#ifdef SDL_SSE4_1_INTRINSICS
+
+/* The SSE4.1 and AVX2 blitters shuffle pixels into ARGB8888 byte order, do the
+   same integer math as the C blitters on 16 bit channels, and shuffle the result
+   into the destination order. A pixel order has the byte of R, G, B and A within
+   the pixel in its low to high bytes, with 0xFF for a format without alpha. */
+typedef struct
+{
+    Uint8 src_shuffle[16];
+    Uint8 dst_shuffle[16];
+    Uint8 out_shuffle[16];
+    Uint32 src_alpha;   /* 0xFF alpha for sources without one */
+    Uint16 modulate[8]; /* B, G, R, A factors for two pixels, 255 when not modulating */
+    SDL_bool modulated;
+    int op;             /* the blend mode flags, or -1 for no blending */
+} SDL_BlitAutoSIMD;
+
+typedef void (*SDL_BlitAutoRowFunc)(const Uint32 *src, Uint32 *dst, int n, const SDL_BlitAutoSIMD *ctx);
+
+static void SDL_Blit_Auto_Setup(const SDL_BlitInfo *info, Uint32 src_order, Uint32 dst_order,
+                                SDL_bool modulate, SDL_bool blend, SDL_BlitAutoSIMD *ctx)
+{
+    static const int order_shift[4] = { 16, 8, 0, 24 }; /* B, G, R, A */
+    int i, c;
+
+    for (i = 0; i < 16; ++i) {
+        const int pixel = i & ~3;
+        const Uint8 src_byte = (Uint8)(src_order >> order_shift[i & 3]);
+        const Uint8 dst_byte = (Uint8)(dst_order >> order_shift[i & 3]);
+
+        ctx->src_shuffle[i] = (src_byte == 0xFF) ? 0x80 : (Uint8)(pixel + src_byte);
+        ctx->dst_shuffle[i] = (dst_byte == 0xFF) ? 0x80 : (Uint8)(pixel + dst_byte);
+    }
+    for (i = 0; i < 16; ++i) {
+        const int pixel = i & ~3;
+        ctx->out_shuffle[i] = 0x80;
+        for (c = 0; c < 4; ++c) {
+            if (ctx->dst_shuffle[pixel + c] == i) {
+                ctx->out_shuffle[i] = (Uint8)(pixel + c);
+            }
+        }
+    }
+    ctx->src_alpha = ((src_order >> 24) == 0xFF) ? 0xFF000000 : 0;
+
+    for (i = 0; i < 8; ++i) {
+        ctx->modulate[i] = 255;
+    }
+    if (modulate) {
+        if (info->flags & SDL_COPY_MODULATE_COLOR) {
+            ctx->modulate[0] = ctx->modulate[4] = info->b;
+            ctx->modulate[1] = ctx->modulate[5] = info->g;
+            ctx->modulate[2] = ctx->modulate[6] = info->r;
+        }
+        if (info->flags & SDL_COPY_MODULATE_ALPHA) {
+            ctx->modulate[3] = ctx->modulate[7] = info->a;
+        }
+    }
+    ctx->modulated = modulate;
+    ctx->op = blend ? (info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) : -1;
+}
+
+static void SDL_Blit_Auto_SIMD(SDL_BlitInfo *info, Uint32 src_order, Uint32 dst_order,
+                               SDL_bool modulate, SDL_bool blend, SDL_bool scale, SDL_BlitAutoRowFunc blit_row)
+{
+    SDL_BlitAutoSIMD ctx;
+    const Uint8 *src_row = info->src;
+    Uint8 *dst_row = info->dst;
+    int height = info->dst_h;
+
+    SDL_Blit_Auto_Setup(info, src_order, dst_order, modulate, blend, &ctx);
+
+    if (scale) {
+        /* Same stepping as the C blitters, gathering the source pixels a chunk at a time */
+        Uint32 buffer[64];
+        Uint64 incy = ((Uint64)info->src_h << 16) / info->dst_h;
+        Uint64 incx = ((Uint64)info->src_w << 16) / info->dst_w;
+        Uint64 posy = incy / 2;
+
+        while (height--) {
+            const Uint32 *src = (const Uint32 *)(src_row + (posy >> 16) * info->src_pitch);
+            Uint32 *dst = (Uint32 *)dst_row;
+            Uint64 posx = incx / 2;
+            int n = info->dst_w;
+
+            while (n > 0) {
+                const int count = SDL_min(n, (int)SDL_arraysize(buffer));
+                int i;
+                for (i = 0; i < count; ++i) {
+                    buffer[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                blit_row(buffer, dst, count, &ctx);
+                dst += count;
+                n -= count;
+            }
+            posy += incy;
+            dst_row += info->dst_pitch;
+        }
+    } else {
+        while (height--) {
+            blit_row((const Uint32 *)src_row, (Uint32 *)dst_row, info->dst_w, &ctx);
+            src_row += info->src_pitch;
+            dst_row += info->dst_pitch;
+        }
+    }
+}
+
+/* x / 255 for x <= 255 * 255, the same as the C blitters' integer division */
+#define SDL_BLIT_AUTO_DIV255_SSE41(x) \
+    _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8)
+
+/* Blend the unpacked source and destination channels of two pixels */
+SDL_TARGETING("sse4.1") static SDL_INLINE __m128i SDL_Blit_Auto_Blend_SSE41(__m128i s, __m128i d, int op)
+{
+    const __m128i ff = _mm_set1_epi16(0xFF);
+    const __m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i inv_sa = _mm_sub_epi16(ff, sa);
+    __m128i r;
+
+    if (op == SDL_COPY_BLEND || op == SDL_COPY_ADD) {
+        /* Premultiply the color channels */
+        s = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s, _mm_blend_epi16(sa, ff, 0x88)));
+    }
+    switch (op) {
+    case SDL_COPY_BLEND:
+        return _mm_add_epi16(s, SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(d, inv_sa)));
+    case SDL_COPY_ADD:
+        r = _mm_add_epi16(s, d);
+        break;
+    case SDL_COPY_MOD:
+        r = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s, d));
+        break;
+    case SDL_COPY_MUL:
+        /* s * d + d * (255 - sA) can be past 16 bits, clamped to where the result is 255 */
+        r = _mm_packus_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(s, inv_sa), _mm_unpacklo_epi16(d, d)),
+                             _mm_madd_epi16(_mm_unpackhi_epi16(s, inv_sa), _mm_unpackhi_epi16(d, d)));
+        r = SDL_BLIT_AUTO_DIV255_SSE41(_mm_min_epu16(r, _mm_set1_epi16((short)(255 * 255))));
+        break;
+    default:
+        return d;
+    }
+    /* Only blending changes the destination alpha */
+    return _mm_blend_epi16(r, d, 0x88);
+}
+
+SDL_TARGETING("sse4.1") static __m128i SDL_Blit_Auto_Pixels_SSE41(__m128i s, __m128i d, const SDL_BlitAutoSIMD *ctx)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i s_lo, s_hi, d_lo, d_hi;
+
+    s = _mm_shuffle_epi8(s, _mm_loadu_si128((const __m128i *)ctx->src_shuffle));
+    s = _mm_or_si128(s, _mm_set1_epi32((int)ctx->src_alpha));
+    s_lo = _mm_unpacklo_epi8(s, zero);
+    s_hi = _mm_unpackhi_epi8(s, zero);
+    if (ctx->modulated) {
+        const __m128i modulate = _mm_loadu_si128((const __m128i *)ctx->modulate);
+        s_lo = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s_lo, modulate));
+        s_hi = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s_hi, modulate));
+    }
+    if (ctx->op >= 0) {
+        d = _mm_shuffle_epi8(d, _mm_loadu_si128((const __m128i *)ctx->dst_shuffle));
+        d_lo = _mm_unpacklo_epi8(d, zero);
+        d_hi = _mm_unpackhi_epi8(d, zero);
+        s_lo = SDL_Blit_Auto_Blend_SSE41(s_lo, d_lo, ctx->op);
+        s_hi = SDL_Blit_Auto_Blend_SSE41(s_hi, d_hi, ctx->op);
+    }
+    return _mm_shuffle_epi8(_mm_packus_epi16(s_lo, s_hi), _mm_loadu_si128((const __m128i *)ctx->out_shuffle));
+}
+
+SDL_TARGETING("sse4.1") static void SDL_Blit_Auto_Row_SSE41(const Uint32 *src, Uint32 *dst, int n, const SDL_BlitAutoSIMD *ctx)
+{
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        _mm_storeu_si128((__m128i *)(dst + i), SDL_Blit_Auto_Pixels_SSE41(s, d, ctx));
+    }
+    if (i < n) {
+        Uint32 s[4] = { 0 }, d[4] = { 0 };
+        SDL_memcpy(s, src + i, (n - i) * sizeof(Uint32));
+        SDL_memcpy(d, dst + i, (n - i) * sizeof(Uint32));
+        _mm_storeu_si128((__m128i *)d, SDL_Blit_Auto_Pixels_SSE41(_mm_loadu_si128((const __m128i *)s), _mm_loadu_si128((const __m128i *)d), ctx));
+        SDL_memcpy(dst + i, d, (n - i) * sizeof(Uint32));
+    }
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+
+#define SDL_BLIT_AUTO_DIV255_AVX2(x) \
+    _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8)), 8)
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i SDL_Blit_Auto_Blend_AVX2(__m256i s, __m256i d, int op)
+{
+    const __m256i ff = _mm256_set1_epi16(0xFF);
+    const __m256i sa = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256i inv_sa = _mm256_sub_epi16(ff, sa);
+    __m256i r;
+
+    if (op == SDL_COPY_BLEND || op == SDL_COPY_ADD) {
+        s = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s, _mm256_blend_epi16(sa, ff, 0x88)));
+    }
+    switch (op) {
+    case SDL_COPY_BLEND:
+        return _mm256_add_epi16(s, SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(d, inv_sa)));
+    case SDL_COPY_ADD:
+        r = _mm256_add_epi16(s, d);
+        break;
+    case SDL_COPY_MOD:
+        r = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s, d));
+        break;
+    case SDL_COPY_MUL:
+        r = _mm256_packus_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(s, inv_sa), _mm256_unpacklo_epi16(d, d)),
+                                _mm256_madd_epi16(_mm256_unpackhi_epi16(s, inv_sa), _mm256_unpackhi_epi16(d, d)));
+        r = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_min_epu16(r, _mm256_set1_epi16((short)(255 * 255))));
+        break;
+    default:
+        return d;
+    }
+    return _mm256_blend_epi16(r, d, 0x88);
+}
+
+SDL_TARGETING("avx2") static void SDL_Blit_Auto_Row_AVX2(const Uint32 *src, Uint32 *dst, int n, const SDL_BlitAutoSIMD *ctx)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i src_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->src_shuffle));
+    const __m256i dst_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->dst_shuffle));
+    const __m256i out_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->out_shuffle));
+    const __m256i src_alpha = _mm256_set1_epi32((int)ctx->src_alpha);
+    const __m256i modulate = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->modulate));
+    int i;
+
+    /* 8 pixels at a time, the same way as SDL_Blit_Auto_Pixels_SSE41() */
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i s_lo, s_hi;
+
+        s = _mm256_or_si256(_mm256_shuffle_epi8(s, src_shuffle), src_alpha);
+        s_lo = _mm256_unpacklo_epi8(s, zero);
+        s_hi = _mm256_unpackhi_epi8(s, zero);
+        if (ctx->modulated) {
+            s_lo = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s_lo, modulate));
+            s_hi = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s_hi, modulate));
+        }
+        if (ctx->op >= 0) {
+            const __m256i d = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(dst + i)), dst_shuffle);
+            s_lo = SDL_Blit_Auto_Blend_AVX2(s_lo, _mm256_unpacklo_epi8(d, zero), ctx->op);
+            s_hi = SDL_Blit_Auto_Blend_AVX2(s_hi, _mm256_unpackhi_epi8(d, zero), ctx->op);
+        }
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(_mm256_packus_epi16(s_lo, s_hi), out_shuffle));
+    }
+    SDL_Blit_Auto_Row_SSE41(src + i, dst + i, n - i, ctx);
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
+#endif /* SDL_SSE4_1_INTRINSICS */
+
 static void SDL_Blit_RGB888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint64 srcy, srcx;
@@ -107,6 +365,21 @@ static void SDL_Blit_RGB888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -168,6 +441,21 @@ static void SDL_Blit_RGB888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -199,6 +487,21 @@ static void SDL_Blit_RGB888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -242,6 +545,21 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -309,6 +627,21 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -388,6 +721,21 @@ static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -471,6 +819,21 @@ static void SDL_Blit_RGB888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -532,6 +895,21 @@ static void SDL_Blit_RGB888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -563,6 +941,21 @@ static void SDL_Blit_RGB888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -606,6 +999,21 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -673,6 +1081,21 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -752,6 +1175,21 @@ static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -835,6 +1273,21 @@ static void SDL_Blit_RGB888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -897,6 +1350,21 @@ static void SDL_Blit_RGB888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -930,6 +1398,21 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -975,6 +1458,21 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1043,6 +1541,21 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1123,6 +1636,21 @@ static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -1206,6 +1734,21 @@ static void SDL_Blit_BGR888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1267,6 +1810,21 @@ static void SDL_Blit_BGR888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1298,6 +1856,21 @@ static void SDL_Blit_BGR888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1341,6 +1914,21 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1408,6 +1996,21 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1487,6 +2090,21 @@ static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint64 srcy, srcx;
@@ -1565,6 +2183,21 @@ static void SDL_Blit_BGR888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1626,6 +2259,21 @@ static void SDL_Blit_BGR888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1657,6 +2305,21 @@ static void SDL_Blit_BGR888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1700,6 +2363,21 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1767,6 +2445,21 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1846,6 +2539,21 @@ static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -1931,6 +2639,21 @@ static void SDL_Blit_BGR888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -1993,6 +2716,21 @@ static void SDL_Blit_BGR888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2026,6 +2764,21 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2071,6 +2824,21 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2139,6 +2907,21 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2219,6 +3002,21 @@ static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0xFF020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -2308,6 +3106,21 @@ static void SDL_Blit_ARGB8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2377,6 +3190,21 @@ static void SDL_Blit_ARGB8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2408,6 +3236,21 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2451,6 +3294,21 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2520,6 +3378,21 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2601,6 +3474,21 @@ static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -2692,6 +3580,21 @@ static void SDL_Blit_ARGB8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2761,6 +3664,21 @@ static void SDL_Blit_ARGB8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2792,6 +3710,21 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2835,6 +3768,21 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2904,6 +3852,21 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -2985,6 +3948,21 @@ static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint64 srcy, srcx;
@@ -3072,6 +4050,21 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3142,6 +4135,21 @@ static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3177,6 +4185,21 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3224,6 +4247,21 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3294,6 +4332,21 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3376,6 +4429,21 @@ static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03000102, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -3465,6 +4533,21 @@ static void SDL_Blit_RGBA8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3534,6 +4617,21 @@ static void SDL_Blit_RGBA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3565,6 +4663,21 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3608,6 +4721,21 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3677,6 +4805,21 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3758,6 +4901,21 @@ static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -3849,6 +5007,21 @@ static void SDL_Blit_RGBA8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3918,6 +5091,21 @@ static void SDL_Blit_RGBA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3949,6 +5137,21 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -3992,6 +5195,21 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4061,6 +5279,21 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4142,6 +5375,21 @@ static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -4232,6 +5480,21 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4302,6 +5565,21 @@ static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4337,6 +5615,21 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4384,6 +5677,21 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4454,6 +5762,21 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4536,6 +5859,21 @@ static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00010203, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -4627,6 +5965,21 @@ static void SDL_Blit_ABGR8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4696,6 +6049,21 @@ static void SDL_Blit_ABGR8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4727,6 +6095,21 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4770,6 +6153,21 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4839,6 +6237,21 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -4920,6 +6333,21 @@ static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -5009,6 +6437,21 @@ static void SDL_Blit_ABGR8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5078,6 +6521,21 @@ static void SDL_Blit_ABGR8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5109,6 +6567,21 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5152,6 +6625,21 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5221,6 +6709,21 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5302,6 +6805,21 @@ static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -5394,6 +6912,21 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5464,6 +6997,21 @@ static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5499,6 +7047,21 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5546,6 +7109,21 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5616,6 +7194,21 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5698,6 +7291,21 @@ static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x03020100, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -5789,6 +7397,21 @@ static void SDL_Blit_BGRA8888_RGB888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5858,6 +7481,21 @@ static void SDL_Blit_BGRA8888_RGB888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5889,6 +7527,21 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -5932,6 +7585,21 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6001,6 +7669,21 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6082,6 +7765,21 @@ static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -6171,6 +7869,21 @@ static void SDL_Blit_BGRA8888_BGR888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6240,6 +7953,21 @@ static void SDL_Blit_BGRA8888_BGR888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6271,6 +7999,21 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6314,6 +8057,21 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6383,6 +8141,21 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6464,6 +8237,21 @@ static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0xFF020100, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Scale(SDL_BlitInfo *info)
 {
     Uint32 pixel;
@@ -6556,6 +8344,21 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6626,6 +8429,21 @@ static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_FALSE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6661,6 +8479,21 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6708,6 +8541,21 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_FALSE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6778,6 +8626,21 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_FALSE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
@@ -6860,132 +8723,795 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE41(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_SSE41);
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    SDL_Blit_Auto_SIMD(info, 0x00030201, 0x03000102, SDL_TRUE, SDL_TRUE, SDL_TRUE, SDL_Blit_Auto_Row_AVX2);
+}
+
+#endif
+#endif
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGR888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale },
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_SSE4_1_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE41, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE41 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
 };
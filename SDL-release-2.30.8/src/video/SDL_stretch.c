@@ -22,11 +22,13 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
-#include "SDL_render.h"
+#include "../render/SDL_sysrender.h"
 
-static int SDL_LowerSoftStretchNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
-static int SDL_LowerSoftStretchLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
-static int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
+static int SDL_LowerSoftStretchNearest(const Uint32 *src, int src_w, int src_h, int src_pitch, int bpp, Uint32 *dst, int dst_w, int dst_h, int dst_pitch);
+static int SDL_LowerSoftStretchLinear(const Uint32 *src, const SDL_PixelFormat *format, int bpp, int src_w, int src_h, int src_pitch,
+                                      Uint32 *dst, int dst_w, int dst_h, int dst_pitch);
+static int SDL_LowerSoftStretchFilter(const Uint32 *src, const SDL_PixelFormat *format, int bpp, int src_w, int src_h, int src_pitch,
+                                      Uint32 *dst, int dst_w, int dst_h, int dst_pitch, SDL_ScaleMode scaleMode);
 
 int SDL_SoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
                     SDL_Surface *dst, const SDL_Rect *dstrect)
@@ -40,12 +42,13 @@ int SDL_SoftStretchLinear(SDL_Surface *src, const SDL_Rect *srcrect,
     return SDL_UpperSoftStretch(src, srcrect, dst, dstrect, SDL_ScaleModeLinear);
 }
 
-static int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
-                                SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
+int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
+                         SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
 {
     int ret;
     int src_locked;
     int dst_locked;
+    Uint32 *dst_pixels;
     SDL_Rect full_src;
     SDL_Rect full_dst;
 
@@ -54,7 +57,7 @@ static int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
     }
 
     if (scaleMode != SDL_ScaleModeNearest) {
-        if (src->format->BytesPerPixel != 4 || src->format->format == SDL_PIXELFORMAT_ARGB2101010) {
+        if (src->format->BytesPerPixel < 2 || src->format->format == SDL_PIXELFORMAT_ARGB2101010) {
             return SDL_SetError("Wrong format");
         }
     }
@@ -116,10 +119,19 @@ static int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
         src_locked = 1;
     }
 
-    if (scaleMode == SDL_ScaleModeNearest) {
-        ret = SDL_LowerSoftStretchNearest(src, srcrect, dst, dstrect);
-    } else {
-        ret = SDL_LowerSoftStretchLinear(src, srcrect, dst, dstrect);
+    {
+        const int bpp = dst->format->BytesPerPixel;
+        const Uint32 *src_pixels = (const Uint32 *)((const Uint8 *)src->pixels + srcrect->x * bpp + srcrect->y * src->pitch);
+
+        dst_pixels = (Uint32 *)((Uint8 *)dst->pixels + dstrect->x * bpp + dstrect->y * dst->pitch);
+
+        if (scaleMode == SDL_ScaleModeNearest) {
+            ret = SDL_LowerSoftStretchNearest(src_pixels, srcrect->w, srcrect->h, src->pitch, bpp, dst_pixels, dstrect->w, dstrect->h, dst->pitch);
+        } else if (scaleMode == SDL_ScaleModeBicubic || scaleMode == SDL_ScaleModeLanczos) {
+            ret = SDL_LowerSoftStretchFilter(src_pixels, src->format, bpp, srcrect->w, srcrect->h, src->pitch, dst_pixels, dstrect->w, dstrect->h, dst->pitch, scaleMode);
+        } else {
+            ret = SDL_LowerSoftStretchLinear(src_pixels, src->format, bpp, srcrect->w, srcrect->h, src->pitch, dst_pixels, dstrect->w, dstrect->h, dst->pitch);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -534,6 +546,123 @@ static int scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch,
 }
 #endif
 
+#if defined(HAVE_SSE2_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+#define HAVE_AVX2_INTRINSICS
+
+static SDL_INLINE int hasAVX2(void)
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasAVX2();
+    return val;
+}
+
+/* Same arithmetic as scale_mat_SSE(), 8 destination pixels per iteration */
+SDL_TARGETING("avx2") static int scale_mat_AVX2(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+{
+    /* x0 and x1 of each channel next to each other, for _mm256_madd_epi16() */
+    const __m256i interleave = _mm256_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+                                                0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+    /* After packing, even pixels are in the low lane and odd pixels in the high lane */
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+    BILINEAR___START
+
+    for (i = 0; i < dst_h; i++) {
+        int nb_block8;
+        __m256i v256_frac_h0, v256_frac_h1;
+        __m128i v_frac_h0, v_frac_h1;
+        __m128i zero;
+
+        BILINEAR___HEIGHT
+
+        nb_block8 = middle / 8;
+
+        v256_frac_h0 = _mm256_set1_epi16(frac_h0);
+        v256_frac_h1 = _mm256_set1_epi16(frac_h1);
+        v_frac_h0 = _mm256_castsi256_si128(v256_frac_h0);
+        v_frac_h1 = _mm256_castsi256_si128(v256_frac_h1);
+        zero = _mm_setzero_si128();
+
+        while (left_pad_w--) {
+            INTERPOL_BILINEAR_SSE(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (nb_block8--) {
+            __m256i d[4];
+            __m256i e0, e1;
+            int k;
+
+            for (k = 0; k < 4; k++) {
+                /* Two destination pixels, one per lane */
+                int index_w_0, frac_w_0;
+                int index_w_1, frac_w_1;
+                int weight_0, weight_1;
+                __m128i x_0, x_1;
+                __m256i k0, v_frac_w;
+
+                index_w_0 = 4 * SRC_INDEX(fp_sum_w);
+                frac_w_0 = FRAC(fp_sum_w);
+                fp_sum_w += fp_step_w;
+                index_w_1 = 4 * SRC_INDEX(fp_sum_w);
+                frac_w_1 = FRAC(fp_sum_w);
+                fp_sum_w += fp_step_w;
+
+                x_0 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w_0)),
+                                         _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h0 + index_w_1)));
+                x_1 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w_0)),
+                                         _mm_loadl_epi64((const __m128i *)((const Uint8 *)src_h1 + index_w_1)));
+
+                /* Interpolation vertical */
+                k0 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_cvtepu8_epi16(x_0), v256_frac_h1),
+                                      _mm256_mullo_epi16(_mm256_cvtepu8_epi16(x_1), v256_frac_h0));
+
+                /* Interpolation horizontal */
+                weight_0 = ((Uint32)frac_w_0 << 16) | (FRAC_ONE - frac_w_0);
+                weight_1 = ((Uint32)frac_w_1 << 16) | (FRAC_ONE - frac_w_1);
+                v_frac_w = _mm256_setr_epi32(weight_0, weight_0, weight_0, weight_0, weight_1, weight_1, weight_1, weight_1);
+                k0 = _mm256_madd_epi16(_mm256_shuffle_epi8(k0, interleave), v_frac_w);
+                d[k] = _mm256_srli_epi32(k0, PRECISION * 2);
+            }
+
+            /* Store 8 pixels */
+            e0 = _mm256_packs_epi32(d[0], d[1]);
+            e1 = _mm256_packs_epi32(d[2], d[3]);
+            e0 = _mm256_permutevar8x32_epi32(_mm256_packus_epi16(e0, e1), order);
+            _mm256_storeu_si256((__m256i *)dst, e0);
+            dst += 8;
+        }
+
+        /* Last points */
+        middle &= 0x7;
+        while (middle--) {
+            const Uint32 *s_00_01;
+            const Uint32 *s_10_11;
+            int index_w = 4 * SRC_INDEX(fp_sum_w);
+            int frac_w = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+
+        while (right_pad_w--) {
+            int index_w = 4 * (src_w - 2);
+            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
+            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
+            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst, zero);
+            dst += 1;
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+    }
+    return 0;
+}
+#endif
+
 #if defined(HAVE_NEON_INTRINSICS)
 
 static SDL_INLINE int hasNEON(void)
@@ -796,18 +925,465 @@ static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch
 }
 #endif
 
-int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
-                               SDL_Surface *d, const SDL_Rect *dstrect)
+/* Separable bilinear scaling: each source row that is needed gets scaled horizontally once,
+   keeping 16 bits per channel, then pairs of those rows are blended vertically. Nothing is
+   rounded between the two passes, so the result is the same as scale_mat_SSE(). Rows of
+   16 and 24 bit formats are unpacked to 4 bytes per pixel on the way in and packed again
+   on the way out. */
+typedef struct
+{
+    const Uint8 *src;
+    int src_pitch;
+    const SDL_PixelFormat *format;
+    int bpp;
+    int src_w;
+    int dst_w;
+    int *index_w;     /* first source pixel of each destination column */
+    Uint16 *frac_w;   /* weight of the second source pixel, out of FRAC_ONE */
+    Uint32 *unpacked; /* a source row at 4 bytes per pixel, when it can't be read in place */
+    Uint32 *out_row;  /* a destination row at 4 bytes per pixel, when bpp != 4 */
+    Uint16 *hrows[2]; /* horizontally scaled rows, 4 channels of 16 bits per pixel */
+    int hrow_index[2];
+    int last_slot;
+} stretch_2pass_t;
+
+#if defined(HAVE_SSE2_INTRINSICS)
+static int unpack_row_16_SSE2(const SDL_PixelFormat *format, const Uint16 *src, Uint32 *dst, int count)
+{
+    const __m128i r_mask = _mm_set1_epi16((short)format->Rmask);
+    const __m128i g_mask = _mm_set1_epi16((short)format->Gmask);
+    const __m128i b_mask = _mm_set1_epi16((short)format->Bmask);
+    const __m128i a_mask = _mm_set1_epi16((short)format->Amask);
+    const __m128i r_shift = _mm_cvtsi32_si128(format->Rshift);
+    const __m128i g_shift = _mm_cvtsi32_si128(format->Gshift);
+    const __m128i b_shift = _mm_cvtsi32_si128(format->Bshift);
+    const __m128i a_shift = _mm_cvtsi32_si128(format->Ashift);
+    int x;
+
+    for (x = 0; x + 8 <= count; x += 8) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)(src + x));
+        const __m128i r = _mm_srl_epi16(_mm_and_si128(p, r_mask), r_shift);
+        const __m128i g = _mm_srl_epi16(_mm_and_si128(p, g_mask), g_shift);
+        const __m128i b = _mm_srl_epi16(_mm_and_si128(p, b_mask), b_shift);
+        const __m128i a = _mm_srl_epi16(_mm_and_si128(p, a_mask), a_shift);
+        const __m128i rg = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+        const __m128i ba = _mm_or_si128(b, _mm_slli_epi16(a, 8));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128((__m128i *)(dst + x + 4), _mm_unpackhi_epi16(rg, ba));
+    }
+    return x;
+}
+
+static int pack_row_16_SSE2(const SDL_PixelFormat *format, const Uint32 *src, Uint16 *dst, int count)
+{
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128i r_shift = _mm_cvtsi32_si128(format->Rshift);
+    const __m128i g_shift = _mm_cvtsi32_si128(format->Gshift);
+    const __m128i b_shift = _mm_cvtsi32_si128(format->Bshift);
+    const __m128i a_shift = _mm_cvtsi32_si128(format->Ashift);
+    int x;
+
+    for (x = 0; x + 8 <= count; x += 8) {
+        const __m128i lo = _mm_loadu_si128((const __m128i *)(src + x));
+        const __m128i hi = _mm_loadu_si128((const __m128i *)(src + x + 4));
+        const __m128i r = _mm_packs_epi32(_mm_and_si128(lo, byte_mask), _mm_and_si128(hi, byte_mask));
+        const __m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 8), byte_mask), _mm_and_si128(_mm_srli_epi32(hi, 8), byte_mask));
+        const __m128i b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(lo, 16), byte_mask), _mm_and_si128(_mm_srli_epi32(hi, 16), byte_mask));
+        const __m128i a = _mm_packs_epi32(_mm_srli_epi32(lo, 24), _mm_srli_epi32(hi, 24));
+        __m128i p;
+
+        p = _mm_or_si128(_mm_sll_epi16(r, r_shift), _mm_sll_epi16(g, g_shift));
+        p = _mm_or_si128(p, _mm_sll_epi16(b, b_shift));
+        p = _mm_or_si128(p, _mm_sll_epi16(a, a_shift));
+        _mm_storeu_si128((__m128i *)(dst + x), p);
+    }
+    return x;
+}
+
+/* SDL doesn't have a separate SSSE3 check, so the pshufb path is gated on SSE 4.1 */
+#if defined(SDL_SSE4_1_INTRINSICS)
+#define HAVE_SSE41_INTRINSICS
+
+static SDL_INLINE int hasSSE41(void)
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasSSE41();
+    return val;
+}
+
+SDL_TARGETING("sse4.1") static int unpack_row_24_SSE41(const Uint8 *src, Uint32 *dst, int count)
+{
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    int x;
+
+    /* Each load reads 16 bytes for 4 pixels, so stop before it would pass the end of the row */
+    for (x = 0; x + 6 <= count; x += 4) {
+        const __m128i p = _mm_loadu_si128((const __m128i *)(src + 3 * x));
+        _mm_storeu_si128((__m128i *)(dst + x), _mm_shuffle_epi8(p, shuffle));
+    }
+    return x;
+}
+
+SDL_TARGETING("sse4.1") static int pack_row_24_SSE41(const Uint32 *src, Uint8 *dst, int count)
+{
+    const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    int x;
+
+    for (x = 0; x + 4 <= count; x += 4) {
+        const __m128i p = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + x)), shuffle);
+        const Uint32 last = (Uint32)_mm_extract_epi32(p, 2);
+        _mm_storel_epi64((__m128i *)(dst + 3 * x), p);
+        SDL_memcpy(dst + 3 * x + 8, &last, sizeof(last));
+    }
+    return x;
+}
+#endif
+
+static int hscale_row_SSE2(const Uint8 *src, const int *index_w, const Uint16 *frac_w, Uint16 *dst, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int x;
+
+    for (x = 0; x + 2 <= count; x += 2) {
+        __m128i x_0 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(src + 4 * index_w[x])), zero);
+        __m128i x_1 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(src + 4 * index_w[x + 1])), zero);
+        const int weight_0 = ((int)frac_w[x] << 16) | (FRAC_ONE - frac_w[x]);
+        const int weight_1 = ((int)frac_w[x + 1] << 16) | (FRAC_ONE - frac_w[x + 1]);
+
+        /* x0 and x1 of each channel next to each other, for _mm_madd_epi16() */
+        x_0 = _mm_madd_epi16(_mm_unpacklo_epi16(x_0, _mm_srli_si128(x_0, 8)), _mm_set1_epi32(weight_0));
+        x_1 = _mm_madd_epi16(_mm_unpacklo_epi16(x_1, _mm_srli_si128(x_1, 8)), _mm_set1_epi32(weight_1));
+        _mm_storeu_si128((__m128i *)(dst + 4 * x), _mm_packs_epi32(x_0, x_1));
+    }
+    return x;
+}
+
+static int vscale_row_SSE2(const Uint16 *src_0, const Uint16 *src_1, int frac_h, Uint8 *dst, int count)
+{
+    const __m128i weight = _mm_set1_epi32((frac_h << 16) | (FRAC_ONE - frac_h));
+    int i;
+
+    /* count is in channels, 16 per iteration */
+    for (i = 0; i + 16 <= count; i += 16) {
+        __m128i k[2];
+        int j;
+
+        for (j = 0; j < 2; j++) {
+            const __m128i a = _mm_loadu_si128((const __m128i *)(src_0 + i + 8 * j));
+            const __m128i b = _mm_loadu_si128((const __m128i *)(src_1 + i + 8 * j));
+            const __m128i lo = _mm_srli_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(a, b), weight), PRECISION * 2);
+            const __m128i hi = _mm_srli_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(a, b), weight), PRECISION * 2);
+            k[j] = _mm_packs_epi32(lo, hi);
+        }
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(k[0], k[1]));
+    }
+    return i;
+}
+#endif
+
+#if defined(HAVE_AVX2_INTRINSICS)
+SDL_TARGETING("avx2") static int hscale_row_AVX2(const Uint8 *src, const int *index_w, const Uint16 *frac_w, Uint16 *dst, int count)
+{
+    const __m256i interleave = _mm256_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+                                                0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+    int x;
+
+    for (x = 0; x + 4 <= count; x += 4) {
+        __m256i k[2];
+        int j;
+
+        for (j = 0; j < 2; j++) {
+            /* Destination pixels x + j and x + j + 2, one per lane */
+            const int a = x + j, b = x + j + 2;
+            const int weight_a = ((int)frac_w[a] << 16) | (FRAC_ONE - frac_w[a]);
+            const int weight_b = ((int)frac_w[b] << 16) | (FRAC_ONE - frac_w[b]);
+            const __m128i pixels = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(src + 4 * index_w[a])),
+                                                      _mm_loadl_epi64((const __m128i *)(src + 4 * index_w[b])));
+            const __m256i weight = _mm256_setr_epi32(weight_a, weight_a, weight_a, weight_a, weight_b, weight_b, weight_b, weight_b);
+
+            k[j] = _mm256_madd_epi16(_mm256_shuffle_epi8(_mm256_cvtepu8_epi16(pixels), interleave), weight);
+        }
+        /* Packing within lanes puts pixels x, x + 1 in the low lane and x + 2, x + 3 in the high lane */
+        _mm256_storeu_si256((__m256i *)(dst + 4 * x), _mm256_packs_epi32(k[0], k[1]));
+    }
+    return x;
+}
+
+SDL_TARGETING("avx2") static int vscale_row_AVX2(const Uint16 *src_0, const Uint16 *src_1, int frac_h, Uint8 *dst, int count)
+{
+    const __m256i weight = _mm256_set1_epi32((frac_h << 16) | (FRAC_ONE - frac_h));
+    int i;
+
+    /* count is in channels, 32 per iteration */
+    for (i = 0; i + 32 <= count; i += 32) {
+        __m256i k[2];
+        int j;
+
+        for (j = 0; j < 2; j++) {
+            const __m256i a = _mm256_loadu_si256((const __m256i *)(src_0 + i + 16 * j));
+            const __m256i b = _mm256_loadu_si256((const __m256i *)(src_1 + i + 16 * j));
+            const __m256i lo = _mm256_srli_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), weight), PRECISION * 2);
+            const __m256i hi = _mm256_srli_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), weight), PRECISION * 2);
+            k[j] = _mm256_packs_epi32(lo, hi);
+        }
+        _mm256_storeu_si256((__m256i *)(dst + i),
+                            _mm256_permute4x64_epi64(_mm256_packus_epi16(k[0], k[1]), _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+    return i;
+}
+#endif
+
+static void unpack_row(const SDL_PixelFormat *format, int bpp, const void *src, Uint32 *dst, int count)
+{
+    int x = 0;
+
+    if (bpp == 4) {
+        SDL_memcpy(dst, src, (size_t)count * 4);
+    } else if (bpp == 3) {
+        const Uint8 *src8 = (const Uint8 *)src;
+#if defined(HAVE_SSE41_INTRINSICS)
+        if (hasSSE41()) {
+            x = unpack_row_24_SSE41(src8, dst, count);
+        }
+#endif
+        for (; x < count; x++) {
+            Uint8 *d = (Uint8 *)(dst + x);
+            d[0] = src8[3 * x + 0];
+            d[1] = src8[3 * x + 1];
+            d[2] = src8[3 * x + 2];
+            d[3] = 0;
+        }
+    } else {
+        const Uint16 *src16 = (const Uint16 *)src;
+#if defined(HAVE_SSE2_INTRINSICS)
+        if (hasSSE2()) {
+            x = unpack_row_16_SSE2(format, src16, dst, count);
+        }
+#endif
+        for (; x < count; x++) {
+            const Uint32 p = src16[x];
+            Uint8 *d = (Uint8 *)(dst + x);
+            d[0] = (Uint8)((p & format->Rmask) >> format->Rshift);
+            d[1] = (Uint8)((p & format->Gmask) >> format->Gshift);
+            d[2] = (Uint8)((p & format->Bmask) >> format->Bshift);
+            d[3] = (Uint8)((p & format->Amask) >> format->Ashift);
+        }
+    }
+}
+
+static void pack_row(const SDL_PixelFormat *format, int bpp, const Uint32 *src, void *dst, int count)
+{
+    int x = 0;
+
+    if (bpp == 3) {
+        Uint8 *dst8 = (Uint8 *)dst;
+#if defined(HAVE_SSE41_INTRINSICS)
+        if (hasSSE41()) {
+            x = pack_row_24_SSE41(src, dst8, count);
+        }
+#endif
+        for (; x < count; x++) {
+            const Uint8 *s = (const Uint8 *)(src + x);
+            dst8[3 * x + 0] = s[0];
+            dst8[3 * x + 1] = s[1];
+            dst8[3 * x + 2] = s[2];
+        }
+    } else {
+        Uint16 *dst16 = (Uint16 *)dst;
+#if defined(HAVE_SSE2_INTRINSICS)
+        if (hasSSE2()) {
+            x = pack_row_16_SSE2(format, src, dst16, count);
+        }
+#endif
+        for (; x < count; x++) {
+            const Uint8 *s = (const Uint8 *)(src + x);
+            dst16[x] = (Uint16)(((Uint32)s[0] << format->Rshift) | ((Uint32)s[1] << format->Gshift) |
+                                ((Uint32)s[2] << format->Bshift) | ((Uint32)s[3] << format->Ashift));
+        }
+    }
+}
+
+static const Uint16 *get_hscaled_row(stretch_2pass_t *ctx, int y)
+{
+    const Uint8 *src;
+    Uint16 *dst;
+    int slot;
+    int x = 0;
+
+    if (ctx->hrow_index[0] == y) {
+        slot = 0;
+    } else if (ctx->hrow_index[1] == y) {
+        slot = 1;
+    } else {
+        /* Keep the row fetched last, the other one of the pair needs it */
+        slot = !ctx->last_slot;
+        dst = ctx->hrows[slot];
+
+        src = ctx->src + (size_t)y * ctx->src_pitch;
+        if (ctx->unpacked) {
+            unpack_row(ctx->format, ctx->bpp, src, ctx->unpacked, ctx->src_w);
+            src = (const Uint8 *)ctx->unpacked;
+        }
+
+#if defined(HAVE_AVX2_INTRINSICS)
+        if (hasAVX2()) {
+            x = hscale_row_AVX2(src, ctx->index_w, ctx->frac_w, dst, ctx->dst_w);
+        }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+        if (hasSSE2()) {
+            x += hscale_row_SSE2(src, ctx->index_w + x, ctx->frac_w + x, dst + 4 * x, ctx->dst_w - x);
+        }
+#endif
+        for (; x < ctx->dst_w; x++) {
+            const Uint8 *s = src + 4 * ctx->index_w[x];
+            const int frac_w = ctx->frac_w[x];
+            int c;
+            for (c = 0; c < 4; c++) {
+                dst[4 * x + c] = (Uint16)(s[c] * (FRAC_ONE - frac_w) + s[4 + c] * frac_w);
+            }
+        }
+        ctx->hrow_index[slot] = y;
+    }
+    ctx->last_slot = slot;
+    return ctx->hrows[slot];
+}
+
+static void vscale_row(const Uint16 *src_0, const Uint16 *src_1, int frac_h, Uint8 *dst, int count)
+{
+    int i = 0;
+
+#if defined(HAVE_AVX2_INTRINSICS)
+    if (hasAVX2()) {
+        i = vscale_row_AVX2(src_0, src_1, frac_h, dst, count);
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (hasSSE2()) {
+        i += vscale_row_SSE2(src_0 + i, src_1 + i, frac_h, dst + i, count - i);
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i] = (Uint8)((src_0[i] * (FRAC_ONE - frac_h) + src_1[i] * frac_h) >> (PRECISION * 2));
+    }
+}
+
+static int scale_mat_2pass(const Uint32 *src, const SDL_PixelFormat *format, int bpp, int src_w, int src_h, int src_pitch,
+                           Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+{
+    stretch_2pass_t ctx;
+    Sint64 fp_sum_h, fp_sum_w;
+    int fp_step_h, left_pad_h, right_pad_h;
+    int fp_step_w, left_pad_w, right_pad_w;
+    size_t size;
+    Uint8 *mem;
+    int i;
+
+    get_scaler_datas(src_h, dst_h, &fp_sum_h, &fp_step_h, &left_pad_h, &right_pad_h);
+    get_scaler_datas(src_w, dst_w, &fp_sum_w, &fp_step_w, &left_pad_w, &right_pad_w);
+
+    SDL_zero(ctx);
+    ctx.src = (const Uint8 *)src;
+    ctx.src_pitch = src_pitch;
+    ctx.format = format;
+    ctx.bpp = bpp;
+    ctx.src_w = src_w;
+    ctx.dst_w = dst_w;
+    ctx.hrow_index[0] = -1;
+    ctx.hrow_index[1] = -1;
+
+    /* The unpacked row has a spare pixel, the horizontal pass always reads two */
+    size = (size_t)dst_w * sizeof(int) + (size_t)(src_w + 1) * 4 + (size_t)dst_w * 4;
+    size += (size_t)dst_w * (2 * 4 + 1) * sizeof(Uint16);
+    mem = (Uint8 *)SDL_malloc(size);
+    if (!mem) {
+        return SDL_OutOfMemory();
+    }
+    ctx.index_w = (int *)mem;
+    /* 32 bit rows can be read in place unless they are too short to hold a pair */
+    if (bpp != 4 || src_w < 2) {
+        ctx.unpacked = (Uint32 *)(ctx.index_w + dst_w);
+        ctx.unpacked[src_w] = 0;
+    }
+    if (bpp != 4) {
+        ctx.out_row = (Uint32 *)(ctx.index_w + dst_w) + src_w + 1;
+    }
+    ctx.hrows[0] = (Uint16 *)((Uint32 *)(ctx.index_w + dst_w) + src_w + 1 + dst_w);
+    ctx.hrows[1] = ctx.hrows[0] + 4 * dst_w;
+    ctx.frac_w = ctx.hrows[1] + 4 * dst_w;
+
+    fp_sum_w += left_pad_w * fp_step_w;
+    for (i = 0; i < dst_w; i++) {
+        if (i < left_pad_w) {
+            ctx.index_w[i] = 0;
+            ctx.frac_w[i] = FRAC_ZERO;
+        } else if (i > dst_w - 1 - right_pad_w) {
+            ctx.index_w[i] = SDL_max(src_w - 2, 0);
+            ctx.frac_w[i] = (src_w >= 2) ? FRAC_ONE : FRAC_ZERO;
+        } else {
+            ctx.index_w[i] = SRC_INDEX(fp_sum_w);
+            ctx.frac_w[i] = FRAC(fp_sum_w);
+            fp_sum_w += fp_step_w;
+        }
+    }
+
+    for (i = 0; i < dst_h; i++) {
+        const int no_padding = !(i < left_pad_h || i > dst_h - 1 - right_pad_h);
+        const int index_h = no_padding ? SRC_INDEX(fp_sum_h) : (i < left_pad_h ? 0 : src_h - 1);
+        const int frac_h = no_padding ? FRAC(fp_sum_h) : FRAC_ZERO;
+        const Uint16 *src_h0 = get_hscaled_row(&ctx, index_h);
+        const Uint16 *src_h1 = no_padding ? get_hscaled_row(&ctx, index_h + 1) : src_h0;
+        Uint32 *out = ctx.out_row ? ctx.out_row : dst;
+
+        fp_sum_h += fp_step_h;
+
+        vscale_row(src_h0, src_h1, frac_h, (Uint8 *)out, 4 * dst_w);
+        if (ctx.out_row) {
+            pack_row(ctx.format, ctx.bpp, ctx.out_row, dst, ctx.dst_w);
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_pitch);
+    }
+
+    SDL_free(mem);
+    return 0;
+}
+
+/* Whether scale_mat_2pass() has vector versions of its passes on this CPU */
+static int has_2pass_simd(void)
+{
+#if defined(HAVE_AVX2_INTRINSICS)
+    if (hasAVX2()) {
+        return 1;
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (hasSSE2()) {
+        return 1;
+    }
+#endif
+    return 0;
+}
+
+static int SDL_LowerSoftStretchLinear(const Uint32 *src, const SDL_PixelFormat *format, int bpp, int src_w, int src_h, int src_pitch,
+                                      Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
 {
     int ret = -1;
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
+
+    /* Other formats need their rows unpacked. When scaling up vertically the separable
+       version scales each source row horizontally once instead of once per destination
+       row, which only beats the one pass scalers when its passes are vectorized too. */
+    if (bpp != 4 || (dst_h > src_h && has_2pass_simd())) {
+        return scale_mat_2pass(src, format, bpp, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    }
+
+#if defined(HAVE_AVX2_INTRINSICS)
+    if (ret == -1 && hasAVX2()) {
+        ret = scale_mat_AVX2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    }
+#endif
 
 #if defined(HAVE_NEON_INTRINSICS)
     if (ret == -1 && hasNEON()) {
@@ -828,6 +1404,397 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     return ret;
 }
 
+/* Bicubic and Lanczos scaling. Every destination column and row gets its own set of filter
+   taps, computed up front. When scaling down, the filter is widened by the scale factor so
+   it also averages away the detail that bilinear would alias. Filtering is separable like
+   scale_mat_2pass(): source rows are filtered horizontally into 16 bit rows, then
+   FILTER_TAPS_ALIGN rows at a time are combined vertically. */
+#define FILTER_BITS       14 /* taps are fixed point and sum to 1 << FILTER_BITS */
+#define FILTER_ROW_BITS   6  /* fraction bits kept in the horizontally filtered rows */
+#define FILTER_TAPS_ALIGN 4
+
+typedef struct
+{
+    int taps;      /* a multiple of FILTER_TAPS_ALIGN, unused taps are 0 */
+    int *start;    /* first source pixel of each output */
+    Sint32 *pairs; /* taps of each output, two Sint16 per Sint32 for _mm_madd_epi16() */
+} stretch_filter_t;
+
+static double filter_bicubic(double x)
+{
+    /* Keys' cubic convolution with a = -0.5 (Catmull-Rom) */
+    const double a = -0.5;
+
+    x = SDL_fabs(x);
+    if (x < 1.0) {
+        return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+    } else if (x < 2.0) {
+        return ((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a;
+    }
+    return 0.0;
+}
+
+static double filter_sinc(double x)
+{
+    if (x == 0.0) {
+        return 1.0;
+    }
+    x *= M_PI;
+    return SDL_sin(x) / x;
+}
+
+static double filter_lanczos3(double x)
+{
+    x = SDL_fabs(x);
+    if (x < 3.0) {
+        return filter_sinc(x) * filter_sinc(x / 3.0);
+    }
+    return 0.0;
+}
+
+static int init_filter(stretch_filter_t *filter, SDL_ScaleMode scaleMode, int src_len, int dst_len)
+{
+    double (*kernel)(double) = (scaleMode == SDL_ScaleModeLanczos) ? filter_lanczos3 : filter_bicubic;
+    const double support = (scaleMode == SDL_ScaleModeLanczos) ? 3.0 : 2.0;
+    const double ratio = (double)src_len / dst_len;
+    const double scale = SDL_max(ratio, 1.0);
+    /* Source pixels within the widened support, and the ones that are left after clamping to the edges */
+    const int full_taps = 2 * (int)SDL_ceil(support * scale);
+    const int taps = SDL_min(full_taps, src_len);
+    double *weights;
+    int i, k;
+
+    filter->taps = (taps + FILTER_TAPS_ALIGN - 1) & ~(FILTER_TAPS_ALIGN - 1);
+    filter->start = (int *)SDL_malloc(dst_len * sizeof(int));
+    filter->pairs = (Sint32 *)SDL_calloc((size_t)dst_len * filter->taps / 2, sizeof(Sint32));
+    weights = (double *)SDL_malloc((full_taps + filter->taps) * sizeof(double));
+    if (!filter->start || !filter->pairs || !weights) {
+        SDL_free(weights);
+        return SDL_OutOfMemory();
+    }
+
+    for (i = 0; i < dst_len; i++) {
+        const double center = (i + 0.5) * ratio - 0.5;
+        const int first = (int)SDL_floor(center - support * scale) + 1;
+        const int start = SDL_clamp(first, 0, src_len - taps);
+        double *folded = weights + full_taps;
+        Sint16 coeffs[2];
+        double total = 0.0;
+        int sum = 0, largest = 0;
+
+        for (k = 0; k < full_taps; k++) {
+            weights[k] = kernel((first + k - center) / scale);
+            total += weights[k];
+        }
+
+        /* Taps past the edges of the source use the edge pixels */
+        SDL_memset(folded, 0, filter->taps * sizeof(double));
+        for (k = 0; k < full_taps; k++) {
+            folded[SDL_clamp(first + k, 0, src_len - 1) - start] += weights[k] / total;
+        }
+
+        /* Round to fixed point, putting the rounding error on the largest tap so they still sum to one */
+        for (k = 0; k < filter->taps; k++) {
+            if (SDL_fabs(folded[k]) > SDL_fabs(folded[largest])) {
+                largest = k;
+            }
+            sum += (int)SDL_floor(folded[k] * (1 << FILTER_BITS) + 0.5);
+        }
+        for (k = 0; k < filter->taps; k += 2) {
+            coeffs[0] = (Sint16)SDL_floor(folded[k] * (1 << FILTER_BITS) + 0.5);
+            coeffs[1] = (Sint16)SDL_floor(folded[k + 1] * (1 << FILTER_BITS) + 0.5);
+            if (k == (largest & ~1)) {
+                coeffs[largest & 1] += (Sint16)((1 << FILTER_BITS) - sum);
+            }
+            filter->pairs[(i * filter->taps + k) / 2] = (Sint32)((Uint32)(Uint16)coeffs[0] | ((Uint32)(Uint16)coeffs[1] << 16));
+        }
+        filter->start[i] = start;
+    }
+
+    SDL_free(weights);
+    return 0;
+}
+
+static void free_filter(stretch_filter_t *filter)
+{
+    SDL_free(filter->start);
+    SDL_free(filter->pairs);
+}
+
+#define FILTER_TAP_0(pair) ((Sint16)((pair) & 0xFFFF))
+#define FILTER_TAP_1(pair) ((Sint16)((Uint32)(pair) >> 16))
+
+#if defined(HAVE_SSE2_INTRINSICS)
+static int hfilter_row_SSE2(const Uint8 *src, const stretch_filter_t *filter, Sint16 *dst, int count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << (FILTER_BITS - FILTER_ROW_BITS - 1));
+    int x, t;
+
+    for (x = 0; x < count; x++) {
+        const Uint8 *s = src + 4 * filter->start[x];
+        const Sint32 *pairs = filter->pairs + x * filter->taps / 2;
+        __m128i sum = zero;
+
+        for (t = 0; t < filter->taps; t += 4) {
+            /* 4 source pixels, with each channel's neighbours next to each other for _mm_madd_epi16() */
+            const __m128i p = _mm_loadu_si128((const __m128i *)(s + 4 * t));
+            __m128i p_01 = _mm_unpacklo_epi8(p, zero);
+            __m128i p_23 = _mm_unpackhi_epi8(p, zero);
+            p_01 = _mm_unpacklo_epi16(p_01, _mm_srli_si128(p_01, 8));
+            p_23 = _mm_unpacklo_epi16(p_23, _mm_srli_si128(p_23, 8));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(p_01, _mm_set1_epi32(pairs[t / 2])));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(p_23, _mm_set1_epi32(pairs[t / 2 + 1])));
+        }
+        sum = _mm_srai_epi32(_mm_add_epi32(sum, round), FILTER_BITS - FILTER_ROW_BITS);
+        _mm_storel_epi64((__m128i *)(dst + 4 * x), _mm_packs_epi32(sum, sum));
+    }
+    return x;
+}
+
+static int vfilter_row_SSE2(const Sint16 **rows, const Sint32 *pairs, int taps, Uint8 *dst, int count)
+{
+    const __m128i round = _mm_set1_epi32(1 << (FILTER_BITS + FILTER_ROW_BITS - 1));
+    int i, t;
+
+    /* count is in channels, 8 per iteration */
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m128i lo = _mm_setzero_si128();
+        __m128i hi = _mm_setzero_si128();
+        __m128i k;
+
+        for (t = 0; t < taps; t += 2) {
+            const __m128i a = _mm_loadu_si128((const __m128i *)(rows[t] + i));
+            const __m128i b = _mm_loadu_si128((const __m128i *)(rows[t + 1] + i));
+            const __m128i pair = _mm_set1_epi32(pairs[t / 2]);
+            lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), pair));
+            hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), pair));
+        }
+        lo = _mm_srai_epi32(_mm_add_epi32(lo, round), FILTER_BITS + FILTER_ROW_BITS);
+        hi = _mm_srai_epi32(_mm_add_epi32(hi, round), FILTER_BITS + FILTER_ROW_BITS);
+        k = _mm_packs_epi32(lo, hi);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(k, k));
+    }
+    return i;
+}
+#endif
+
+#if defined(HAVE_AVX2_INTRINSICS)
+SDL_TARGETING("avx2") static int hfilter_row_AVX2(const Uint8 *src, const stretch_filter_t *filter, Sint16 *dst, int count)
+{
+    const __m256i interleave = _mm256_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+                                                0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+    /* The first pair of taps for the low lane, the second for the high lane */
+    const __m256i spread = _mm256_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1);
+    const __m128i round = _mm_set1_epi32(1 << (FILTER_BITS - FILTER_ROW_BITS - 1));
+    int x, t;
+
+    for (x = 0; x < count; x++) {
+        const Uint8 *s = src + 4 * filter->start[x];
+        const Sint32 *pairs = filter->pairs + x * filter->taps / 2;
+        __m256i sum256 = _mm256_setzero_si256();
+        __m128i sum;
+
+        for (t = 0; t < filter->taps; t += 4) {
+            const __m256i p = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(s + 4 * t)));
+            const __m256i c = _mm256_permutevar8x32_epi32(_mm256_castsi128_si256(_mm_loadl_epi64((const __m128i *)(pairs + t / 2))), spread);
+            sum256 = _mm256_add_epi32(sum256, _mm256_madd_epi16(_mm256_shuffle_epi8(p, interleave), c));
+        }
+        sum = _mm_add_epi32(_mm256_castsi256_si128(sum256), _mm256_extracti128_si256(sum256, 1));
+        sum = _mm_srai_epi32(_mm_add_epi32(sum, round), FILTER_BITS - FILTER_ROW_BITS);
+        _mm_storel_epi64((__m128i *)(dst + 4 * x), _mm_packs_epi32(sum, sum));
+    }
+    return x;
+}
+
+SDL_TARGETING("avx2") static int vfilter_row_AVX2(const Sint16 **rows, const Sint32 *pairs, int taps, Uint8 *dst, int count)
+{
+    const __m256i round = _mm256_set1_epi32(1 << (FILTER_BITS + FILTER_ROW_BITS - 1));
+    int i, t;
+
+    /* count is in channels, 16 per iteration */
+    for (i = 0; i + 16 <= count; i += 16) {
+        __m256i lo = _mm256_setzero_si256();
+        __m256i hi = _mm256_setzero_si256();
+        __m256i k;
+
+        for (t = 0; t < taps; t += 2) {
+            const __m256i a = _mm256_loadu_si256((const __m256i *)(rows[t] + i));
+            const __m256i b = _mm256_loadu_si256((const __m256i *)(rows[t + 1] + i));
+            const __m256i pair = _mm256_set1_epi32(pairs[t / 2]);
+            lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), pair));
+            hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), pair));
+        }
+        lo = _mm256_srai_epi32(_mm256_add_epi32(lo, round), FILTER_BITS + FILTER_ROW_BITS);
+        hi = _mm256_srai_epi32(_mm256_add_epi32(hi, round), FILTER_BITS + FILTER_ROW_BITS);
+        /* Packing within lanes keeps the channels in order, then the low half of each lane holds the bytes */
+        k = _mm256_packs_epi32(lo, hi);
+        k = _mm256_permute4x64_epi64(_mm256_packus_epi16(k, k), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128((__m128i *)(dst + i), _mm256_castsi256_si128(k));
+    }
+    return i;
+}
+#endif
+
+static void hfilter_row(const Uint8 *src, const stretch_filter_t *filter, Sint16 *dst, int count)
+{
+    int x = 0;
+
+#if defined(HAVE_AVX2_INTRINSICS)
+    if (hasAVX2()) {
+        x = hfilter_row_AVX2(src, filter, dst, count);
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (x == 0 && hasSSE2()) {
+        x = hfilter_row_SSE2(src, filter, dst, count);
+    }
+#endif
+    for (; x < count; x++) {
+        const Uint8 *s = src + 4 * filter->start[x];
+        const Sint32 *pairs = filter->pairs + x * filter->taps / 2;
+        int c, t;
+
+        for (c = 0; c < 4; c++) {
+            Sint32 sum = 1 << (FILTER_BITS - FILTER_ROW_BITS - 1);
+            for (t = 0; t < filter->taps; t += 2) {
+                sum += s[4 * t + c] * FILTER_TAP_0(pairs[t / 2]) + s[4 * t + 4 + c] * FILTER_TAP_1(pairs[t / 2]);
+            }
+            sum >>= FILTER_BITS - FILTER_ROW_BITS;
+            dst[4 * x + c] = (Sint16)SDL_clamp(sum, SDL_MIN_SINT16, SDL_MAX_SINT16);
+        }
+    }
+}
+
+static void vfilter_row(const Sint16 **rows, const Sint32 *pairs, int taps, Uint8 *dst, int count)
+{
+    int i = 0;
+
+#if defined(HAVE_AVX2_INTRINSICS)
+    if (hasAVX2()) {
+        i = vfilter_row_AVX2(rows, pairs, taps, dst, count);
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (hasSSE2()) {
+        const Sint16 *offset_rows[64];
+        /* Finish the tail with rows starting where the wider version stopped */
+        if (i == 0) {
+            i = vfilter_row_SSE2(rows, pairs, taps, dst, count);
+        } else if (taps <= (int)SDL_arraysize(offset_rows)) {
+            int t;
+            for (t = 0; t < taps; t++) {
+                offset_rows[t] = rows[t] + i;
+            }
+            i += vfilter_row_SSE2(offset_rows, pairs, taps, dst + i, count - i);
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        Sint32 sum = 1 << (FILTER_BITS + FILTER_ROW_BITS - 1);
+        int t;
+
+        for (t = 0; t < taps; t += 2) {
+            sum += rows[t][i] * FILTER_TAP_0(pairs[t / 2]) + rows[t + 1][i] * FILTER_TAP_1(pairs[t / 2]);
+        }
+        sum >>= FILTER_BITS + FILTER_ROW_BITS;
+        dst[i] = (Uint8)SDL_clamp(sum, 0, 255);
+    }
+}
+
+static int SDL_LowerSoftStretchFilter(const Uint32 *src, const SDL_PixelFormat *format, int bpp, int src_w, int src_h, int src_pitch,
+                                      Uint32 *dst, int dst_w, int dst_h, int dst_pitch, SDL_ScaleMode scaleMode)
+{
+    stretch_filter_t filter_w, filter_h;
+    stretch_filter_t filter_tail; /* the columns of filter_w from in_place on */
+    Uint32 *unpacked = NULL;   /* a source row at 4 bytes per pixel, with room for the last taps */
+    Uint32 *out_row = NULL;    /* a destination row at 4 bytes per pixel, when bpp != 4 */
+    Sint16 *hrows = NULL;      /* filter_h.taps horizontally filtered rows, row y in slot y % taps */
+    int *hrow_index = NULL;
+    const Sint16 **vrows = NULL;
+    const size_t hrow_len = (size_t)dst_w * 4;
+    int unpacked_w, in_place, tail_start, i, t;
+    int ret = -1;
+
+    SDL_zero(filter_w);
+    SDL_zero(filter_h);
+    if (init_filter(&filter_w, scaleMode, src_w, dst_w) < 0 ||
+        init_filter(&filter_h, scaleMode, src_h, dst_h) < 0) {
+        goto done;
+    }
+
+    /* 32 bit rows are filtered where they are, except for the columns whose aligned taps
+       reach past the end of the row. Those read a copy of the end of the row instead. */
+    in_place = 0;
+    if (bpp == 4) {
+        while (in_place < dst_w && filter_w.start[in_place] + filter_w.taps <= src_w) {
+            in_place++;
+        }
+    }
+    tail_start = (in_place < dst_w) ? filter_w.start[in_place] : src_w;
+    filter_tail = filter_w;
+    filter_tail.start += in_place;
+    filter_tail.pairs += in_place * filter_w.taps / 2;
+
+    unpacked_w = SDL_max(src_w, filter_w.taps) + FILTER_TAPS_ALIGN;
+    unpacked = (Uint32 *)SDL_calloc(unpacked_w, sizeof(Uint32));
+    hrows = (Sint16 *)SDL_malloc(filter_h.taps * hrow_len * sizeof(Sint16));
+    hrow_index = (int *)SDL_malloc(filter_h.taps * sizeof(int));
+    vrows = (const Sint16 **)SDL_malloc(filter_h.taps * sizeof(*vrows));
+    if (bpp != 4) {
+        out_row = (Uint32 *)SDL_malloc(dst_w * sizeof(Uint32));
+    }
+    if (!unpacked || !hrows || !hrow_index || !vrows || (bpp != 4 && !out_row)) {
+        SDL_OutOfMemory();
+        goto done;
+    }
+    for (t = 0; t < filter_h.taps; t++) {
+        hrow_index[t] = -1;
+    }
+
+    for (i = 0; i < dst_h; i++) {
+        const int start = filter_h.start[i];
+        Uint32 *out = out_row ? out_row : dst;
+
+        for (t = 0; t < filter_h.taps; t++) {
+            /* Unused taps past the bottom have a weight of 0, any row will do */
+            const int y = SDL_min(start + t, src_h - 1);
+            Sint16 *hrow = hrows + (y % filter_h.taps) * hrow_len;
+
+            if (hrow_index[y % filter_h.taps] != y) {
+                const Uint32 *src_row = (const Uint32 *)((const Uint8 *)src + (size_t)y * src_pitch);
+
+                if (bpp == 4) {
+                    hfilter_row((const Uint8 *)src_row, &filter_w, hrow, in_place);
+                    SDL_memcpy(unpacked + tail_start, src_row + tail_start, (size_t)(src_w - tail_start) * 4);
+                } else {
+                    unpack_row(format, bpp, src_row, unpacked, src_w);
+                }
+                hfilter_row((const Uint8 *)unpacked, &filter_tail, hrow + 4 * in_place, dst_w - in_place);
+                hrow_index[y % filter_h.taps] = y;
+            }
+            vrows[t] = hrow;
+        }
+
+        vfilter_row(vrows, filter_h.pairs + i * filter_h.taps / 2, filter_h.taps, (Uint8 *)out, 4 * dst_w);
+        if (out_row) {
+            pack_row(format, bpp, out_row, dst, dst_w);
+        }
+        dst = (Uint32 *)((Uint8 *)dst + dst_pitch);
+    }
+    ret = 0;
+
+done:
+    free_filter(&filter_w);
+    free_filter(&filter_h);
+    SDL_free(unpacked);
+    SDL_free(out_row);
+    SDL_free(hrows);
+    SDL_free(hrow_index);
+    SDL_free(vrows);
+    return ret;
+}
+
 #define SDL_SCALE_NEAREST__START          \
     int i;                                \
     Uint64 posy, incy;                    \
@@ -929,21 +1896,8 @@ static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int
     return 0;
 }
 
-int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
-                                SDL_Surface *d, const SDL_Rect *dstrect)
+static int SDL_LowerSoftStretchNearest(const Uint32 *src, int src_w, int src_h, int src_pitch, int bpp, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
 {
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
-
-    const int bpp = d->format->BytesPerPixel;
-
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
-
     if (bpp == 4) {
         return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
     } else if (bpp == 3) {
@@ -353,6 +353,7 @@ struct SDL_VideoDevice
     SDL_threadID thread;
     SDL_bool checked_texture_framebuffer;
     SDL_bool is_dummy;
+    SDL_bool no_texture_framebuffer; /* window surfaces must stay in the driver's own framebuffer */
     SDL_bool suspend_screensaver;
     SDL_Window *wakeup_window;
     SDL_mutex *wakeup_lock; /* Initialized only if WaitEventTimeout/SendWakeupEvent are supported */
@@ -2660,6 +2660,11 @@ static SDL_bool ShouldAttemptTextureFramebuffer(void)
         return SDL_FALSE;
     }
 
+    /* The driver needs to see the pixels of every frame */
+    if (_this->no_texture_framebuffer) {
+        return SDL_FALSE;
+    }
+
     /* See if there's a hint override */
     hint = SDL_GetHint(SDL_HINT_FRAMEBUFFER_ACCELERATION);
     if (hint && *hint) {
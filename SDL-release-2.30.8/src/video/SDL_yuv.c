@@ -24,6 +24,8 @@
 #include "SDL_video.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "SDL_hints.h"
+#include "../thread/SDL_systhread.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
@@ -305,6 +307,115 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
     return 0;
 }
 
+static SDL_bool yuv_rgb_avx2(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (!SDL_HasAVX2()) {
+        return SDL_FALSE;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static SDL_bool yuv_rgb_sse(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height,
@@ -559,6 +670,329 @@ static SDL_bool yuv_rgb_std(
     return SDL_FALSE;
 }
 
+static SDL_bool yuv_rgb_convert(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (yuv_rgb_avx2(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+
+    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+
+    if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+
+    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
+/* Formats handled by yuv_rgb_std(), and so by yuv_rgb_convert(), for every YUV format */
+static SDL_bool IsYUVToRGBDirectFormat(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB565:
+    case SDL_PIXELFORMAT_RGB24:
+    case SDL_PIXELFORMAT_RGBX8888:
+    case SDL_PIXELFORMAT_RGBA8888:
+    case SDL_PIXELFORMAT_BGRX8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+    case SDL_PIXELFORMAT_RGB888:
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_BGR888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* A band of rows converted by one thread */
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    Uint32 width;
+    Uint32 height;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+    Uint8 *last_row; /* two rows of scratch space, or NULL */
+    Uint32 last_row_pitch;
+} SDL_YUVSlice;
+
+/* Bands smaller than this aren't worth the synchronization */
+#define SDL_YUV_MIN_SLICE_ROWS 64
+#define SDL_YUV_MAX_THREADS    16
+
+/* Persistent worker threads, owned by one conversion at a time */
+static struct
+{
+    SDL_SpinLock owner_lock;
+    SDL_bool owned;
+    SDL_mutex *lock;
+    SDL_cond *work_ready;
+    SDL_cond *work_done;
+    SDL_Thread *threads[SDL_YUV_MAX_THREADS - 1];
+    int num_threads;
+    SDL_bool quit;
+    const SDL_YUVSlice *slices;
+    int num_slices;
+    int next_slice;
+    int slices_left;
+} SDL_YUV_pool;
+
+static void RunYUVSlice(const SDL_YUVSlice *slice)
+{
+    yuv_rgb_convert(slice->src_format, slice->dst_format, slice->width, slice->height,
+                    slice->y, slice->u, slice->v, slice->y_stride, slice->uv_stride,
+                    slice->rgb, slice->rgb_stride, slice->yuv_type);
+
+    if (slice->last_row) {
+        /* The SIMD 4:2:2 kernels convert the last row of an image with the C
+           code, which rounds differently. That row isn't the last one of the
+           whole image, so convert it again followed by the first row of the
+           next band, the way the single threaded conversion sees it. */
+        const Uint32 row = slice->height - 1;
+
+        yuv_rgb_convert(slice->src_format, slice->dst_format, slice->width, 2,
+                        slice->y + row * slice->y_stride, slice->u + row * slice->uv_stride, slice->v + row * slice->uv_stride,
+                        slice->y_stride, slice->uv_stride,
+                        slice->last_row, slice->last_row_pitch, slice->yuv_type);
+        SDL_memcpy(slice->rgb + row * slice->rgb_stride, slice->last_row, slice->last_row_pitch);
+    }
+}
+
+static int SDLCALL SDL_YUVConversionThread(void *data)
+{
+    SDL_LockMutex(SDL_YUV_pool.lock);
+    while (!SDL_YUV_pool.quit) {
+        if (SDL_YUV_pool.next_slice < SDL_YUV_pool.num_slices) {
+            const SDL_YUVSlice *slice = &SDL_YUV_pool.slices[SDL_YUV_pool.next_slice++];
+
+            SDL_UnlockMutex(SDL_YUV_pool.lock);
+            RunYUVSlice(slice);
+            SDL_LockMutex(SDL_YUV_pool.lock);
+
+            if (--SDL_YUV_pool.slices_left == 0) {
+                SDL_CondSignal(SDL_YUV_pool.work_done);
+            }
+        } else {
+            SDL_CondWait(SDL_YUV_pool.work_ready, SDL_YUV_pool.lock);
+        }
+    }
+    SDL_UnlockMutex(SDL_YUV_pool.lock);
+    return 0;
+}
+
+/* Called by the pool owner, grows the pool up to num_threads workers */
+static void StartYUVConversionThreads(int num_threads)
+{
+    if (!SDL_YUV_pool.lock) {
+        SDL_YUV_pool.lock = SDL_CreateMutex();
+        SDL_YUV_pool.work_ready = SDL_CreateCond();
+        SDL_YUV_pool.work_done = SDL_CreateCond();
+        if (!SDL_YUV_pool.lock || !SDL_YUV_pool.work_ready || !SDL_YUV_pool.work_done) {
+            SDL_DestroyCond(SDL_YUV_pool.work_done);
+            SDL_DestroyCond(SDL_YUV_pool.work_ready);
+            SDL_DestroyMutex(SDL_YUV_pool.lock);
+            SDL_YUV_pool.work_done = NULL;
+            SDL_YUV_pool.work_ready = NULL;
+            SDL_YUV_pool.lock = NULL;
+            return;
+        }
+    }
+
+    while (SDL_YUV_pool.num_threads < num_threads) {
+        SDL_Thread *thread = SDL_CreateThreadInternal(SDL_YUVConversionThread, "SDLYUVConvert", 0, NULL);
+        if (!thread) {
+            /* Run with the threads we have, the calling thread converts too */
+            break;
+        }
+        SDL_YUV_pool.threads[SDL_YUV_pool.num_threads++] = thread;
+    }
+}
+
+/* SDL_HINT_YUV_CONVERSION_THREADS, watched from the first threaded conversion until SDL_Quit */
+static SDL_SpinLock SDL_YUV_threads_hint_lock;
+static SDL_bool SDL_YUV_threads_hint_watched;
+static SDL_atomic_t SDL_YUV_threads_hint_count;
+
+static void SDLCALL SDL_YUVConversionThreadsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    int num_threads = 1;
+
+    if (hint && *hint) {
+        num_threads = SDL_atoi(hint);
+        if (num_threads < 0) {
+            num_threads = SDL_GetCPUCount();
+        }
+    }
+    SDL_AtomicSet(&SDL_YUV_threads_hint_count, SDL_clamp(num_threads, 1, SDL_YUV_MAX_THREADS));
+}
+
+static int GetYUVConversionThreadCount(void)
+{
+    SDL_AtomicLock(&SDL_YUV_threads_hint_lock);
+    if (!SDL_YUV_threads_hint_watched) {
+        SDL_AddHintCallback(SDL_HINT_YUV_CONVERSION_THREADS, SDL_YUVConversionThreadsChanged, NULL);
+        SDL_YUV_threads_hint_watched = SDL_TRUE;
+    }
+    SDL_AtomicUnlock(&SDL_YUV_threads_hint_lock);
+    return SDL_AtomicGet(&SDL_YUV_threads_hint_count);
+}
+
+static SDL_bool yuv_rgb_threaded(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    SDL_YUVSlice slices[SDL_YUV_MAX_THREADS];
+    int num_slices;
+    Uint32 rows_per_slice, row;
+    Uint8 *last_rows = NULL;
+    Uint32 last_row_pitch = 0;
+    int i;
+
+    num_slices = SDL_min(GetYUVConversionThreadCount(), (int)(height / SDL_YUV_MIN_SLICE_ROWS));
+    if (num_slices <= 1 || !IsYUVToRGBDirectFormat(dst_format)) {
+        return SDL_FALSE;
+    }
+
+    if (IsPacked4Format(src_format)) {
+        last_row_pitch = width * SDL_BYTESPERPIXEL(dst_format);
+        last_rows = (Uint8 *)SDL_malloc((size_t)last_row_pitch * 2 * num_slices);
+        if (!last_rows) {
+            return SDL_FALSE;
+        }
+    }
+
+    /* Only one conversion uses the pool at a time, others run serially */
+    SDL_AtomicLock(&SDL_YUV_pool.owner_lock);
+    if (SDL_YUV_pool.owned) {
+        SDL_AtomicUnlock(&SDL_YUV_pool.owner_lock);
+        SDL_free(last_rows);
+        return SDL_FALSE;
+    }
+    SDL_YUV_pool.owned = SDL_TRUE;
+    SDL_AtomicUnlock(&SDL_YUV_pool.owner_lock);
+
+    StartYUVConversionThreads(num_slices - 1);
+    if (!SDL_YUV_pool.lock) {
+        SDL_AtomicLock(&SDL_YUV_pool.owner_lock);
+        SDL_YUV_pool.owned = SDL_FALSE;
+        SDL_AtomicUnlock(&SDL_YUV_pool.owner_lock);
+        SDL_free(last_rows);
+        return SDL_FALSE;
+    }
+
+    /* Band boundaries fall on even rows so 4:2:0 chroma rows aren't shared */
+    rows_per_slice = (height / num_slices) & ~1;
+    row = 0;
+    for (i = 0; i < num_slices; ++i) {
+        SDL_YUVSlice *slice = &slices[i];
+        Uint32 uv_row = IsPlanar2x2Format(src_format) ? (row / 2) : row;
+
+        slice->src_format = src_format;
+        slice->dst_format = dst_format;
+        slice->width = width;
+        slice->height = (i == num_slices - 1) ? (height - row) : rows_per_slice;
+        slice->y = y + row * y_stride;
+        slice->u = u + uv_row * uv_stride;
+        slice->v = v + uv_row * uv_stride;
+        slice->y_stride = y_stride;
+        slice->uv_stride = uv_stride;
+        slice->rgb = rgb + row * rgb_stride;
+        slice->rgb_stride = rgb_stride;
+        slice->yuv_type = yuv_type;
+        if (last_rows && i < num_slices - 1) {
+            slice->last_row = last_rows + (size_t)last_row_pitch * 2 * i;
+            slice->last_row_pitch = last_row_pitch;
+        } else {
+            slice->last_row = NULL;
+            slice->last_row_pitch = 0;
+        }
+        row += slice->height;
+    }
+
+    SDL_LockMutex(SDL_YUV_pool.lock);
+    SDL_YUV_pool.slices = slices;
+    SDL_YUV_pool.num_slices = num_slices;
+    SDL_YUV_pool.next_slice = 0;
+    SDL_YUV_pool.slices_left = num_slices;
+    SDL_CondBroadcast(SDL_YUV_pool.work_ready);
+
+    /* The calling thread takes bands too, so this completes even without workers */
+    while (SDL_YUV_pool.next_slice < SDL_YUV_pool.num_slices) {
+        const SDL_YUVSlice *slice = &SDL_YUV_pool.slices[SDL_YUV_pool.next_slice++];
+
+        SDL_UnlockMutex(SDL_YUV_pool.lock);
+        RunYUVSlice(slice);
+        SDL_LockMutex(SDL_YUV_pool.lock);
+
+        --SDL_YUV_pool.slices_left;
+    }
+    while (SDL_YUV_pool.slices_left > 0) {
+        SDL_CondWait(SDL_YUV_pool.work_done, SDL_YUV_pool.lock);
+    }
+    SDL_YUV_pool.slices = NULL;
+    SDL_YUV_pool.num_slices = 0;
+    SDL_YUV_pool.next_slice = 0;
+    SDL_UnlockMutex(SDL_YUV_pool.lock);
+
+    SDL_AtomicLock(&SDL_YUV_pool.owner_lock);
+    SDL_YUV_pool.owned = SDL_FALSE;
+    SDL_AtomicUnlock(&SDL_YUV_pool.owner_lock);
+
+    SDL_free(last_rows);
+    return SDL_TRUE;
+}
+
+void SDL_QuitYUVConversionThreads(void)
+{
+    int i;
+
+    SDL_AtomicLock(&SDL_YUV_threads_hint_lock);
+    if (SDL_YUV_threads_hint_watched) {
+        SDL_DelHintCallback(SDL_HINT_YUV_CONVERSION_THREADS, SDL_YUVConversionThreadsChanged, NULL);
+        SDL_YUV_threads_hint_watched = SDL_FALSE;
+    }
+    SDL_AtomicUnlock(&SDL_YUV_threads_hint_lock);
+
+    if (!SDL_YUV_pool.lock) {
+        return;
+    }
+
+    SDL_LockMutex(SDL_YUV_pool.lock);
+    SDL_YUV_pool.quit = SDL_TRUE;
+    SDL_CondBroadcast(SDL_YUV_pool.work_ready);
+    SDL_UnlockMutex(SDL_YUV_pool.lock);
+
+    for (i = 0; i < SDL_YUV_pool.num_threads; ++i) {
+        SDL_WaitThread(SDL_YUV_pool.threads[i], NULL);
+    }
+
+    SDL_DestroyCond(SDL_YUV_pool.work_done);
+    SDL_DestroyCond(SDL_YUV_pool.work_ready);
+    SDL_DestroyMutex(SDL_YUV_pool.lock);
+    SDL_zero(SDL_YUV_pool);
+}
+
 int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
                                  Uint32 src_format, const void *src, int src_pitch,
                                  Uint32 dst_format, void *dst, int dst_pitch)
@@ -578,15 +1012,11 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
-        return 0;
-    }
-
-    if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+    if (yuv_rgb_threaded(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return 0;
     }
 
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+    if (yuv_rgb_convert(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return 0;
     }
 
@@ -608,31 +1038,659 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
             return ret;
         }
 
-        /* convert tmp/ARGB8888 to dst/RGB */
-        ret = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch);
-        SDL_free(tmp);
-        return ret;
+        /* convert tmp/ARGB8888 to dst/RGB */
+        ret = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch);
+        SDL_free(tmp);
+        return ret;
+    }
+
+    return SDL_SetError("Unsupported YUV conversion");
+}
+
+struct RGB2YUVFactors
+{
+    int y_offset;
+    float y[3]; /* Rfactor, Gfactor, Bfactor */
+    float u[3]; /* Rfactor, Gfactor, Bfactor */
+    float v[3]; /* Rfactor, Gfactor, Bfactor */
+};
+
+/* Size and position of the color channels of a 24 or 32-bit RGB pixel, as read by RGB2YUV_ReadPixel() */
+typedef struct
+{
+    int bpp;
+    int r_shift;
+    int g_shift;
+    int b_shift;
+} RGB2YUVLayout;
+
+static SDL_bool GetRGB2YUVLayout(Uint32 format, RGB2YUVLayout *layout)
+{
+    layout->bpp = 4;
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB24:
+        layout->bpp = 3;
+        layout->r_shift = 0;
+        layout->g_shift = 8;
+        layout->b_shift = 16;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_BGR24:
+        layout->bpp = 3;
+        layout->r_shift = 16;
+        layout->g_shift = 8;
+        layout->b_shift = 0;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_RGB888:
+    case SDL_PIXELFORMAT_ARGB8888:
+        layout->r_shift = 16;
+        layout->g_shift = 8;
+        layout->b_shift = 0;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_BGR888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        layout->r_shift = 0;
+        layout->g_shift = 8;
+        layout->b_shift = 16;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_RGBX8888:
+    case SDL_PIXELFORMAT_RGBA8888:
+        layout->r_shift = 24;
+        layout->g_shift = 16;
+        layout->b_shift = 8;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_BGRX8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+        layout->r_shift = 8;
+        layout->g_shift = 16;
+        layout->b_shift = 24;
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+/* Pixel i of a row: the native 32-bit value, or bytes 0-2 in bits 0-23 for 24-bit formats */
+static SDL_INLINE Uint32 RGB2YUV_ReadPixel(const Uint8 *row, int i, int bpp)
+{
+    if (bpp == 3) {
+        row += 3 * i;
+        return (Uint32)row[0] | ((Uint32)row[1] << 8) | ((Uint32)row[2] << 16);
+    }
+    return ((const Uint32 *)row)[i];
+}
+
+/* Byte positions of Y0, U, Y1 and V in a packed 4:2:2 pixel pair */
+static void GetPacked4Shifts(Uint32 format, int *y0_shift, int *u_shift, int *y1_shift, int *v_shift)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_UYVY:
+        *u_shift = 0;
+        *y0_shift = 8;
+        *v_shift = 16;
+        *y1_shift = 24;
+        break;
+    case SDL_PIXELFORMAT_YVYU:
+        *y0_shift = 0;
+        *v_shift = 8;
+        *y1_shift = 16;
+        *u_shift = 24;
+        break;
+    default: /* SDL_PIXELFORMAT_YUY2 */
+        *y0_shift = 0;
+        *u_shift = 8;
+        *y1_shift = 16;
+        *v_shift = 24;
+        break;
+    }
+}
+
+/* The SIMD code below does the same single precision math as the MAKE_Y,
+   MAKE_U and MAKE_V macros in the same order, without fused multiply-add,
+   and truncates and wraps the same way, so the results are identical. */
+
+#ifdef __SSE2__
+typedef struct
+{
+    int bpp;
+    __m128i r_shift, g_shift, b_shift;
+    __m128 y[3], u[3], v[3];
+    __m128i y_offset;
+} RGB2YUV_SSE2;
+
+static void RGB2YUV_Setup_SSE2(RGB2YUV_SSE2 *ctx, const struct RGB2YUVFactors *cvt, const RGB2YUVLayout *layout)
+{
+    int i;
+
+    ctx->bpp = layout->bpp;
+    ctx->r_shift = _mm_cvtsi32_si128(layout->r_shift);
+    ctx->g_shift = _mm_cvtsi32_si128(layout->g_shift);
+    ctx->b_shift = _mm_cvtsi32_si128(layout->b_shift);
+    for (i = 0; i < 3; ++i) {
+        ctx->y[i] = _mm_set1_ps(cvt->y[i]);
+        ctx->u[i] = _mm_set1_ps(cvt->u[i]);
+        ctx->v[i] = _mm_set1_ps(cvt->v[i]);
+    }
+    ctx->y_offset = _mm_set1_epi32(cvt->y_offset);
+}
+
+/* Four pixels starting at src, see RGB2YUV_ReadPixel().
+   24-bit pixels are loaded with 16 bytes, 4 more than they use. */
+static SDL_INLINE __m128i RGB2YUV_Load_SSE2(const Uint8 *src, int bpp)
+{
+    const __m128i p = _mm_loadu_si128((const __m128i *)src);
+    if (bpp == 3) {
+        /* Moving the bytes up by k puts pixel k at the start of lane k */
+        const __m128i mask = _mm_setr_epi32(0x00FFFFFF, 0, 0, 0);
+        __m128i lanes = _mm_and_si128(p, mask);
+        lanes = _mm_or_si128(lanes, _mm_and_si128(_mm_slli_si128(p, 1), _mm_slli_si128(mask, 4)));
+        lanes = _mm_or_si128(lanes, _mm_and_si128(_mm_slli_si128(p, 2), _mm_slli_si128(mask, 8)));
+        lanes = _mm_or_si128(lanes, _mm_and_si128(_mm_slli_si128(p, 3), _mm_slli_si128(mask, 12)));
+        return lanes;
+    }
+    return p;
+}
+
+/* Pixels the SIMD loops may convert out of count, keeping the 24-bit loads
+   within the row. unit is the number of pixels per count. */
+static SDL_INLINE int RGB2YUV_SIMDCount(int count, int bpp, int unit)
+{
+    if (bpp == 3) {
+        return count - 2 / unit;
+    }
+    return count;
+}
+
+static SDL_INLINE __m128i RGB2YUV_Channel_SSE2(__m128i pixels, __m128i shift)
+{
+    return _mm_and_si128(_mm_srl_epi32(pixels, shift), _mm_set1_epi32(0xFF));
+}
+
+/* Returns the low byte of (int)(f[0] * r + f[1] * g + f[2] * b + 0.5f) + offset */
+static SDL_INLINE __m128i RGB2YUV_Dot_SSE2(__m128i r, __m128i g, __m128i b, const __m128 *f, __m128i offset)
+{
+    __m128 sum = _mm_mul_ps(f[0], _mm_cvtepi32_ps(r));
+    sum = _mm_add_ps(sum, _mm_mul_ps(f[1], _mm_cvtepi32_ps(g)));
+    sum = _mm_add_ps(sum, _mm_mul_ps(f[2], _mm_cvtepi32_ps(b)));
+    sum = _mm_add_ps(sum, _mm_set1_ps(0.5f));
+    return _mm_and_si128(_mm_add_epi32(_mm_cvttps_epi32(sum), offset), _mm_set1_epi32(0xFF));
+}
+
+/* Sums the adjacent pairs of values in a and b: a0+a1, a2+a3, b0+b1, b2+b3 */
+static SDL_INLINE __m128i RGB2YUV_PairSum_SSE2(__m128i a, __m128i b)
+{
+    const __m128 fa = _mm_castsi128_ps(a);
+    const __m128 fb = _mm_castsi128_ps(b);
+    const __m128i even = _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0)));
+    const __m128i odd = _mm_castps_si128(_mm_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1)));
+    return _mm_add_epi32(even, odd);
+}
+
+/* Four values of 0-255 in 32-bit lanes to four bytes in the low lane */
+static SDL_INLINE __m128i RGB2YUV_Pack8_SSE2(__m128i a)
+{
+    const __m128i a16 = _mm_packs_epi32(a, a);
+    return _mm_packus_epi16(a16, a16);
+}
+
+static int RGBToYRow_SSE2(const Uint8 *src, Uint8 *dst, int width, const RGB2YUV_SSE2 *ctx)
+{
+    const int bpp = ctx->bpp;
+    int i;
+
+    width = RGB2YUV_SIMDCount(width, bpp, 1);
+    for (i = 0; i + 8 <= width; i += 8) {
+        const __m128i p0 = RGB2YUV_Load_SSE2(src + i * bpp, bpp);
+        const __m128i p1 = RGB2YUV_Load_SSE2(src + (i + 4) * bpp, bpp);
+        const __m128i y0 = RGB2YUV_Dot_SSE2(RGB2YUV_Channel_SSE2(p0, ctx->r_shift), RGB2YUV_Channel_SSE2(p0, ctx->g_shift), RGB2YUV_Channel_SSE2(p0, ctx->b_shift), ctx->y, ctx->y_offset);
+        const __m128i y1 = RGB2YUV_Dot_SSE2(RGB2YUV_Channel_SSE2(p1, ctx->r_shift), RGB2YUV_Channel_SSE2(p1, ctx->g_shift), RGB2YUV_Channel_SSE2(p1, ctx->b_shift), ctx->y, ctx->y_offset);
+        const __m128i y16 = _mm_packs_epi32(y0, y1);
+        _mm_storel_epi64((__m128i *)(dst + i), _mm_packus_epi16(y16, y16));
+    }
+    return i;
+}
+
+/* Converts count 2x2 blocks to U and V samples, returns how many were done */
+static int RGBToUVRow2x2_SSE2(const Uint8 *curr, const Uint8 *next, Uint8 *dst_u, Uint8 *dst_v, int count, Uint32 dst_format, const RGB2YUV_SSE2 *ctx)
+{
+    const __m128i uv_offset = _mm_set1_epi32(128);
+    const int bpp = ctx->bpp;
+    int i;
+
+    count = RGB2YUV_SIMDCount(count, bpp, 2);
+    for (i = 0; i + 4 <= count; i += 4) {
+        const __m128i a0 = RGB2YUV_Load_SSE2(curr + 2 * i * bpp, bpp);
+        const __m128i a1 = RGB2YUV_Load_SSE2(curr + (2 * i + 4) * bpp, bpp);
+        const __m128i b0 = RGB2YUV_Load_SSE2(next + 2 * i * bpp, bpp);
+        const __m128i b1 = RGB2YUV_Load_SSE2(next + (2 * i + 4) * bpp, bpp);
+        const __m128i r = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(_mm_add_epi32(RGB2YUV_Channel_SSE2(a0, ctx->r_shift), RGB2YUV_Channel_SSE2(b0, ctx->r_shift)),
+                                                              _mm_add_epi32(RGB2YUV_Channel_SSE2(a1, ctx->r_shift), RGB2YUV_Channel_SSE2(b1, ctx->r_shift))), 2);
+        const __m128i g = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(_mm_add_epi32(RGB2YUV_Channel_SSE2(a0, ctx->g_shift), RGB2YUV_Channel_SSE2(b0, ctx->g_shift)),
+                                                              _mm_add_epi32(RGB2YUV_Channel_SSE2(a1, ctx->g_shift), RGB2YUV_Channel_SSE2(b1, ctx->g_shift))), 2);
+        const __m128i b = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(_mm_add_epi32(RGB2YUV_Channel_SSE2(a0, ctx->b_shift), RGB2YUV_Channel_SSE2(b0, ctx->b_shift)),
+                                                              _mm_add_epi32(RGB2YUV_Channel_SSE2(a1, ctx->b_shift), RGB2YUV_Channel_SSE2(b1, ctx->b_shift))), 2);
+        const __m128i u8 = RGB2YUV_Pack8_SSE2(RGB2YUV_Dot_SSE2(r, g, b, ctx->u, uv_offset));
+        const __m128i v8 = RGB2YUV_Pack8_SSE2(RGB2YUV_Dot_SSE2(r, g, b, ctx->v, uv_offset));
+
+        if (dst_format == SDL_PIXELFORMAT_NV12) {
+            _mm_storel_epi64((__m128i *)(dst_u + 2 * i), _mm_unpacklo_epi8(u8, v8));
+        } else if (dst_format == SDL_PIXELFORMAT_NV21) {
+            _mm_storel_epi64((__m128i *)(dst_v + 2 * i), _mm_unpacklo_epi8(v8, u8));
+        } else {
+            const Uint32 u4 = (Uint32)_mm_cvtsi128_si32(u8);
+            const Uint32 v4 = (Uint32)_mm_cvtsi128_si32(v8);
+            SDL_memcpy(dst_u + i, &u4, sizeof(u4));
+            SDL_memcpy(dst_v + i, &v4, sizeof(v4));
+        }
+    }
+    return i;
+}
+
+/* Converts count pixel pairs to packed 4:2:2, returns how many were done */
+static int RGBToPacked4Row_SSE2(const Uint8 *src, Uint8 *dst, int count, Uint32 dst_format, const RGB2YUV_SSE2 *ctx)
+{
+    const __m128i uv_offset = _mm_set1_epi32(128);
+    const int bpp = ctx->bpp;
+    int y0_shift, u_shift, y1_shift, v_shift;
+    __m128i y0_count, u_count, y1_count, v_count;
+    int i;
+
+    GetPacked4Shifts(dst_format, &y0_shift, &u_shift, &y1_shift, &v_shift);
+    y0_count = _mm_cvtsi32_si128(y0_shift);
+    u_count = _mm_cvtsi32_si128(u_shift);
+    y1_count = _mm_cvtsi32_si128(y1_shift);
+    v_count = _mm_cvtsi32_si128(v_shift);
+
+    count = RGB2YUV_SIMDCount(count, bpp, 2);
+    for (i = 0; i + 4 <= count; i += 4) {
+        const __m128i p0 = RGB2YUV_Load_SSE2(src + 2 * i * bpp, bpp);
+        const __m128i p1 = RGB2YUV_Load_SSE2(src + (2 * i + 4) * bpp, bpp);
+        const __m128i r0 = RGB2YUV_Channel_SSE2(p0, ctx->r_shift);
+        const __m128i g0 = RGB2YUV_Channel_SSE2(p0, ctx->g_shift);
+        const __m128i b0 = RGB2YUV_Channel_SSE2(p0, ctx->b_shift);
+        const __m128i r1 = RGB2YUV_Channel_SSE2(p1, ctx->r_shift);
+        const __m128i g1 = RGB2YUV_Channel_SSE2(p1, ctx->g_shift);
+        const __m128i b1 = RGB2YUV_Channel_SSE2(p1, ctx->b_shift);
+        const __m128 y_lo = _mm_castsi128_ps(RGB2YUV_Dot_SSE2(r0, g0, b0, ctx->y, ctx->y_offset));
+        const __m128 y_hi = _mm_castsi128_ps(RGB2YUV_Dot_SSE2(r1, g1, b1, ctx->y, ctx->y_offset));
+        const __m128i y_even = _mm_castps_si128(_mm_shuffle_ps(y_lo, y_hi, _MM_SHUFFLE(2, 0, 2, 0)));
+        const __m128i y_odd = _mm_castps_si128(_mm_shuffle_ps(y_lo, y_hi, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128i r = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(r0, r1), 1);
+        const __m128i g = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(g0, g1), 1);
+        const __m128i b = _mm_srli_epi32(RGB2YUV_PairSum_SSE2(b0, b1), 1);
+        const __m128i u = RGB2YUV_Dot_SSE2(r, g, b, ctx->u, uv_offset);
+        const __m128i v = RGB2YUV_Dot_SSE2(r, g, b, ctx->v, uv_offset);
+        __m128i packed = _mm_sll_epi32(y_even, y0_count);
+        packed = _mm_or_si128(packed, _mm_sll_epi32(u, u_count));
+        packed = _mm_or_si128(packed, _mm_sll_epi32(y_odd, y1_count));
+        packed = _mm_or_si128(packed, _mm_sll_epi32(v, v_count));
+        _mm_storeu_si128((__m128i *)(dst + 4 * i), packed);
+    }
+    return i;
+}
+#endif /* __SSE2__ */
+
+#ifdef SDL_AVX2_INTRINSICS
+typedef struct
+{
+    int bpp;
+    __m128i r_shift, g_shift, b_shift;
+    __m256 y[3], u[3], v[3];
+    __m256i y_offset;
+} RGB2YUV_AVX2;
+
+SDL_TARGETING("avx2") static void RGB2YUV_Setup_AVX2(RGB2YUV_AVX2 *ctx, const struct RGB2YUVFactors *cvt, const RGB2YUVLayout *layout)
+{
+    int i;
+
+    ctx->bpp = layout->bpp;
+    ctx->r_shift = _mm_cvtsi32_si128(layout->r_shift);
+    ctx->g_shift = _mm_cvtsi32_si128(layout->g_shift);
+    ctx->b_shift = _mm_cvtsi32_si128(layout->b_shift);
+    for (i = 0; i < 3; ++i) {
+        ctx->y[i] = _mm256_set1_ps(cvt->y[i]);
+        ctx->u[i] = _mm256_set1_ps(cvt->u[i]);
+        ctx->v[i] = _mm256_set1_ps(cvt->v[i]);
+    }
+    ctx->y_offset = _mm256_set1_epi32(cvt->y_offset);
+}
+
+/* Eight pixels starting at src, 24-bit pixels read 4 bytes more than they use */
+SDL_TARGETING("avx2") static SDL_INLINE __m256i RGB2YUV_Load_AVX2(const Uint8 *src, int bpp)
+{
+    if (bpp == 3) {
+        const __m256i p = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)src)),
+                                                  _mm_loadu_si128((const __m128i *)(src + 12)), 1);
+        return _mm256_shuffle_epi8(p, _mm256_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                                                       0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1));
+    }
+    return _mm256_loadu_si256((const __m256i *)src);
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i RGB2YUV_Channel_AVX2(__m256i pixels, __m128i shift)
+{
+    return _mm256_and_si256(_mm256_srl_epi32(pixels, shift), _mm256_set1_epi32(0xFF));
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i RGB2YUV_Dot_AVX2(__m256i r, __m256i g, __m256i b, const __m256 *f, __m256i offset)
+{
+    __m256 sum = _mm256_mul_ps(f[0], _mm256_cvtepi32_ps(r));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(f[1], _mm256_cvtepi32_ps(g)));
+    sum = _mm256_add_ps(sum, _mm256_mul_ps(f[2], _mm256_cvtepi32_ps(b)));
+    sum = _mm256_add_ps(sum, _mm256_set1_ps(0.5f));
+    return _mm256_and_si256(_mm256_add_epi32(_mm256_cvttps_epi32(sum), offset), _mm256_set1_epi32(0xFF));
+}
+
+/* The even and odd values of a followed by b, in order */
+SDL_TARGETING("avx2") static SDL_INLINE void RGB2YUV_Deinterleave_AVX2(__m256i a, __m256i b, __m256i *even, __m256i *odd)
+{
+    const __m256 fa = _mm256_castsi256_ps(a);
+    const __m256 fb = _mm256_castsi256_ps(b);
+    *even = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(2, 0, 2, 0))), 0xD8);
+    *odd = _mm256_permute4x64_epi64(_mm256_castps_si256(_mm256_shuffle_ps(fa, fb, _MM_SHUFFLE(3, 1, 3, 1))), 0xD8);
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i RGB2YUV_PairSum_AVX2(__m256i a, __m256i b)
+{
+    __m256i even, odd;
+    RGB2YUV_Deinterleave_AVX2(a, b, &even, &odd);
+    return _mm256_add_epi32(even, odd);
+}
+
+/* Eight values of 0-255 in 32-bit lanes to eight bytes in the low lane */
+SDL_TARGETING("avx2") static SDL_INLINE __m128i RGB2YUV_Pack8_AVX2(__m256i a)
+{
+    const __m128i a16 = _mm_packs_epi32(_mm256_castsi256_si128(a), _mm256_extracti128_si256(a, 1));
+    return _mm_packus_epi16(a16, a16);
+}
+
+SDL_TARGETING("avx2") static int RGBToYRow_AVX2(const Uint8 *src, Uint8 *dst, int width, const RGB2YUV_AVX2 *ctx)
+{
+    const int bpp = ctx->bpp;
+    int i;
+
+    width = RGB2YUV_SIMDCount(width, bpp, 1);
+    for (i = 0; i + 16 <= width; i += 16) {
+        const __m256i p0 = RGB2YUV_Load_AVX2(src + i * bpp, bpp);
+        const __m256i p1 = RGB2YUV_Load_AVX2(src + (i + 8) * bpp, bpp);
+        const __m256i y0 = RGB2YUV_Dot_AVX2(RGB2YUV_Channel_AVX2(p0, ctx->r_shift), RGB2YUV_Channel_AVX2(p0, ctx->g_shift), RGB2YUV_Channel_AVX2(p0, ctx->b_shift), ctx->y, ctx->y_offset);
+        const __m256i y1 = RGB2YUV_Dot_AVX2(RGB2YUV_Channel_AVX2(p1, ctx->r_shift), RGB2YUV_Channel_AVX2(p1, ctx->g_shift), RGB2YUV_Channel_AVX2(p1, ctx->b_shift), ctx->y, ctx->y_offset);
+        const __m256i y16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(y0, y1), 0xD8);
+        _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm256_castsi256_si128(y16), _mm256_extracti128_si256(y16, 1)));
+    }
+    return i;
+}
+
+SDL_TARGETING("avx2") static int RGBToUVRow2x2_AVX2(const Uint8 *curr, const Uint8 *next, Uint8 *dst_u, Uint8 *dst_v, int count, Uint32 dst_format, const RGB2YUV_AVX2 *ctx)
+{
+    const __m256i uv_offset = _mm256_set1_epi32(128);
+    const int bpp = ctx->bpp;
+    int i;
+
+    count = RGB2YUV_SIMDCount(count, bpp, 2);
+    for (i = 0; i + 8 <= count; i += 8) {
+        const __m256i a0 = RGB2YUV_Load_AVX2(curr + 2 * i * bpp, bpp);
+        const __m256i a1 = RGB2YUV_Load_AVX2(curr + (2 * i + 8) * bpp, bpp);
+        const __m256i b0 = RGB2YUV_Load_AVX2(next + 2 * i * bpp, bpp);
+        const __m256i b1 = RGB2YUV_Load_AVX2(next + (2 * i + 8) * bpp, bpp);
+        const __m256i r = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(_mm256_add_epi32(RGB2YUV_Channel_AVX2(a0, ctx->r_shift), RGB2YUV_Channel_AVX2(b0, ctx->r_shift)),
+                                                                 _mm256_add_epi32(RGB2YUV_Channel_AVX2(a1, ctx->r_shift), RGB2YUV_Channel_AVX2(b1, ctx->r_shift))), 2);
+        const __m256i g = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(_mm256_add_epi32(RGB2YUV_Channel_AVX2(a0, ctx->g_shift), RGB2YUV_Channel_AVX2(b0, ctx->g_shift)),
+                                                                 _mm256_add_epi32(RGB2YUV_Channel_AVX2(a1, ctx->g_shift), RGB2YUV_Channel_AVX2(b1, ctx->g_shift))), 2);
+        const __m256i b = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(_mm256_add_epi32(RGB2YUV_Channel_AVX2(a0, ctx->b_shift), RGB2YUV_Channel_AVX2(b0, ctx->b_shift)),
+                                                                 _mm256_add_epi32(RGB2YUV_Channel_AVX2(a1, ctx->b_shift), RGB2YUV_Channel_AVX2(b1, ctx->b_shift))), 2);
+        const __m128i u8 = RGB2YUV_Pack8_AVX2(RGB2YUV_Dot_AVX2(r, g, b, ctx->u, uv_offset));
+        const __m128i v8 = RGB2YUV_Pack8_AVX2(RGB2YUV_Dot_AVX2(r, g, b, ctx->v, uv_offset));
+
+        if (dst_format == SDL_PIXELFORMAT_NV12) {
+            _mm_storeu_si128((__m128i *)(dst_u + 2 * i), _mm_unpacklo_epi8(u8, v8));
+        } else if (dst_format == SDL_PIXELFORMAT_NV21) {
+            _mm_storeu_si128((__m128i *)(dst_v + 2 * i), _mm_unpacklo_epi8(v8, u8));
+        } else {
+            _mm_storel_epi64((__m128i *)(dst_u + i), u8);
+            _mm_storel_epi64((__m128i *)(dst_v + i), v8);
+        }
+    }
+    return i;
+}
+
+SDL_TARGETING("avx2") static int RGBToPacked4Row_AVX2(const Uint8 *src, Uint8 *dst, int count, Uint32 dst_format, const RGB2YUV_AVX2 *ctx)
+{
+    const __m256i uv_offset = _mm256_set1_epi32(128);
+    const int bpp = ctx->bpp;
+    int y0_shift, u_shift, y1_shift, v_shift;
+    __m128i y0_count, u_count, y1_count, v_count;
+    int i;
+
+    GetPacked4Shifts(dst_format, &y0_shift, &u_shift, &y1_shift, &v_shift);
+    y0_count = _mm_cvtsi32_si128(y0_shift);
+    u_count = _mm_cvtsi32_si128(u_shift);
+    y1_count = _mm_cvtsi32_si128(y1_shift);
+    v_count = _mm_cvtsi32_si128(v_shift);
+
+    count = RGB2YUV_SIMDCount(count, bpp, 2);
+    for (i = 0; i + 8 <= count; i += 8) {
+        const __m256i p0 = RGB2YUV_Load_AVX2(src + 2 * i * bpp, bpp);
+        const __m256i p1 = RGB2YUV_Load_AVX2(src + (2 * i + 8) * bpp, bpp);
+        const __m256i r0 = RGB2YUV_Channel_AVX2(p0, ctx->r_shift);
+        const __m256i g0 = RGB2YUV_Channel_AVX2(p0, ctx->g_shift);
+        const __m256i b0 = RGB2YUV_Channel_AVX2(p0, ctx->b_shift);
+        const __m256i r1 = RGB2YUV_Channel_AVX2(p1, ctx->r_shift);
+        const __m256i g1 = RGB2YUV_Channel_AVX2(p1, ctx->g_shift);
+        const __m256i b1 = RGB2YUV_Channel_AVX2(p1, ctx->b_shift);
+        const __m256i r = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(r0, r1), 1);
+        const __m256i g = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(g0, g1), 1);
+        const __m256i b = _mm256_srli_epi32(RGB2YUV_PairSum_AVX2(b0, b1), 1);
+        const __m256i u = RGB2YUV_Dot_AVX2(r, g, b, ctx->u, uv_offset);
+        const __m256i v = RGB2YUV_Dot_AVX2(r, g, b, ctx->v, uv_offset);
+        __m256i y_even, y_odd, packed;
+
+        RGB2YUV_Deinterleave_AVX2(RGB2YUV_Dot_AVX2(r0, g0, b0, ctx->y, ctx->y_offset),
+                                  RGB2YUV_Dot_AVX2(r1, g1, b1, ctx->y, ctx->y_offset),
+                                  &y_even, &y_odd);
+        packed = _mm256_sll_epi32(y_even, y0_count);
+        packed = _mm256_or_si256(packed, _mm256_sll_epi32(u, u_count));
+        packed = _mm256_or_si256(packed, _mm256_sll_epi32(y_odd, y1_count));
+        packed = _mm256_or_si256(packed, _mm256_sll_epi32(v, v_count));
+        _mm256_storeu_si256((__m256i *)(dst + 4 * i), packed);
+    }
+    return i;
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
+/* The NEON code reads the channels as bytes of the pixel, which matches
+   the shifts of the 32-bit formats on little endian only. */
+#if defined(__ARM_NEON) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+
+#ifdef HAVE_NEON_INTRINSICS
+typedef struct
+{
+    int bpp;
+    int r_index, g_index, b_index; /* byte of each channel within a pixel */
+    float32x4_t y[3], u[3], v[3];
+    int32x4_t y_offset;
+} RGB2YUV_NEON;
+
+static void RGB2YUV_Setup_NEON(RGB2YUV_NEON *ctx, const struct RGB2YUVFactors *cvt, const RGB2YUVLayout *layout)
+{
+    int i;
+
+    ctx->bpp = layout->bpp;
+    ctx->r_index = layout->r_shift / 8;
+    ctx->g_index = layout->g_shift / 8;
+    ctx->b_index = layout->b_shift / 8;
+    for (i = 0; i < 3; ++i) {
+        ctx->y[i] = vdupq_n_f32(cvt->y[i]);
+        ctx->u[i] = vdupq_n_f32(cvt->u[i]);
+        ctx->v[i] = vdupq_n_f32(cvt->v[i]);
+    }
+    ctx->y_offset = vdupq_n_s32(cvt->y_offset);
+}
+
+/* Sixteen pixels starting at src, split into their R, G and B bytes */
+static SDL_INLINE void RGB2YUV_Load_NEON(const Uint8 *src, const RGB2YUV_NEON *ctx, uint8x16_t *r, uint8x16_t *g, uint8x16_t *b)
+{
+    if (ctx->bpp == 3) {
+        const uint8x16x3_t p = vld3q_u8(src);
+        *r = p.val[ctx->r_index];
+        *g = p.val[ctx->g_index];
+        *b = p.val[ctx->b_index];
+    } else {
+        const uint8x16x4_t p = vld4q_u8(src);
+        *r = p.val[ctx->r_index];
+        *g = p.val[ctx->g_index];
+        *b = p.val[ctx->b_index];
+    }
+}
+
+/* Returns (int)(f[0] * r + f[1] * g + f[2] * b + 0.5f) + offset */
+static SDL_INLINE int32x4_t RGB2YUV_Dot4_NEON(uint16x4_t r, uint16x4_t g, uint16x4_t b, const float32x4_t *f, int32x4_t offset)
+{
+    float32x4_t sum = vmulq_f32(f[0], vcvtq_f32_u32(vmovl_u16(r)));
+    sum = vaddq_f32(sum, vmulq_f32(f[1], vcvtq_f32_u32(vmovl_u16(g))));
+    sum = vaddq_f32(sum, vmulq_f32(f[2], vcvtq_f32_u32(vmovl_u16(b))));
+    sum = vaddq_f32(sum, vdupq_n_f32(0.5f));
+    return vaddq_s32(vcvtq_s32_f32(sum), offset);
+}
+
+/* The low bytes of eight dot products, see RGB2YUV_Dot4_NEON() */
+static SDL_INLINE uint8x8_t RGB2YUV_Dot8_NEON(uint16x8_t r, uint16x8_t g, uint16x8_t b, const float32x4_t *f, int32x4_t offset)
+{
+    const int32x4_t lo = RGB2YUV_Dot4_NEON(vget_low_u16(r), vget_low_u16(g), vget_low_u16(b), f, offset);
+    const int32x4_t hi = RGB2YUV_Dot4_NEON(vget_high_u16(r), vget_high_u16(g), vget_high_u16(b), f, offset);
+    return vmovn_u16(vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(lo)), vmovn_u32(vreinterpretq_u32_s32(hi))));
+}
+
+/* Y of sixteen pixels, split into the first and last eight */
+static SDL_INLINE void RGB2YUV_Y16_NEON(uint8x16_t r, uint8x16_t g, uint8x16_t b, const RGB2YUV_NEON *ctx, uint8x8_t *y_lo, uint8x8_t *y_hi)
+{
+    *y_lo = RGB2YUV_Dot8_NEON(vmovl_u8(vget_low_u8(r)), vmovl_u8(vget_low_u8(g)), vmovl_u8(vget_low_u8(b)), ctx->y, ctx->y_offset);
+    *y_hi = RGB2YUV_Dot8_NEON(vmovl_u8(vget_high_u8(r)), vmovl_u8(vget_high_u8(g)), vmovl_u8(vget_high_u8(b)), ctx->y, ctx->y_offset);
+}
+
+static int RGBToYRow_NEON(const Uint8 *src, Uint8 *dst, int width, const RGB2YUV_NEON *ctx)
+{
+    int i;
+
+    for (i = 0; i + 16 <= width; i += 16) {
+        uint8x16_t r, g, b;
+        uint8x8_t y_lo, y_hi;
+
+        RGB2YUV_Load_NEON(src + i * ctx->bpp, ctx, &r, &g, &b);
+        RGB2YUV_Y16_NEON(r, g, b, ctx, &y_lo, &y_hi);
+        vst1q_u8(dst + i, vcombine_u8(y_lo, y_hi));
     }
+    return i;
+}
 
-    return SDL_SetError("Unsupported YUV conversion");
+static int RGBToUVRow2x2_NEON(const Uint8 *curr, const Uint8 *next, Uint8 *dst_u, Uint8 *dst_v, int count, Uint32 dst_format, const RGB2YUV_NEON *ctx)
+{
+    const int32x4_t uv_offset = vdupq_n_s32(128);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        uint8x16_t r0, g0, b0, r1, g1, b1;
+        uint16x8_t r, g, b;
+        uint8x8_t u, v;
+
+        RGB2YUV_Load_NEON(curr + 2 * i * ctx->bpp, ctx, &r0, &g0, &b0);
+        RGB2YUV_Load_NEON(next + 2 * i * ctx->bpp, ctx, &r1, &g1, &b1);
+        r = vshrq_n_u16(vaddq_u16(vpaddlq_u8(r0), vpaddlq_u8(r1)), 2);
+        g = vshrq_n_u16(vaddq_u16(vpaddlq_u8(g0), vpaddlq_u8(g1)), 2);
+        b = vshrq_n_u16(vaddq_u16(vpaddlq_u8(b0), vpaddlq_u8(b1)), 2);
+        u = RGB2YUV_Dot8_NEON(r, g, b, ctx->u, uv_offset);
+        v = RGB2YUV_Dot8_NEON(r, g, b, ctx->v, uv_offset);
+
+        if (dst_format == SDL_PIXELFORMAT_NV12) {
+            uint8x8x2_t uv;
+            uv.val[0] = u;
+            uv.val[1] = v;
+            vst2_u8(dst_u + 2 * i, uv);
+        } else if (dst_format == SDL_PIXELFORMAT_NV21) {
+            uint8x8x2_t vu;
+            vu.val[0] = v;
+            vu.val[1] = u;
+            vst2_u8(dst_v + 2 * i, vu);
+        } else {
+            vst1_u8(dst_u + i, u);
+            vst1_u8(dst_v + i, v);
+        }
+    }
+    return i;
 }
 
-struct RGB2YUVFactors
+static int RGBToPacked4Row_NEON(const Uint8 *src, Uint8 *dst, int count, Uint32 dst_format, const RGB2YUV_NEON *ctx)
 {
-    int y_offset;
-    float y[3]; /* Rfactor, Gfactor, Bfactor */
-    float u[3]; /* Rfactor, Gfactor, Bfactor */
-    float v[3]; /* Rfactor, Gfactor, Bfactor */
-};
+    const int32x4_t uv_offset = vdupq_n_s32(128);
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        uint8x16_t r, g, b;
+        uint8x8_t y_lo, y_hi, u, v;
+        uint16x8_t r2, g2, b2;
+        uint8x8x2_t y; /* Y of the even and odd pixels */
+        uint8x8x4_t packed;
+
+        RGB2YUV_Load_NEON(src + 2 * i * ctx->bpp, ctx, &r, &g, &b);
+        RGB2YUV_Y16_NEON(r, g, b, ctx, &y_lo, &y_hi);
+        y = vuzp_u8(y_lo, y_hi);
+        r2 = vshrq_n_u16(vpaddlq_u8(r), 1);
+        g2 = vshrq_n_u16(vpaddlq_u8(g), 1);
+        b2 = vshrq_n_u16(vpaddlq_u8(b), 1);
+        u = RGB2YUV_Dot8_NEON(r2, g2, b2, ctx->u, uv_offset);
+        v = RGB2YUV_Dot8_NEON(r2, g2, b2, ctx->v, uv_offset);
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_UYVY:
+            packed.val[0] = u;
+            packed.val[1] = y.val[0];
+            packed.val[2] = v;
+            packed.val[3] = y.val[1];
+            break;
+        case SDL_PIXELFORMAT_YVYU:
+            packed.val[0] = y.val[0];
+            packed.val[1] = v;
+            packed.val[2] = y.val[1];
+            packed.val[3] = u;
+            break;
+        default: /* SDL_PIXELFORMAT_YUY2 */
+            packed.val[0] = y.val[0];
+            packed.val[1] = u;
+            packed.val[2] = y.val[1];
+            packed.val[3] = v;
+            break;
+        }
+        vst4_u8(dst + 4 * i, packed);
+    }
+    return i;
+}
+#endif /* HAVE_NEON_INTRINSICS */
 
-static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+static int SDL_ConvertPixels_RGB_to_YUV_Direct(int width, int height, const RGB2YUVLayout *layout, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
 {
     const int src_pitch_x_2 = src_pitch * 2;
     const int height_half = height / 2;
     const int height_remainder = (height & 0x1);
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
+    const int bpp = layout->bpp;
+    const int rs = layout->r_shift;
+    const int gs = layout->g_shift;
+    const int bs = layout->b_shift;
     int i, j;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+    RGB2YUV_AVX2 avx2;
+#endif
+#ifdef __SSE2__
+    const SDL_bool use_SSE2 = SDL_HasSSE2();
+    RGB2YUV_SSE2 sse2;
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+    const SDL_bool use_NEON = SDL_HasNEON();
+    RGB2YUV_NEON neon;
+#endif
 
     static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] = {
         /* ITU-T T.871 (JPEG) */
@@ -659,50 +1717,68 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
     };
     const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
 
+#ifdef SDL_AVX2_INTRINSICS
+    if (use_AVX2) {
+        RGB2YUV_Setup_AVX2(&avx2, cvt, layout);
+    }
+#endif
+#ifdef __SSE2__
+    if (use_SSE2) {
+        RGB2YUV_Setup_SSE2(&sse2, cvt, layout);
+    }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+    if (use_NEON) {
+        RGB2YUV_Setup_NEON(&neon, cvt, layout);
+    }
+#endif
+
 #define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
 #define MAKE_U(r, g, b) (Uint8)((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128)
 #define MAKE_V(r, g, b) (Uint8)((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 128)
 
-#define READ_2x2_PIXELS                                                                                     \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10; \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2;
-
-#define READ_2x1_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
-
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;
-
-#define READ_1x1_PIXEL                                  \
-    const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
-    const Uint32 r = (p & 0x00ff0000) >> 16;            \
-    const Uint32 g = (p & 0x0000ff00) >> 8;             \
-    const Uint32 b = (p & 0x000000ff);
-
-#define READ_TWO_RGB_PIXELS                                  \
-    const Uint32 p = ((const Uint32 *)curr_row)[2 * i];      \
-    const Uint32 r = (p & 0x00ff0000) >> 16;                 \
-    const Uint32 g = (p & 0x0000ff00) >> 8;                  \
-    const Uint32 b = (p & 0x000000ff);                       \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i + 1]; \
-    const Uint32 r1 = (p1 & 0x00ff0000) >> 16;               \
-    const Uint32 g1 = (p1 & 0x0000ff00) >> 8;                \
-    const Uint32 b1 = (p1 & 0x000000ff);                     \
-    const Uint32 R = (r + r1) / 2;                           \
-    const Uint32 G = (g + g1) / 2;                           \
+#define CHANNEL(p, shift) (((p) >> (shift)) & 0xff)
+
+#define READ_2x2_PIXELS                                                                      \
+    const Uint32 p1 = RGB2YUV_ReadPixel(curr_row, 2 * i, bpp);                               \
+    const Uint32 p2 = RGB2YUV_ReadPixel(curr_row, 2 * i + 1, bpp);                           \
+    const Uint32 p3 = RGB2YUV_ReadPixel(next_row, 2 * i, bpp);                               \
+    const Uint32 p4 = RGB2YUV_ReadPixel(next_row, 2 * i + 1, bpp);                           \
+    const Uint32 r = (CHANNEL(p1, rs) + CHANNEL(p2, rs) + CHANNEL(p3, rs) + CHANNEL(p4, rs)) >> 2; \
+    const Uint32 g = (CHANNEL(p1, gs) + CHANNEL(p2, gs) + CHANNEL(p3, gs) + CHANNEL(p4, gs)) >> 2; \
+    const Uint32 b = (CHANNEL(p1, bs) + CHANNEL(p2, bs) + CHANNEL(p3, bs) + CHANNEL(p4, bs)) >> 2;
+
+#define READ_2x1_PIXELS                                          \
+    const Uint32 p1 = RGB2YUV_ReadPixel(curr_row, 2 * i, bpp);   \
+    const Uint32 p2 = RGB2YUV_ReadPixel(next_row, 2 * i, bpp);   \
+    const Uint32 r = (CHANNEL(p1, rs) + CHANNEL(p2, rs)) >> 1;   \
+    const Uint32 g = (CHANNEL(p1, gs) + CHANNEL(p2, gs)) >> 1;   \
+    const Uint32 b = (CHANNEL(p1, bs) + CHANNEL(p2, bs)) >> 1;
+
+#define READ_1x2_PIXELS                                            \
+    const Uint32 p1 = RGB2YUV_ReadPixel(curr_row, 2 * i, bpp);     \
+    const Uint32 p2 = RGB2YUV_ReadPixel(curr_row, 2 * i + 1, bpp); \
+    const Uint32 r = (CHANNEL(p1, rs) + CHANNEL(p2, rs)) >> 1;     \
+    const Uint32 g = (CHANNEL(p1, gs) + CHANNEL(p2, gs)) >> 1;     \
+    const Uint32 b = (CHANNEL(p1, bs) + CHANNEL(p2, bs)) >> 1;
+
+#define READ_1x1_PIXEL                                         \
+    const Uint32 p = RGB2YUV_ReadPixel(curr_row, 2 * i, bpp);  \
+    const Uint32 r = CHANNEL(p, rs);                           \
+    const Uint32 g = CHANNEL(p, gs);                           \
+    const Uint32 b = CHANNEL(p, bs);
+
+#define READ_TWO_RGB_PIXELS                                         \
+    const Uint32 p = RGB2YUV_ReadPixel(curr_row, 2 * i, bpp);       \
+    const Uint32 r = CHANNEL(p, rs);                                \
+    const Uint32 g = CHANNEL(p, gs);                                \
+    const Uint32 b = CHANNEL(p, bs);                                \
+    const Uint32 p1 = RGB2YUV_ReadPixel(curr_row, 2 * i + 1, bpp);  \
+    const Uint32 r1 = CHANNEL(p1, rs);                              \
+    const Uint32 g1 = CHANNEL(p1, gs);                              \
+    const Uint32 b1 = CHANNEL(p1, bs);                              \
+    const Uint32 R = (r + r1) / 2;                                  \
+    const Uint32 G = (g + g1) / 2;                                  \
     const Uint32 B = (b + b1) / 2;
 
 #define READ_ONE_RGB_PIXEL READ_1x1_PIXEL
@@ -734,11 +1810,28 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
 
         /* Write Y plane */
         for (j = 0; j < height; j++) {
-            for (i = 0; i < width; i++) {
-                const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                const Uint32 b = (p1 & 0x000000ff);
+            i = 0;
+#ifdef SDL_AVX2_INTRINSICS
+            if (use_AVX2) {
+                i = RGBToYRow_AVX2(curr_row, plane_y, width, &avx2);
+            }
+#endif
+#ifdef __SSE2__
+            if (use_SSE2) {
+                i += RGBToYRow_SSE2(curr_row + i * bpp, plane_y + i, width - i, &sse2);
+            }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+            if (use_NEON) {
+                i += RGBToYRow_NEON(curr_row + i * bpp, plane_y + i, width - i, &neon);
+            }
+#endif
+            plane_y += i;
+            for (; i < width; i++) {
+                const Uint32 p1 = RGB2YUV_ReadPixel(curr_row, i, bpp);
+                const Uint32 r = CHANNEL(p1, rs);
+                const Uint32 g = CHANNEL(p1, gs);
+                const Uint32 b = CHANNEL(p1, bs);
                 *plane_y++ = MAKE_Y(r, g, b);
             }
             plane_y += y_skip;
@@ -753,7 +1846,25 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
             /* Write UV planes, not interleaved */
             uv_skip = (uv_stride - (width + 1) / 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = 0;
+#ifdef SDL_AVX2_INTRINSICS
+                if (use_AVX2) {
+                    i = RGBToUVRow2x2_AVX2(curr_row, next_row, plane_u, plane_v, width_half, dst_format, &avx2);
+                }
+#endif
+#ifdef __SSE2__
+                if (use_SSE2) {
+                    i += RGBToUVRow2x2_SSE2(curr_row + 2 * i * bpp, next_row + 2 * i * bpp, plane_u + i, plane_v + i, width_half - i, dst_format, &sse2);
+                }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+                if (use_NEON) {
+                    i += RGBToUVRow2x2_NEON(curr_row + 2 * i * bpp, next_row + 2 * i * bpp, plane_u + i, plane_v + i, width_half - i, dst_format, &neon);
+                }
+#endif
+                plane_u += i;
+                plane_v += i;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_u++ = MAKE_U(r, g, b);
                     *plane_v++ = MAKE_V(r, g, b);
@@ -785,7 +1896,24 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         } else if (dst_format == SDL_PIXELFORMAT_NV12) {
             uv_skip = (uv_stride - ((width + 1) / 2) * 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = 0;
+#ifdef SDL_AVX2_INTRINSICS
+                if (use_AVX2) {
+                    i = RGBToUVRow2x2_AVX2(curr_row, next_row, plane_interleaved_uv, NULL, width_half, dst_format, &avx2);
+                }
+#endif
+#ifdef __SSE2__
+                if (use_SSE2) {
+                    i += RGBToUVRow2x2_SSE2(curr_row + 2 * i * bpp, next_row + 2 * i * bpp, plane_interleaved_uv + 2 * i, NULL, width_half - i, dst_format, &sse2);
+                }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+                if (use_NEON) {
+                    i += RGBToUVRow2x2_NEON(curr_row + 2 * i * bpp, next_row + 2 * i * bpp, plane_interleaved_uv + 2 * i, NULL, width_half - i, dst_format, &neon);
+                }
+#endif
+                plane_interleaved_uv += 2 * i;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_interleaved_uv++ = MAKE_U(r, g, b);
                     *plane_interleaved_uv++ = MAKE_V(r, g, b);
@@ -814,7 +1942,24 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
             uv_skip = (uv_stride - ((width + 1) / 2) * 2);
             for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = 0;
+#ifdef SDL_AVX2_INTRINSICS
+                if (use_AVX2) {
+                    i = RGBToUVRow2x2_AVX2(curr_row, next_row, NULL, plane_interleaved_uv, width_half, dst_format, &avx2);
+                }
+#endif
+#ifdef __SSE2__
+                if (use_SSE2) {
+                    i += RGBToUVRow2x2_SSE2(curr_row + 2 * i * bpp, next_row + 2 * i * bpp, NULL, plane_interleaved_uv + 2 * i, width_half - i, dst_format, &sse2);
+                }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+                if (use_NEON) {
+                    i += RGBToUVRow2x2_NEON(curr_row + 2 * i * bpp, next_row + 2 * i * bpp, NULL, plane_interleaved_uv + 2 * i, width_half - i, dst_format, &neon);
+                }
+#endif
+                plane_interleaved_uv += 2 * i;
+                for (; i < width_half; i++) {
                     READ_2x2_PIXELS;
                     *plane_interleaved_uv++ = MAKE_V(r, g, b);
                     *plane_interleaved_uv++ = MAKE_U(r, g, b);
@@ -860,7 +2005,24 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
         /* Write YUV plane, packed */
         if (dst_format == SDL_PIXELFORMAT_YUY2) {
             for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = 0;
+#ifdef SDL_AVX2_INTRINSICS
+                if (use_AVX2) {
+                    i = RGBToPacked4Row_AVX2(curr_row, plane, width_half, dst_format, &avx2);
+                }
+#endif
+#ifdef __SSE2__
+                if (use_SSE2) {
+                    i += RGBToPacked4Row_SSE2(curr_row + 2 * i * bpp, plane + 4 * i, width_half - i, dst_format, &sse2);
+                }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+                if (use_NEON) {
+                    i += RGBToPacked4Row_NEON(curr_row + 2 * i * bpp, plane + 4 * i, width_half - i, dst_format, &neon);
+                }
+#endif
+                plane += 4 * i;
+                for (; i < width_half; i++) {
                     READ_TWO_RGB_PIXELS;
                     /* Y U Y1 V */
                     *plane++ = MAKE_Y(r, g, b);
@@ -881,7 +2043,24 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
             }
         } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
             for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = 0;
+#ifdef SDL_AVX2_INTRINSICS
+                if (use_AVX2) {
+                    i = RGBToPacked4Row_AVX2(curr_row, plane, width_half, dst_format, &avx2);
+                }
+#endif
+#ifdef __SSE2__
+                if (use_SSE2) {
+                    i += RGBToPacked4Row_SSE2(curr_row + 2 * i * bpp, plane + 4 * i, width_half - i, dst_format, &sse2);
+                }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+                if (use_NEON) {
+                    i += RGBToPacked4Row_NEON(curr_row + 2 * i * bpp, plane + 4 * i, width_half - i, dst_format, &neon);
+                }
+#endif
+                plane += 4 * i;
+                for (; i < width_half; i++) {
                     READ_TWO_RGB_PIXELS;
                     /* U Y V Y1 */
                     *plane++ = MAKE_U(R, G, B);
@@ -902,7 +2081,24 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
             }
         } else if (dst_format == SDL_PIXELFORMAT_YVYU) {
             for (j = 0; j < height; j++) {
-                for (i = 0; i < width_half; i++) {
+                i = 0;
+#ifdef SDL_AVX2_INTRINSICS
+                if (use_AVX2) {
+                    i = RGBToPacked4Row_AVX2(curr_row, plane, width_half, dst_format, &avx2);
+                }
+#endif
+#ifdef __SSE2__
+                if (use_SSE2) {
+                    i += RGBToPacked4Row_SSE2(curr_row + 2 * i * bpp, plane + 4 * i, width_half - i, dst_format, &sse2);
+                }
+#endif
+#ifdef HAVE_NEON_INTRINSICS
+                if (use_NEON) {
+                    i += RGBToPacked4Row_NEON(curr_row + 2 * i * bpp, plane + 4 * i, width_half - i, dst_format, &neon);
+                }
+#endif
+                plane += 4 * i;
+                for (; i < width_half; i++) {
                     READ_TWO_RGB_PIXELS;
                     /* Y V Y1 U */
                     *plane++ = MAKE_Y(r, g, b);
@@ -930,6 +2126,7 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
 #undef MAKE_Y
 #undef MAKE_U
 #undef MAKE_V
+#undef CHANNEL
 #undef READ_2x2_PIXELS
 #undef READ_2x1_PIXELS
 #undef READ_1x2_PIXELS
@@ -943,35 +2140,14 @@ int SDL_ConvertPixels_RGB_to_YUV(int width, int height,
                                  Uint32 src_format, const void *src, int src_pitch,
                                  Uint32 dst_format, void *dst, int dst_pitch)
 {
-#if 0 /* Doesn't handle odd widths */
-    /* RGB24 to FOURCC */
-    if (src_format == SDL_PIXELFORMAT_RGB24) {
-        Uint8 *y;
-        Uint8 *u;
-        Uint8 *v;
-        Uint32 y_stride;
-        Uint32 uv_stride;
-        YCbCrType yuv_type;
-
-        if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch, (const Uint8 **)&y, (const Uint8 **)&u, (const Uint8 **)&v, &y_stride, &uv_stride) < 0) {
-            return -1;
-        }
+    RGB2YUVLayout layout;
 
-        if (GetYUVConversionType(width, height, &yuv_type) < 0) {
-            return -1;
-        }
-
-        rgb24_yuv420_std(width, height, src, src_pitch, y, u, v, y_stride, uv_stride, yuv_type);
-        return 0;
-    }
-#endif
-
-    /* ARGB8888 to FOURCC */
-    if (src_format == SDL_PIXELFORMAT_ARGB8888) {
-        return SDL_ConvertPixels_ARGB8888_to_YUV(width, height, src, src_pitch, dst_format, dst, dst_pitch);
+    /* 24 and 32-bit RGB to FOURCC */
+    if (GetRGB2YUVLayout(src_format, &layout)) {
+        return SDL_ConvertPixels_RGB_to_YUV_Direct(width, height, &layout, src, src_pitch, dst_format, dst, dst_pitch);
     }
 
-    /* not ARGB8888 to FOURCC : need an intermediate conversion */
+    /* other RGB formats to FOURCC : need an intermediate conversion */
     {
         int ret;
         void *tmp;
@@ -990,7 +2166,8 @@ int SDL_ConvertPixels_RGB_to_YUV(int width, int height,
         }
 
         /* convert tmp/ARGB8888 to dst/FOURCC */
-        ret = SDL_ConvertPixels_ARGB8888_to_YUV(width, height, tmp, tmp_pitch, dst_format, dst, dst_pitch);
+        GetRGB2YUVLayout(SDL_PIXELFORMAT_ARGB8888, &layout);
+        ret = SDL_ConvertPixels_RGB_to_YUV_Direct(width, height, &layout, tmp, tmp_pitch, dst_format, dst, dst_pitch);
         SDL_free(tmp);
         return ret;
     }
@@ -1393,6 +2570,55 @@ static int SDL_ConvertPixels_Planar2x2_to_Planar2x2(int width, int height,
 
 #endif
 
+/* Byte i of the order is the source byte for destination byte i of each 4 byte group */
+#define PACKED4_ORDER(b0, b1, b2, b3) ((Uint32)(b0) | ((Uint32)(b1) << 8) | ((Uint32)(b2) << 16) | ((Uint32)(b3) << 24))
+
+/* SDL doesn't have a separate SSSE3 check, so the pshufb path is gated on SSE 4.1 */
+#ifdef SDL_SSE4_1_INTRINSICS
+SDL_TARGETING("sse4.1") static int Packed4ToPacked4Row_SSE41(const Uint8 *src, Uint8 *dst, int count, Uint32 order)
+{
+    const __m128i shuffle = _mm_add_epi8(_mm_set1_epi32((int)order), _mm_setr_epi32(0, 0x04040404, 0x08080808, 0x0C0C0C0C));
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        const __m128i yuv = _mm_loadu_si128((const __m128i *)(src + 4 * i));
+        _mm_storeu_si128((__m128i *)(dst + 4 * i), _mm_shuffle_epi8(yuv, shuffle));
+    }
+    return i;
+}
+
+#define PACKED4_TO_PACKED4_ROW_SSE41(order)                                   \
+    {                                                                         \
+        const int done = Packed4ToPacked4Row_SSE41(srcYUV, dstYUV, x, order); \
+        srcYUV += 4 * done;                                                   \
+        dstYUV += 4 * done;                                                   \
+        x -= done;                                                            \
+    }
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+SDL_TARGETING("avx2") static int Packed4ToPacked4Row_AVX2(const Uint8 *src, Uint8 *dst, int count, Uint32 order)
+{
+    const __m256i shuffle = _mm256_add_epi8(_mm256_set1_epi32((int)order),
+                                            _mm256_setr_epi32(0, 0x04040404, 0x08080808, 0x0C0C0C0C, 0, 0x04040404, 0x08080808, 0x0C0C0C0C));
+    int i;
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        const __m256i yuv = _mm256_loadu_si256((const __m256i *)(src + 4 * i));
+        _mm256_storeu_si256((__m256i *)(dst + 4 * i), _mm256_shuffle_epi8(yuv, shuffle));
+    }
+    return i;
+}
+
+#define PACKED4_TO_PACKED4_ROW_AVX2(order)                                   \
+    {                                                                        \
+        const int done = Packed4ToPacked4Row_AVX2(srcYUV, dstYUV, x, order); \
+        srcYUV += 4 * done;                                                  \
+        dstYUV += 4 * done;                                                  \
+        x -= done;                                                           \
+    }
+#endif
+
 static int SDL_ConvertPixels_YUY2_to_UYVY(int width, int height, const void *src, int src_pitch, void *dst, int dst_pitch)
 {
     int x, y;
@@ -1401,6 +2627,12 @@ static int SDL_ConvertPixels_YUY2_to_UYVY(int width, int height, const void *src
     const int dstYUVPitchLeft = (dst_pitch - YUVwidth * 4);
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    const SDL_bool use_SSE41 = SDL_HasSSE41();
+#endif
 #ifdef __SSE2__
     const SDL_bool use_SSE2 = SDL_HasSSE2();
 #endif
@@ -1408,6 +2640,16 @@ static int SDL_ConvertPixels_YUY2_to_UYVY(int width, int height, const void *src
     y = height;
     while (y--) {
         x = YUVwidth;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            PACKED4_TO_PACKED4_ROW_AVX2(PACKED4_ORDER(1, 0, 3, 2));
+        }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (use_SSE41) {
+            PACKED4_TO_PACKED4_ROW_SSE41(PACKED4_ORDER(1, 0, 3, 2));
+        }
+#endif
 #ifdef __SSE2__
         if (use_SSE2) {
             PACKED4_TO_PACKED4_ROW_SSE2(_MM_SHUFFLE(2, 3, 0, 1));
@@ -1442,6 +2684,12 @@ static int SDL_ConvertPixels_YUY2_to_YVYU(int width, int height, const void *src
     const int dstYUVPitchLeft = (dst_pitch - YUVwidth * 4);
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    const SDL_bool use_SSE41 = SDL_HasSSE41();
+#endif
 #ifdef __SSE2__
     const SDL_bool use_SSE2 = SDL_HasSSE2();
 #endif
@@ -1449,6 +2697,16 @@ static int SDL_ConvertPixels_YUY2_to_YVYU(int width, int height, const void *src
     y = height;
     while (y--) {
         x = YUVwidth;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            PACKED4_TO_PACKED4_ROW_AVX2(PACKED4_ORDER(0, 3, 2, 1));
+        }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (use_SSE41) {
+            PACKED4_TO_PACKED4_ROW_SSE41(PACKED4_ORDER(0, 3, 2, 1));
+        }
+#endif
 #ifdef __SSE2__
         if (use_SSE2) {
             PACKED4_TO_PACKED4_ROW_SSE2(_MM_SHUFFLE(1, 2, 3, 0));
@@ -1483,6 +2741,12 @@ static int SDL_ConvertPixels_UYVY_to_YUY2(int width, int height, const void *src
     const int dstYUVPitchLeft = (dst_pitch - YUVwidth * 4);
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    const SDL_bool use_SSE41 = SDL_HasSSE41();
+#endif
 #ifdef __SSE2__
     const SDL_bool use_SSE2 = SDL_HasSSE2();
 #endif
@@ -1490,6 +2754,16 @@ static int SDL_ConvertPixels_UYVY_to_YUY2(int width, int height, const void *src
     y = height;
     while (y--) {
         x = YUVwidth;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            PACKED4_TO_PACKED4_ROW_AVX2(PACKED4_ORDER(1, 0, 3, 2));
+        }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (use_SSE41) {
+            PACKED4_TO_PACKED4_ROW_SSE41(PACKED4_ORDER(1, 0, 3, 2));
+        }
+#endif
 #ifdef __SSE2__
         if (use_SSE2) {
             PACKED4_TO_PACKED4_ROW_SSE2(_MM_SHUFFLE(2, 3, 0, 1));
@@ -1524,6 +2798,12 @@ static int SDL_ConvertPixels_UYVY_to_YVYU(int width, int height, const void *src
     const int dstYUVPitchLeft = (dst_pitch - YUVwidth * 4);
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    const SDL_bool use_SSE41 = SDL_HasSSE41();
+#endif
 #ifdef __SSE2__
     const SDL_bool use_SSE2 = SDL_HasSSE2();
 #endif
@@ -1531,6 +2811,16 @@ static int SDL_ConvertPixels_UYVY_to_YVYU(int width, int height, const void *src
     y = height;
     while (y--) {
         x = YUVwidth;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            PACKED4_TO_PACKED4_ROW_AVX2(PACKED4_ORDER(1, 2, 3, 0));
+        }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (use_SSE41) {
+            PACKED4_TO_PACKED4_ROW_SSE41(PACKED4_ORDER(1, 2, 3, 0));
+        }
+#endif
 #ifdef __SSE2__
         if (use_SSE2) {
             PACKED4_TO_PACKED4_ROW_SSE2(_MM_SHUFFLE(0, 3, 2, 1));
@@ -1565,6 +2855,12 @@ static int SDL_ConvertPixels_YVYU_to_YUY2(int width, int height, const void *src
     const int dstYUVPitchLeft = (dst_pitch - YUVwidth * 4);
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    const SDL_bool use_SSE41 = SDL_HasSSE41();
+#endif
 #ifdef __SSE2__
     const SDL_bool use_SSE2 = SDL_HasSSE2();
 #endif
@@ -1572,6 +2868,16 @@ static int SDL_ConvertPixels_YVYU_to_YUY2(int width, int height, const void *src
     y = height;
     while (y--) {
         x = YUVwidth;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            PACKED4_TO_PACKED4_ROW_AVX2(PACKED4_ORDER(0, 3, 2, 1));
+        }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (use_SSE41) {
+            PACKED4_TO_PACKED4_ROW_SSE41(PACKED4_ORDER(0, 3, 2, 1));
+        }
+#endif
 #ifdef __SSE2__
         if (use_SSE2) {
             PACKED4_TO_PACKED4_ROW_SSE2(_MM_SHUFFLE(1, 2, 3, 0));
@@ -1606,6 +2912,12 @@ static int SDL_ConvertPixels_YVYU_to_UYVY(int width, int height, const void *src
     const int dstYUVPitchLeft = (dst_pitch - YUVwidth * 4);
     const Uint8 *srcYUV = (const Uint8 *)src;
     Uint8 *dstYUV = (Uint8 *)dst;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    const SDL_bool use_SSE41 = SDL_HasSSE41();
+#endif
 #ifdef __SSE2__
     const SDL_bool use_SSE2 = SDL_HasSSE2();
 #endif
@@ -1613,6 +2925,16 @@ static int SDL_ConvertPixels_YVYU_to_UYVY(int width, int height, const void *src
     y = height;
     while (y--) {
         x = YUVwidth;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            PACKED4_TO_PACKED4_ROW_AVX2(PACKED4_ORDER(3, 0, 1, 2));
+        }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+        if (use_SSE41) {
+            PACKED4_TO_PACKED4_ROW_SSE41(PACKED4_ORDER(3, 0, 1, 2));
+        }
+#endif
 #ifdef __SSE2__
         if (use_SSE2) {
             PACKED4_TO_PACKED4_ROW_SSE2(_MM_SHUFFLE(2, 1, 0, 3));
@@ -1681,6 +3003,256 @@ static int SDL_ConvertPixels_Packed4_to_Packed4(int width, int height,
                         SDL_GetPixelFormatName(dst_format));
 }
 
+/* The planar <-> packed row helpers below work on pairs of pixels, starting at
+   pair x and returning the first pair they didn't convert. The chroma pointers
+   are given in the order the packed format stores them, and a NULL second row
+   converts a single row. */
+
+#ifdef __SSE2__
+#define SWAP_BYTES_SSE2(v) _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8))
+
+/* The truncating average of two vectors of bytes, like (a + b) / 2 */
+#define AVERAGE_BYTES_SSE2(a, b) \
+    _mm_add_epi8(_mm_and_si128(a, b), _mm_and_si128(_mm_srli_epi16(_mm_xor_si128(a, b), 1), _mm_set1_epi8(0x7F)))
+
+static SDL_INLINE void Planar2x2ToPacked4Store_SSE2(Uint8 *dst, const Uint8 *srcY, __m128i c_lo, __m128i c_hi, SDL_bool y_first)
+{
+    const __m128i y_lo = _mm_loadu_si128((const __m128i *)srcY);
+    const __m128i y_hi = _mm_loadu_si128((const __m128i *)(srcY + 16));
+
+    if (y_first) {
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(y_lo, c_lo));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(y_lo, c_lo));
+        _mm_storeu_si128((__m128i *)(dst + 32), _mm_unpacklo_epi8(y_hi, c_hi));
+        _mm_storeu_si128((__m128i *)(dst + 48), _mm_unpackhi_epi8(y_hi, c_hi));
+    } else {
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(c_lo, y_lo));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(c_lo, y_lo));
+        _mm_storeu_si128((__m128i *)(dst + 32), _mm_unpacklo_epi8(c_hi, y_hi));
+        _mm_storeu_si128((__m128i *)(dst + 48), _mm_unpackhi_epi8(c_hi, y_hi));
+    }
+}
+
+static int Planar2x2ToPacked4Rows_SSE2(const Uint8 *srcY1, const Uint8 *srcY2, const Uint8 *srcC1, const Uint8 *srcC2, SDL_bool interleaved,
+                                       Uint8 *dst1, Uint8 *dst2, SDL_bool y_first, int x, int count)
+{
+    const Uint8 *srcC = SDL_min(srcC1, srcC2);
+    const SDL_bool swap = (srcC1 > srcC2);
+
+    for (; x + 16 <= count; x += 16) {
+        __m128i c_lo, c_hi;
+
+        if (interleaved) {
+            c_lo = _mm_loadu_si128((const __m128i *)(srcC + 2 * x));
+            c_hi = _mm_loadu_si128((const __m128i *)(srcC + 2 * x + 16));
+            if (swap) {
+                c_lo = SWAP_BYTES_SSE2(c_lo);
+                c_hi = SWAP_BYTES_SSE2(c_hi);
+            }
+        } else {
+            const __m128i c1 = _mm_loadu_si128((const __m128i *)(srcC1 + x));
+            const __m128i c2 = _mm_loadu_si128((const __m128i *)(srcC2 + x));
+            c_lo = _mm_unpacklo_epi8(c1, c2);
+            c_hi = _mm_unpackhi_epi8(c1, c2);
+        }
+        Planar2x2ToPacked4Store_SSE2(dst1 + 4 * x, srcY1 + 2 * x, c_lo, c_hi, y_first);
+        if (srcY2) {
+            Planar2x2ToPacked4Store_SSE2(dst2 + 4 * x, srcY2 + 2 * x, c_lo, c_hi, y_first);
+        }
+    }
+    return x;
+}
+
+/* Split 16 packed pairs into 32 luma bytes and 16 interleaved chroma pairs */
+static SDL_INLINE void Packed4Split_SSE2(const Uint8 *src, SDL_bool y_first, __m128i *y_lo, __m128i *y_hi, __m128i *c_lo, __m128i *c_hi)
+{
+    const __m128i mask = _mm_set1_epi16(0x00FF);
+    const __m128i a0 = _mm_loadu_si128((const __m128i *)src);
+    const __m128i a1 = _mm_loadu_si128((const __m128i *)(src + 16));
+    const __m128i a2 = _mm_loadu_si128((const __m128i *)(src + 32));
+    const __m128i a3 = _mm_loadu_si128((const __m128i *)(src + 48));
+    const __m128i even_lo = _mm_packus_epi16(_mm_and_si128(a0, mask), _mm_and_si128(a1, mask));
+    const __m128i even_hi = _mm_packus_epi16(_mm_and_si128(a2, mask), _mm_and_si128(a3, mask));
+    const __m128i odd_lo = _mm_packus_epi16(_mm_srli_epi16(a0, 8), _mm_srli_epi16(a1, 8));
+    const __m128i odd_hi = _mm_packus_epi16(_mm_srli_epi16(a2, 8), _mm_srli_epi16(a3, 8));
+
+    if (y_first) {
+        *y_lo = even_lo;
+        *y_hi = even_hi;
+        *c_lo = odd_lo;
+        *c_hi = odd_hi;
+    } else {
+        *y_lo = odd_lo;
+        *y_hi = odd_hi;
+        *c_lo = even_lo;
+        *c_hi = even_hi;
+    }
+}
+
+static int Packed4ToPlanar2x2Rows_SSE2(const Uint8 *src1, const Uint8 *src2, SDL_bool y_first,
+                                       Uint8 *dstY1, Uint8 *dstY2, Uint8 *dstC1, Uint8 *dstC2, SDL_bool interleaved, int x, int count)
+{
+    const __m128i mask = _mm_set1_epi16(0x00FF);
+    Uint8 *dstC = SDL_min(dstC1, dstC2);
+    const SDL_bool swap = (dstC1 > dstC2);
+
+    for (; x + 16 <= count; x += 16) {
+        __m128i y_lo, y_hi, c_lo, c_hi;
+
+        Packed4Split_SSE2(src1 + 4 * x, y_first, &y_lo, &y_hi, &c_lo, &c_hi);
+        _mm_storeu_si128((__m128i *)(dstY1 + 2 * x), y_lo);
+        _mm_storeu_si128((__m128i *)(dstY1 + 2 * x + 16), y_hi);
+        if (src2) {
+            __m128i c2_lo, c2_hi;
+
+            Packed4Split_SSE2(src2 + 4 * x, y_first, &y_lo, &y_hi, &c2_lo, &c2_hi);
+            _mm_storeu_si128((__m128i *)(dstY2 + 2 * x), y_lo);
+            _mm_storeu_si128((__m128i *)(dstY2 + 2 * x + 16), y_hi);
+            c_lo = AVERAGE_BYTES_SSE2(c_lo, c2_lo);
+            c_hi = AVERAGE_BYTES_SSE2(c_hi, c2_hi);
+        }
+
+        if (interleaved) {
+            if (swap) {
+                c_lo = SWAP_BYTES_SSE2(c_lo);
+                c_hi = SWAP_BYTES_SSE2(c_hi);
+            }
+            _mm_storeu_si128((__m128i *)(dstC + 2 * x), c_lo);
+            _mm_storeu_si128((__m128i *)(dstC + 2 * x + 16), c_hi);
+        } else {
+            _mm_storeu_si128((__m128i *)(dstC1 + x), _mm_packus_epi16(_mm_and_si128(c_lo, mask), _mm_and_si128(c_hi, mask)));
+            _mm_storeu_si128((__m128i *)(dstC2 + x), _mm_packus_epi16(_mm_srli_epi16(c_lo, 8), _mm_srli_epi16(c_hi, 8)));
+        }
+    }
+    return x;
+}
+#endif /* __SSE2__ */
+
+#ifdef SDL_AVX2_INTRINSICS
+#define SWAP_BYTES_AVX2(v) _mm256_or_si256(_mm256_slli_epi16(v, 8), _mm256_srli_epi16(v, 8))
+
+#define AVERAGE_BYTES_AVX2(a, b) \
+    _mm256_add_epi8(_mm256_and_si256(a, b), _mm256_and_si256(_mm256_srli_epi16(_mm256_xor_si256(a, b), 1), _mm256_set1_epi8(0x7F)))
+
+/* The in-lane unpack and pack instructions work on 128-bit halves, so the
+   64-bit quarters are reordered with 0xD8 (0, 2, 1, 3) around them. */
+SDL_TARGETING("avx2") static SDL_INLINE void Planar2x2ToPacked4Store_AVX2(Uint8 *dst, const Uint8 *srcY, __m256i c_lo, __m256i c_hi, SDL_bool y_first)
+{
+    const __m256i y_lo = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *)srcY), 0xD8);
+    const __m256i y_hi = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *)(srcY + 32)), 0xD8);
+
+    c_lo = _mm256_permute4x64_epi64(c_lo, 0xD8);
+    c_hi = _mm256_permute4x64_epi64(c_hi, 0xD8);
+    if (y_first) {
+        _mm256_storeu_si256((__m256i *)dst, _mm256_unpacklo_epi8(y_lo, c_lo));
+        _mm256_storeu_si256((__m256i *)(dst + 32), _mm256_unpackhi_epi8(y_lo, c_lo));
+        _mm256_storeu_si256((__m256i *)(dst + 64), _mm256_unpacklo_epi8(y_hi, c_hi));
+        _mm256_storeu_si256((__m256i *)(dst + 96), _mm256_unpackhi_epi8(y_hi, c_hi));
+    } else {
+        _mm256_storeu_si256((__m256i *)dst, _mm256_unpacklo_epi8(c_lo, y_lo));
+        _mm256_storeu_si256((__m256i *)(dst + 32), _mm256_unpackhi_epi8(c_lo, y_lo));
+        _mm256_storeu_si256((__m256i *)(dst + 64), _mm256_unpacklo_epi8(c_hi, y_hi));
+        _mm256_storeu_si256((__m256i *)(dst + 96), _mm256_unpackhi_epi8(c_hi, y_hi));
+    }
+}
+
+SDL_TARGETING("avx2") static int Planar2x2ToPacked4Rows_AVX2(const Uint8 *srcY1, const Uint8 *srcY2, const Uint8 *srcC1, const Uint8 *srcC2, SDL_bool interleaved,
+                                                             Uint8 *dst1, Uint8 *dst2, SDL_bool y_first, int x, int count)
+{
+    const Uint8 *srcC = SDL_min(srcC1, srcC2);
+    const SDL_bool swap = (srcC1 > srcC2);
+
+    for (; x + 32 <= count; x += 32) {
+        __m256i c_lo, c_hi;
+
+        if (interleaved) {
+            c_lo = _mm256_loadu_si256((const __m256i *)(srcC + 2 * x));
+            c_hi = _mm256_loadu_si256((const __m256i *)(srcC + 2 * x + 32));
+            if (swap) {
+                c_lo = SWAP_BYTES_AVX2(c_lo);
+                c_hi = SWAP_BYTES_AVX2(c_hi);
+            }
+        } else {
+            const __m256i c1 = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *)(srcC1 + x)), 0xD8);
+            const __m256i c2 = _mm256_permute4x64_epi64(_mm256_loadu_si256((const __m256i *)(srcC2 + x)), 0xD8);
+            c_lo = _mm256_unpacklo_epi8(c1, c2);
+            c_hi = _mm256_unpackhi_epi8(c1, c2);
+        }
+        Planar2x2ToPacked4Store_AVX2(dst1 + 4 * x, srcY1 + 2 * x, c_lo, c_hi, y_first);
+        if (srcY2) {
+            Planar2x2ToPacked4Store_AVX2(dst2 + 4 * x, srcY2 + 2 * x, c_lo, c_hi, y_first);
+        }
+    }
+    return x;
+}
+
+/* Split 32 packed pairs into 64 luma bytes and 32 interleaved chroma pairs */
+SDL_TARGETING("avx2") static SDL_INLINE void Packed4Split_AVX2(const Uint8 *src, SDL_bool y_first, __m256i *y_lo, __m256i *y_hi, __m256i *c_lo, __m256i *c_hi)
+{
+    const __m256i mask = _mm256_set1_epi16(0x00FF);
+    const __m256i a0 = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i a1 = _mm256_loadu_si256((const __m256i *)(src + 32));
+    const __m256i a2 = _mm256_loadu_si256((const __m256i *)(src + 64));
+    const __m256i a3 = _mm256_loadu_si256((const __m256i *)(src + 96));
+    const __m256i even_lo = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(a0, mask), _mm256_and_si256(a1, mask)), 0xD8);
+    const __m256i even_hi = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_and_si256(a2, mask), _mm256_and_si256(a3, mask)), 0xD8);
+    const __m256i odd_lo = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_srli_epi16(a0, 8), _mm256_srli_epi16(a1, 8)), 0xD8);
+    const __m256i odd_hi = _mm256_permute4x64_epi64(_mm256_packus_epi16(_mm256_srli_epi16(a2, 8), _mm256_srli_epi16(a3, 8)), 0xD8);
+
+    if (y_first) {
+        *y_lo = even_lo;
+        *y_hi = even_hi;
+        *c_lo = odd_lo;
+        *c_hi = odd_hi;
+    } else {
+        *y_lo = odd_lo;
+        *y_hi = odd_hi;
+        *c_lo = even_lo;
+        *c_hi = even_hi;
+    }
+}
+
+SDL_TARGETING("avx2") static int Packed4ToPlanar2x2Rows_AVX2(const Uint8 *src1, const Uint8 *src2, SDL_bool y_first,
+                                                             Uint8 *dstY1, Uint8 *dstY2, Uint8 *dstC1, Uint8 *dstC2, SDL_bool interleaved, int x, int count)
+{
+    const __m256i mask = _mm256_set1_epi16(0x00FF);
+    Uint8 *dstC = SDL_min(dstC1, dstC2);
+    const SDL_bool swap = (dstC1 > dstC2);
+
+    for (; x + 32 <= count; x += 32) {
+        __m256i y_lo, y_hi, c_lo, c_hi;
+
+        Packed4Split_AVX2(src1 + 4 * x, y_first, &y_lo, &y_hi, &c_lo, &c_hi);
+        _mm256_storeu_si256((__m256i *)(dstY1 + 2 * x), y_lo);
+        _mm256_storeu_si256((__m256i *)(dstY1 + 2 * x + 32), y_hi);
+        if (src2) {
+            __m256i c2_lo, c2_hi;
+
+            Packed4Split_AVX2(src2 + 4 * x, y_first, &y_lo, &y_hi, &c2_lo, &c2_hi);
+            _mm256_storeu_si256((__m256i *)(dstY2 + 2 * x), y_lo);
+            _mm256_storeu_si256((__m256i *)(dstY2 + 2 * x + 32), y_hi);
+            c_lo = AVERAGE_BYTES_AVX2(c_lo, c2_lo);
+            c_hi = AVERAGE_BYTES_AVX2(c_hi, c2_hi);
+        }
+
+        if (interleaved) {
+            if (swap) {
+                c_lo = SWAP_BYTES_AVX2(c_lo);
+                c_hi = SWAP_BYTES_AVX2(c_hi);
+            }
+            _mm256_storeu_si256((__m256i *)(dstC + 2 * x), c_lo);
+            _mm256_storeu_si256((__m256i *)(dstC + 2 * x + 32), c_hi);
+        } else {
+            const __m256i c1 = _mm256_packus_epi16(_mm256_and_si256(c_lo, mask), _mm256_and_si256(c_hi, mask));
+            const __m256i c2 = _mm256_packus_epi16(_mm256_srli_epi16(c_lo, 8), _mm256_srli_epi16(c_hi, 8));
+            _mm256_storeu_si256((__m256i *)(dstC1 + x), _mm256_permute4x64_epi64(c1, 0xD8));
+            _mm256_storeu_si256((__m256i *)(dstC2 + x), _mm256_permute4x64_epi64(c2, 0xD8));
+        }
+    }
+    return x;
+}
+#endif /* SDL_AVX2_INTRINSICS */
+
 static int SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
                                                   Uint32 src_format, const void *src, int src_pitch,
                                                   Uint32 dst_format, void *dst, int dst_pitch)
@@ -1692,6 +3264,16 @@ static int SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
     Uint8 *dstY1, *dstY2, *dstU1, *dstU2, *dstV1, *dstV2;
     Uint32 dstY_pitch, dstUV_pitch;
     Uint32 dst_pitch_left;
+    const Uint8 *srcC1, *srcC2;
+    Uint8 *dst1, *dst2;
+    SDL_bool interleaved, y_first;
+    const int pairs = width / 2;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef __SSE2__
+    const SDL_bool use_SSE2 = SDL_HasSSE2();
+#endif
 
     if (src == dst) {
         return SDL_SetError("Can't change YUV plane types in-place");
@@ -1704,7 +3286,8 @@ static int SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
     srcY2 = srcY1 + srcY_pitch;
     srcY_pitch_left = (srcY_pitch - width);
 
-    if (src_format == SDL_PIXELFORMAT_NV12 || src_format == SDL_PIXELFORMAT_NV21) {
+    interleaved = (src_format == SDL_PIXELFORMAT_NV12 || src_format == SDL_PIXELFORMAT_NV21);
+    if (interleaved) {
         srcUV_pixel_stride = 2;
         srcUV_pitch_left = (srcUV_pitch - 2 * ((width + 1) / 2));
     } else {
@@ -1721,10 +3304,37 @@ static int SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
     dstU2 = dstU1 + dstUV_pitch;
     dstV2 = dstV1 + dstUV_pitch;
     dst_pitch_left = (dstY_pitch - 4 * ((width + 1) / 2));
+    y_first = (dstY1 < dstU1);
 
-    /* Copy 2x2 blocks of pixels at a time */
     for (y = 0; y < (height - 1); y += 2) {
-        for (x = 0; x < (width - 1); x += 2) {
+        x = 0;
+        srcC1 = (dstU1 < dstV1) ? srcU : srcV;
+        srcC2 = (dstU1 < dstV1) ? srcV : srcU;
+        dst1 = y_first ? dstY1 : dstU1;
+        dst2 = y_first ? dstY2 : dstU2;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            x = Planar2x2ToPacked4Rows_AVX2(srcY1, srcY2, srcC1, srcC2, interleaved, dst1, dst2, y_first, x, pairs);
+        }
+#endif
+#ifdef __SSE2__
+        if (use_SSE2) {
+            x = Planar2x2ToPacked4Rows_SSE2(srcY1, srcY2, srcC1, srcC2, interleaved, dst1, dst2, y_first, x, pairs);
+        }
+#endif
+        srcY1 += 2 * x;
+        srcY2 += 2 * x;
+        srcU += x * srcUV_pixel_stride;
+        srcV += x * srcUV_pixel_stride;
+        dstY1 += 4 * x;
+        dstY2 += 4 * x;
+        dstU1 += 4 * x;
+        dstU2 += 4 * x;
+        dstV1 += 4 * x;
+        dstV2 += 4 * x;
+
+        /* Copy 2x2 blocks of pixels at a time */
+        for (x *= 2; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1 = *srcY1++;
             dstY1 += 2;
@@ -1789,7 +3399,28 @@ static int SDL_ConvertPixels_Planar2x2_to_Packed4(int width, int height,
 
     /* Last row */
     if (y == (height - 1)) {
-        for (x = 0; x < (width - 1); x += 2) {
+        x = 0;
+        srcC1 = (dstU1 < dstV1) ? srcU : srcV;
+        srcC2 = (dstU1 < dstV1) ? srcV : srcU;
+        dst1 = y_first ? dstY1 : dstU1;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            x = Planar2x2ToPacked4Rows_AVX2(srcY1, NULL, srcC1, srcC2, interleaved, dst1, NULL, y_first, x, pairs);
+        }
+#endif
+#ifdef __SSE2__
+        if (use_SSE2) {
+            x = Planar2x2ToPacked4Rows_SSE2(srcY1, NULL, srcC1, srcC2, interleaved, dst1, NULL, y_first, x, pairs);
+        }
+#endif
+        srcY1 += 2 * x;
+        srcU += x * srcUV_pixel_stride;
+        srcV += x * srcUV_pixel_stride;
+        dstY1 += 4 * x;
+        dstU1 += 4 * x;
+        dstV1 += 4 * x;
+
+        for (x *= 2; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1 = *srcY1++;
             dstY1 += 2;
@@ -1834,6 +3465,16 @@ static int SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     Uint8 *dstY1, *dstY2, *dstU, *dstV;
     Uint32 dstY_pitch, dstUV_pitch;
     Uint32 dstY_pitch_left, dstUV_pitch_left, dstUV_pixel_stride;
+    const Uint8 *src1, *src2;
+    Uint8 *dstC1, *dstC2;
+    SDL_bool interleaved, y_first;
+    const int pairs = width / 2;
+#ifdef SDL_AVX2_INTRINSICS
+    const SDL_bool use_AVX2 = SDL_HasAVX2();
+#endif
+#ifdef __SSE2__
+    const SDL_bool use_SSE2 = SDL_HasSSE2();
+#endif
 
     if (src == dst) {
         return SDL_SetError("Can't change YUV plane types in-place");
@@ -1847,6 +3488,7 @@ static int SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     srcU2 = srcU1 + srcUV_pitch;
     srcV2 = srcV1 + srcUV_pitch;
     src_pitch_left = (srcY_pitch - 4 * ((width + 1) / 2));
+    y_first = (srcY1 < srcU1);
 
     if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
                      (const Uint8 **)&dstY1, (const Uint8 **)&dstU, (const Uint8 **)&dstV,
@@ -1856,7 +3498,8 @@ static int SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
     dstY2 = dstY1 + dstY_pitch;
     dstY_pitch_left = (dstY_pitch - width);
 
-    if (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21) {
+    interleaved = (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21);
+    if (interleaved) {
         dstUV_pixel_stride = 2;
         dstUV_pitch_left = (dstUV_pitch - 2 * ((width + 1) / 2));
     } else {
@@ -1864,9 +3507,35 @@ static int SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
         dstUV_pitch_left = (dstUV_pitch - ((width + 1) / 2));
     }
 
-    /* Copy 2x2 blocks of pixels at a time */
     for (y = 0; y < (height - 1); y += 2) {
-        for (x = 0; x < (width - 1); x += 2) {
+        x = 0;
+        src1 = y_first ? srcY1 : srcU1;
+        src2 = y_first ? srcY2 : srcU2;
+        dstC1 = (srcU1 < srcV1) ? dstU : dstV;
+        dstC2 = (srcU1 < srcV1) ? dstV : dstU;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            x = Packed4ToPlanar2x2Rows_AVX2(src1, src2, y_first, dstY1, dstY2, dstC1, dstC2, interleaved, x, pairs);
+        }
+#endif
+#ifdef __SSE2__
+        if (use_SSE2) {
+            x = Packed4ToPlanar2x2Rows_SSE2(src1, src2, y_first, dstY1, dstY2, dstC1, dstC2, interleaved, x, pairs);
+        }
+#endif
+        srcY1 += 4 * x;
+        srcY2 += 4 * x;
+        srcU1 += 4 * x;
+        srcU2 += 4 * x;
+        srcV1 += 4 * x;
+        srcV2 += 4 * x;
+        dstY1 += 2 * x;
+        dstY2 += 2 * x;
+        dstU += x * dstUV_pixel_stride;
+        dstV += x * dstUV_pixel_stride;
+
+        /* Copy 2x2 blocks of pixels at a time */
+        for (x *= 2; x < (width - 1); x += 2) {
             /* Row 1 */
             *dstY1++ = *srcY1;
             srcY1 += 2;
@@ -1929,7 +3598,28 @@ static int SDL_ConvertPixels_Packed4_to_Planar2x2(int width, int height,
 
     /* Last row */
     if (y == (height - 1)) {
-        for (x = 0; x < (width - 1); x += 2) {
+        x = 0;
+        src1 = y_first ? srcY1 : srcU1;
+        dstC1 = (srcU1 < srcV1) ? dstU : dstV;
+        dstC2 = (srcU1 < srcV1) ? dstV : dstU;
+#ifdef SDL_AVX2_INTRINSICS
+        if (use_AVX2) {
+            x = Packed4ToPlanar2x2Rows_AVX2(src1, NULL, y_first, dstY1, NULL, dstC1, dstC2, interleaved, x, pairs);
+        }
+#endif
+#ifdef __SSE2__
+        if (use_SSE2) {
+            x = Packed4ToPlanar2x2Rows_SSE2(src1, NULL, y_first, dstY1, NULL, dstC1, dstC2, interleaved, x, pairs);
+        }
+#endif
+        srcY1 += 4 * x;
+        srcU1 += 4 * x;
+        srcV1 += 4 * x;
+        dstY1 += 2 * x;
+        dstU += x * dstUV_pixel_stride;
+        dstV += x * dstUV_pixel_stride;
+
+        for (x *= 2; x < (width - 1); x += 2) {
             *dstY1++ = *srcY1;
             srcY1 += 2;
             *dstY1++ = *srcY1;
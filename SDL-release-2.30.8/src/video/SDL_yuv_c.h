@@ -30,6 +30,9 @@ extern int SDL_ConvertPixels_YUV_to_RGB(int width, int height, Uint32 src_format
 extern int SDL_ConvertPixels_RGB_to_YUV(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch);
 extern int SDL_ConvertPixels_YUV_to_YUV(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch);
 
+/* Stops the worker threads used by SDL_HINT_YUV_CONVERSION_THREADS and stops watching the hint */
+extern void SDL_QuitYUVConversionThreads(void);
+
 
 extern int SDL_CalculateYUVSize(Uint32 format, int w, int h, size_t *size, int *pitch);
 
@@ -23,21 +23,288 @@
 #ifdef SDL_VIDEO_DRIVER_OFFSCREEN
 
 #include "../SDL_sysvideo.h"
+#include "../SDL_egl_c.h"
 #include "SDL_offscreenframebuffer_c.h"
+#include "SDL_offscreenwindow.h"
+#include "SDL_hints.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SDL_OFFSCREEN_HAVE_POSIX_SINKS 1
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 #define OFFSCREEN_SURFACE "_SDL_DummySurface"
 
+/* Number of frames kept in a shared memory ring */
+#define OFFSCREEN_RING_SLOTS 4
+
+/* The header at the start of a ring, see SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK.
+   Frame N lives in slot N % slot_count, and frame_count is incremented after
+   the frame has been written, so a reader that copied frame N out of its
+   slot still has a good copy if frame_count - N < slot_count afterwards.
+ */
+typedef struct
+{
+    char magic[8]; /* "SDLFRAME" */
+    Uint32 version;
+    Uint32 header_size;
+    Uint32 format;
+    Uint32 width;
+    Uint32 height;
+    Uint32 pitch;
+    Uint32 frame_size;
+    Uint32 slot_size;
+    Uint32 slot_count;
+    SDL_atomic_t frame_count;
+    Uint32 reserved[4];
+} OFFSCREEN_RingHeader;
+
+SDL_COMPILE_TIME_ASSERT(offscreen_ring_header, sizeof(OFFSCREEN_RingHeader) == 64);
+
+struct OFFSCREEN_FrameSink
+{
+    Uint32 format; /* SDL_PIXELFORMAT_RGB888 or SDL_PIXELFORMAT_IYUV */
+    int width;
+    int height;
+    int pitch;
+    size_t frame_size;
+    SDL_RWops *stream;
+    Uint8 *frame; /* YUV conversion buffer for streams */
+    Uint8 *ring;
+    size_t ring_size;
+};
+
+static int OpenFrameRing(OFFSCREEN_FrameSink *sink, const char *path)
+{
+#ifdef SDL_OFFSCREEN_HAVE_POSIX_SINKS
+    OFFSCREEN_RingHeader *header;
+    const size_t slot_size = (sink->frame_size + 63) & ~(size_t)63;
+    int flags = O_RDWR | O_CREAT | O_TRUNC;
+    void *ring;
+    int fd;
+
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    sink->ring_size = sizeof(*header) + OFFSCREEN_RING_SLOTS * slot_size;
+    fd = open(path, flags, 0644);
+    if (fd < 0) {
+        return SDL_SetError("Couldn't open frame ring %s", path);
+    }
+    if (ftruncate(fd, (off_t)sink->ring_size) < 0) {
+        close(fd);
+        return SDL_SetError("Couldn't size frame ring %s", path);
+    }
+    ring = mmap(NULL, sink->ring_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ring == MAP_FAILED) {
+        return SDL_SetError("Couldn't map frame ring %s", path);
+    }
+    sink->ring = (Uint8 *)ring;
+
+    header = (OFFSCREEN_RingHeader *)sink->ring;
+    header->version = 1;
+    header->header_size = sizeof(*header);
+    header->format = sink->format;
+    header->width = sink->width;
+    header->height = sink->height;
+    header->pitch = sink->pitch;
+    header->frame_size = (Uint32)sink->frame_size;
+    header->slot_size = (Uint32)slot_size;
+    header->slot_count = OFFSCREEN_RING_SLOTS;
+    SDL_AtomicSet(&header->frame_count, 0);
+    SDL_memcpy(header->magic, "SDLFRAME", sizeof(header->magic));
+    return 0;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
+static int OpenFrameStream(OFFSCREEN_FrameSink *sink, SDL_Window *window, const char *spec)
+{
+    if (SDL_strncmp(spec, "fd:", 3) == 0) {
+#ifdef SDL_OFFSCREEN_HAVE_POSIX_SINKS
+        /* Write through our own copy of the descriptor so closing the sink
+           leaves the application's descriptor alone */
+        int fd = dup(SDL_atoi(spec + 3));
+        FILE *fp = fd >= 0 ? fdopen(fd, "wb") : NULL;
+
+        if (!fp) {
+            if (fd >= 0) {
+                close(fd);
+            }
+            return SDL_SetError("Couldn't write frames to %s", spec);
+        }
+        sink->stream = SDL_RWFromFP(fp, SDL_TRUE);
+        if (!sink->stream) {
+            fclose(fp);
+        }
+#else
+        return SDL_Unsupported();
+#endif
+    } else {
+        sink->stream = SDL_RWFromFile(spec, "wb");
+    }
+    if (!sink->stream) {
+        return -1;
+    }
+
+    if (sink->format == SDL_PIXELFORMAT_IYUV) {
+        SDL_DisplayMode mode;
+        char header[128];
+        int rate = 60;
+        int length;
+
+        if (SDL_GetWindowDisplayMode(window, &mode) == 0 && mode.refresh_rate > 0) {
+            rate = mode.refresh_rate;
+        }
+        length = SDL_snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg XCOLORRANGE=%s\n",
+                              sink->width, sink->height, rate,
+                              SDL_GetYUVConversionModeForResolution(sink->width, sink->height) == SDL_YUV_CONVERSION_JPEG ? "FULL" : "LIMITED");
+        if (SDL_RWwrite(sink->stream, header, length, 1) != 1) {
+            return -1;
+        }
+
+        sink->frame = (Uint8 *)SDL_malloc(sink->frame_size);
+        if (!sink->frame) {
+            return SDL_OutOfMemory();
+        }
+    }
+    return 0;
+}
+
+static OFFSCREEN_FrameSink *OpenFrameSink(SDL_Window *window, const char *spec, int w, int h)
+{
+    const char *format = SDL_GetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAME_FORMAT);
+    OFFSCREEN_FrameSink *sink;
+    int result;
+
+    sink = (OFFSCREEN_FrameSink *)SDL_calloc(1, sizeof(*sink));
+    if (!sink) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    sink->width = w;
+    sink->height = h;
+    if (format && SDL_strcasecmp(format, "yuv") == 0) {
+        sink->format = SDL_PIXELFORMAT_IYUV;
+        sink->pitch = w;
+        sink->frame_size = (size_t)w * h + 2 * ((size_t)(w + 1) / 2) * ((h + 1) / 2);
+    } else {
+        sink->format = SDL_PIXELFORMAT_RGB888;
+        sink->pitch = w * 4;
+        sink->frame_size = (size_t)sink->pitch * h;
+    }
+
+    if (SDL_strncmp(spec, "ring:", 5) == 0) {
+        result = OpenFrameRing(sink, spec + 5);
+    } else {
+        result = OpenFrameStream(sink, window, spec);
+    }
+    if (result < 0) {
+        SDL_OFFSCREEN_CloseFrameSink(sink);
+        return NULL;
+    }
+    return sink;
+}
+
+static int WriteFrame(OFFSCREEN_FrameSink *sink, SDL_Surface *surface)
+{
+    if (sink->ring) {
+        OFFSCREEN_RingHeader *header = (OFFSCREEN_RingHeader *)sink->ring;
+        const int frame = SDL_AtomicGet(&header->frame_count);
+        Uint8 *slot = sink->ring + header->header_size + ((Uint32)frame % header->slot_count) * (size_t)header->slot_size;
+
+        if (surface->w != sink->width || surface->h != sink->height) {
+            return SDL_SetError("Frame ring is %dx%d, can't write a %dx%d frame", sink->width, sink->height, surface->w, surface->h);
+        }
+        if (SDL_ConvertPixels(surface->w, surface->h, surface->format->format, surface->pixels, surface->pitch,
+                              sink->format, slot, sink->pitch) < 0) {
+            return -1;
+        }
+        /* Publish the frame only after its pixels are in place */
+        SDL_AtomicSet(&header->frame_count, frame + 1);
+        return 0;
+    }
+
+    if (sink->format == SDL_PIXELFORMAT_IYUV) {
+        if (surface->w != sink->width || surface->h != sink->height) {
+            return SDL_SetError("Y4M stream is %dx%d, can't write a %dx%d frame", sink->width, sink->height, surface->w, surface->h);
+        }
+        if (SDL_ConvertPixels(surface->w, surface->h, surface->format->format, surface->pixels, surface->pitch,
+                              sink->format, sink->frame, sink->pitch) < 0) {
+            return -1;
+        }
+        if (SDL_RWwrite(sink->stream, "FRAME\n", 6, 1) != 1 ||
+            SDL_RWwrite(sink->stream, sink->frame, sink->frame_size, 1) != 1) {
+            return -1;
+        }
+        return 0;
+    }
+
+    /* Raw frames go out straight from the framebuffer, at whatever size it is now */
+    if (surface->pitch == surface->w * 4) {
+        if (SDL_RWwrite(sink->stream, surface->pixels, (size_t)surface->pitch * surface->h, 1) != 1) {
+            return -1;
+        }
+    } else {
+        const Uint8 *row = (const Uint8 *)surface->pixels;
+        int y;
+
+        for (y = 0; y < surface->h; ++y, row += surface->pitch) {
+            if (SDL_RWwrite(sink->stream, row, (size_t)surface->w * 4, 1) != 1) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+void SDL_OFFSCREEN_CloseFrameSink(OFFSCREEN_FrameSink *sink)
+{
+    if (!sink) {
+        return;
+    }
+    if (sink->stream) {
+        SDL_RWclose(sink->stream);
+    }
+#ifdef SDL_OFFSCREEN_HAVE_POSIX_SINKS
+    if (sink->ring) {
+        munmap(sink->ring, sink->ring_size);
+    }
+#endif
+    SDL_free(sink->frame);
+    SDL_free(sink);
+}
+
 int SDL_OFFSCREEN_CreateWindowFramebuffer(_THIS, SDL_Window *window, Uint32 *format, void **pixels, int *pitch)
 {
+    OFFSCREEN_Window *offscreen_window = (OFFSCREEN_Window *)window->driverdata;
     SDL_Surface *surface;
     const Uint32 surface_format = SDL_PIXELFORMAT_RGB888;
+    const char *spec;
     int w, h;
 
     /* Free the old framebuffer surface */
     SDL_OFFSCREEN_DestroyWindowFramebuffer(_this, window);
 
-    /* Create a new one */
     SDL_GetWindowSizeInPixels(window, &w, &h);
+
+    /* Open the frame sink with the first framebuffer, so that a sink that
+       can't be opened fails here instead of on the first present */
+    spec = SDL_GetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK);
+    if (!offscreen_window->frame_sink && spec && *spec) {
+        offscreen_window->frame_sink = OpenFrameSink(window, spec, w, h);
+        if (!offscreen_window->frame_sink) {
+            return -1;
+        }
+    }
+
+    /* Create a new one */
     surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, surface_format);
     if (!surface) {
         return -1;
@@ -55,6 +322,7 @@ int SDL_OFFSCREEN_CreateWindowFramebuffer(_THIS, SDL_Window *window, Uint32 *for
 int SDL_OFFSCREEN_UpdateWindowFramebuffer(_THIS, SDL_Window *window, const SDL_Rect *rects, int numrects)
 {
     static int frame_number;
+    OFFSCREEN_Window *offscreen_window = (OFFSCREEN_Window *)window->driverdata;
     SDL_Surface *surface;
 
     surface = (SDL_Surface *)SDL_GetWindowData(window, OFFSCREEN_SURFACE);
@@ -69,6 +337,11 @@ int SDL_OFFSCREEN_UpdateWindowFramebuffer(_THIS, SDL_Window *window, const SDL_R
                            SDL_GetWindowID(window), ++frame_number);
         SDL_SaveBMP(surface, file);
     }
+
+    /* Stream the frame to the frame sink, if one was requested */
+    if (offscreen_window->frame_sink) {
+        return WriteFrame(offscreen_window->frame_sink, surface);
+    }
     return 0;
 }
 
@@ -20,8 +20,11 @@
 */
 #include "../../SDL_internal.h"
 
+struct OFFSCREEN_FrameSink;
+
 extern int SDL_OFFSCREEN_CreateWindowFramebuffer(_THIS, SDL_Window *window, Uint32 *format, void **pixels, int *pitch);
 extern int SDL_OFFSCREEN_UpdateWindowFramebuffer(_THIS, SDL_Window *window, const SDL_Rect *rects, int numrects);
 extern void SDL_OFFSCREEN_DestroyWindowFramebuffer(_THIS, SDL_Window *window);
+extern void SDL_OFFSCREEN_CloseFrameSink(struct OFFSCREEN_FrameSink *sink);
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -31,6 +31,7 @@
  */
 
 #include "SDL_video.h"
+#include "SDL_hints.h"
 
 #include "SDL_offscreenvideo.h"
 #include "SDL_offscreenevents_c.h"
@@ -55,6 +56,7 @@ static void OFFSCREEN_DeleteDevice(SDL_VideoDevice *device)
 static SDL_VideoDevice *OFFSCREEN_CreateDevice(void)
 {
     SDL_VideoDevice *device;
+    const char *hint;
 
     /* Initialize all variables that we clean on shutdown */
     device = (SDL_VideoDevice *)SDL_calloc(1, sizeof(SDL_VideoDevice));
@@ -73,6 +75,13 @@ static SDL_VideoDevice *OFFSCREEN_CreateDevice(void)
     device->DestroyWindowFramebuffer = SDL_OFFSCREEN_DestroyWindowFramebuffer;
     device->free = OFFSCREEN_DeleteDevice;
 
+    /* Frames can only be streamed from our own framebuffer, so don't let
+       window surfaces be backed by a GPU texture when a sink is requested */
+    hint = SDL_GetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK);
+    if (hint && *hint) {
+        device->no_texture_framebuffer = SDL_TRUE;
+    }
+
 #ifdef SDL_VIDEO_OPENGL_EGL
     /* GL context */
     device->GL_SwapWindow = OFFSCREEN_GLES_SwapWindow;
@@ -26,6 +26,7 @@
 #include "../SDL_egl_c.h"
 
 #include "SDL_offscreenwindow.h"
+#include "SDL_offscreenframebuffer_c.h"
 
 int OFFSCREEN_CreateWindow(_THIS, SDL_Window *window)
 {
@@ -73,6 +74,7 @@ void OFFSCREEN_DestroyWindow(_THIS, SDL_Window *window)
     OFFSCREEN_Window *offscreen_window = window->driverdata;
 
     if (offscreen_window) {
+        SDL_OFFSCREEN_CloseFrameSink(offscreen_window->frame_sink);
 #ifdef SDL_VIDEO_OPENGL_EGL
         SDL_EGL_DestroySurface(_this, offscreen_window->egl_surface);
 #endif
@@ -25,9 +25,12 @@
 
 #include "SDL_offscreenvideo.h"
 
+typedef struct OFFSCREEN_FrameSink OFFSCREEN_FrameSink;
+
 typedef struct
 {
     SDL_Window *sdl_window;
+    OFFSCREEN_FrameSink *frame_sink;
 #ifdef SDL_VIDEO_OPENGL_EGL
     EGLSurface egl_surface;
 #endif
@@ -76,6 +76,16 @@ my %get_rgba_string = (
     "BGRA8888" => $get_rgba_string_ignore_alpha{"BGRA8888"} . " _A = (Uint8)_pixel;",
 );
 
+# The byte of R, G, B and A within the pixel, low to high, for the SIMD blitters
+my %format_order = (
+    "RGB888" => "0xFF000102",
+    "BGR888" => "0xFF020100",
+    "ARGB8888" => "0x03000102",
+    "RGBA8888" => "0x00010203",
+    "ABGR8888" => "0x03020100",
+    "BGRA8888" => "0x00030201",
+);
+
 my %set_rgba_string = (
     "RGB888" => "_pixel = (_R << 16) | (_G << 8) | _B;",
     "BGR888" => "_pixel = (_B << 16) | (_G << 8) | _R;",
@@ -590,6 +600,310 @@ sub output_copyinc
 __EOF__
 }
 
+sub output_simdhelpers
+{
+    print FILE <<'__EOF__';
+#ifdef SDL_SSE4_1_INTRINSICS
+
+/* The SSE4.1 and AVX2 blitters shuffle pixels into ARGB8888 byte order, do the
+   same integer math as the C blitters on 16 bit channels, and shuffle the result
+   into the destination order. A pixel order has the byte of R, G, B and A within
+   the pixel in its low to high bytes, with 0xFF for a format without alpha. */
+typedef struct
+{
+    Uint8 src_shuffle[16];
+    Uint8 dst_shuffle[16];
+    Uint8 out_shuffle[16];
+    Uint32 src_alpha;   /* 0xFF alpha for sources without one */
+    Uint16 modulate[8]; /* B, G, R, A factors for two pixels, 255 when not modulating */
+    SDL_bool modulated;
+    int op;             /* the blend mode flags, or -1 for no blending */
+} SDL_BlitAutoSIMD;
+
+typedef void (*SDL_BlitAutoRowFunc)(const Uint32 *src, Uint32 *dst, int n, const SDL_BlitAutoSIMD *ctx);
+
+static void SDL_Blit_Auto_Setup(const SDL_BlitInfo *info, Uint32 src_order, Uint32 dst_order,
+                                SDL_bool modulate, SDL_bool blend, SDL_BlitAutoSIMD *ctx)
+{
+    static const int order_shift[4] = { 16, 8, 0, 24 }; /* B, G, R, A */
+    int i, c;
+
+    for (i = 0; i < 16; ++i) {
+        const int pixel = i & ~3;
+        const Uint8 src_byte = (Uint8)(src_order >> order_shift[i & 3]);
+        const Uint8 dst_byte = (Uint8)(dst_order >> order_shift[i & 3]);
+
+        ctx->src_shuffle[i] = (src_byte == 0xFF) ? 0x80 : (Uint8)(pixel + src_byte);
+        ctx->dst_shuffle[i] = (dst_byte == 0xFF) ? 0x80 : (Uint8)(pixel + dst_byte);
+    }
+    for (i = 0; i < 16; ++i) {
+        const int pixel = i & ~3;
+        ctx->out_shuffle[i] = 0x80;
+        for (c = 0; c < 4; ++c) {
+            if (ctx->dst_shuffle[pixel + c] == i) {
+                ctx->out_shuffle[i] = (Uint8)(pixel + c);
+            }
+        }
+    }
+    ctx->src_alpha = ((src_order >> 24) == 0xFF) ? 0xFF000000 : 0;
+
+    for (i = 0; i < 8; ++i) {
+        ctx->modulate[i] = 255;
+    }
+    if (modulate) {
+        if (info->flags & SDL_COPY_MODULATE_COLOR) {
+            ctx->modulate[0] = ctx->modulate[4] = info->b;
+            ctx->modulate[1] = ctx->modulate[5] = info->g;
+            ctx->modulate[2] = ctx->modulate[6] = info->r;
+        }
+        if (info->flags & SDL_COPY_MODULATE_ALPHA) {
+            ctx->modulate[3] = ctx->modulate[7] = info->a;
+        }
+    }
+    ctx->modulated = modulate;
+    ctx->op = blend ? (info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) : -1;
+}
+
+static void SDL_Blit_Auto_SIMD(SDL_BlitInfo *info, Uint32 src_order, Uint32 dst_order,
+                               SDL_bool modulate, SDL_bool blend, SDL_bool scale, SDL_BlitAutoRowFunc blit_row)
+{
+    SDL_BlitAutoSIMD ctx;
+    const Uint8 *src_row = info->src;
+    Uint8 *dst_row = info->dst;
+    int height = info->dst_h;
+
+    SDL_Blit_Auto_Setup(info, src_order, dst_order, modulate, blend, &ctx);
+
+    if (scale) {
+        /* Same stepping as the C blitters, gathering the source pixels a chunk at a time */
+        Uint32 buffer[64];
+        Uint64 incy = ((Uint64)info->src_h << 16) / info->dst_h;
+        Uint64 incx = ((Uint64)info->src_w << 16) / info->dst_w;
+        Uint64 posy = incy / 2;
+
+        while (height--) {
+            const Uint32 *src = (const Uint32 *)(src_row + (posy >> 16) * info->src_pitch);
+            Uint32 *dst = (Uint32 *)dst_row;
+            Uint64 posx = incx / 2;
+            int n = info->dst_w;
+
+            while (n > 0) {
+                const int count = SDL_min(n, (int)SDL_arraysize(buffer));
+                int i;
+                for (i = 0; i < count; ++i) {
+                    buffer[i] = src[posx >> 16];
+                    posx += incx;
+                }
+                blit_row(buffer, dst, count, &ctx);
+                dst += count;
+                n -= count;
+            }
+            posy += incy;
+            dst_row += info->dst_pitch;
+        }
+    } else {
+        while (height--) {
+            blit_row((const Uint32 *)src_row, (Uint32 *)dst_row, info->dst_w, &ctx);
+            src_row += info->src_pitch;
+            dst_row += info->dst_pitch;
+        }
+    }
+}
+
+/* x / 255 for x <= 255 * 255, the same as the C blitters' integer division */
+#define SDL_BLIT_AUTO_DIV255_SSE41(x) \
+    _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(x, _mm_set1_epi16(1)), _mm_srli_epi16(x, 8)), 8)
+
+/* Blend the unpacked source and destination channels of two pixels */
+SDL_TARGETING("sse4.1") static SDL_INLINE __m128i SDL_Blit_Auto_Blend_SSE41(__m128i s, __m128i d, int op)
+{
+    const __m128i ff = _mm_set1_epi16(0xFF);
+    const __m128i sa = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128i inv_sa = _mm_sub_epi16(ff, sa);
+    __m128i r;
+
+    if (op == SDL_COPY_BLEND || op == SDL_COPY_ADD) {
+        /* Premultiply the color channels */
+        s = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s, _mm_blend_epi16(sa, ff, 0x88)));
+    }
+    switch (op) {
+    case SDL_COPY_BLEND:
+        return _mm_add_epi16(s, SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(d, inv_sa)));
+    case SDL_COPY_ADD:
+        r = _mm_add_epi16(s, d);
+        break;
+    case SDL_COPY_MOD:
+        r = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s, d));
+        break;
+    case SDL_COPY_MUL:
+        /* s * d + d * (255 - sA) can be past 16 bits, clamped to where the result is 255 */
+        r = _mm_packus_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(s, inv_sa), _mm_unpacklo_epi16(d, d)),
+                             _mm_madd_epi16(_mm_unpackhi_epi16(s, inv_sa), _mm_unpackhi_epi16(d, d)));
+        r = SDL_BLIT_AUTO_DIV255_SSE41(_mm_min_epu16(r, _mm_set1_epi16((short)(255 * 255))));
+        break;
+    default:
+        return d;
+    }
+    /* Only blending changes the destination alpha */
+    return _mm_blend_epi16(r, d, 0x88);
+}
+
+SDL_TARGETING("sse4.1") static __m128i SDL_Blit_Auto_Pixels_SSE41(__m128i s, __m128i d, const SDL_BlitAutoSIMD *ctx)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i s_lo, s_hi, d_lo, d_hi;
+
+    s = _mm_shuffle_epi8(s, _mm_loadu_si128((const __m128i *)ctx->src_shuffle));
+    s = _mm_or_si128(s, _mm_set1_epi32((int)ctx->src_alpha));
+    s_lo = _mm_unpacklo_epi8(s, zero);
+    s_hi = _mm_unpackhi_epi8(s, zero);
+    if (ctx->modulated) {
+        const __m128i modulate = _mm_loadu_si128((const __m128i *)ctx->modulate);
+        s_lo = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s_lo, modulate));
+        s_hi = SDL_BLIT_AUTO_DIV255_SSE41(_mm_mullo_epi16(s_hi, modulate));
+    }
+    if (ctx->op >= 0) {
+        d = _mm_shuffle_epi8(d, _mm_loadu_si128((const __m128i *)ctx->dst_shuffle));
+        d_lo = _mm_unpacklo_epi8(d, zero);
+        d_hi = _mm_unpackhi_epi8(d, zero);
+        s_lo = SDL_Blit_Auto_Blend_SSE41(s_lo, d_lo, ctx->op);
+        s_hi = SDL_Blit_Auto_Blend_SSE41(s_hi, d_hi, ctx->op);
+    }
+    return _mm_shuffle_epi8(_mm_packus_epi16(s_lo, s_hi), _mm_loadu_si128((const __m128i *)ctx->out_shuffle));
+}
+
+SDL_TARGETING("sse4.1") static void SDL_Blit_Auto_Row_SSE41(const Uint32 *src, Uint32 *dst, int n, const SDL_BlitAutoSIMD *ctx)
+{
+    int i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+        _mm_storeu_si128((__m128i *)(dst + i), SDL_Blit_Auto_Pixels_SSE41(s, d, ctx));
+    }
+    if (i < n) {
+        Uint32 s[4] = { 0 }, d[4] = { 0 };
+        SDL_memcpy(s, src + i, (n - i) * sizeof(Uint32));
+        SDL_memcpy(d, dst + i, (n - i) * sizeof(Uint32));
+        _mm_storeu_si128((__m128i *)d, SDL_Blit_Auto_Pixels_SSE41(_mm_loadu_si128((const __m128i *)s), _mm_loadu_si128((const __m128i *)d), ctx));
+        SDL_memcpy(dst + i, d, (n - i) * sizeof(Uint32));
+    }
+}
+
+#ifdef SDL_AVX2_INTRINSICS
+
+#define SDL_BLIT_AUTO_DIV255_AVX2(x) \
+    _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(x, _mm256_set1_epi16(1)), _mm256_srli_epi16(x, 8)), 8)
+
+SDL_TARGETING("avx2") static SDL_INLINE __m256i SDL_Blit_Auto_Blend_AVX2(__m256i s, __m256i d, int op)
+{
+    const __m256i ff = _mm256_set1_epi16(0xFF);
+    const __m256i sa = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    const __m256i inv_sa = _mm256_sub_epi16(ff, sa);
+    __m256i r;
+
+    if (op == SDL_COPY_BLEND || op == SDL_COPY_ADD) {
+        s = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s, _mm256_blend_epi16(sa, ff, 0x88)));
+    }
+    switch (op) {
+    case SDL_COPY_BLEND:
+        return _mm256_add_epi16(s, SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(d, inv_sa)));
+    case SDL_COPY_ADD:
+        r = _mm256_add_epi16(s, d);
+        break;
+    case SDL_COPY_MOD:
+        r = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s, d));
+        break;
+    case SDL_COPY_MUL:
+        r = _mm256_packus_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(s, inv_sa), _mm256_unpacklo_epi16(d, d)),
+                                _mm256_madd_epi16(_mm256_unpackhi_epi16(s, inv_sa), _mm256_unpackhi_epi16(d, d)));
+        r = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_min_epu16(r, _mm256_set1_epi16((short)(255 * 255))));
+        break;
+    default:
+        return d;
+    }
+    return _mm256_blend_epi16(r, d, 0x88);
+}
+
+SDL_TARGETING("avx2") static void SDL_Blit_Auto_Row_AVX2(const Uint32 *src, Uint32 *dst, int n, const SDL_BlitAutoSIMD *ctx)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i src_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->src_shuffle));
+    const __m256i dst_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->dst_shuffle));
+    const __m256i out_shuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->out_shuffle));
+    const __m256i src_alpha = _mm256_set1_epi32((int)ctx->src_alpha);
+    const __m256i modulate = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)ctx->modulate));
+    int i;
+
+    /* 8 pixels at a time, the same way as SDL_Blit_Auto_Pixels_SSE41() */
+    for (i = 0; i + 8 <= n; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i s_lo, s_hi;
+
+        s = _mm256_or_si256(_mm256_shuffle_epi8(s, src_shuffle), src_alpha);
+        s_lo = _mm256_unpacklo_epi8(s, zero);
+        s_hi = _mm256_unpackhi_epi8(s, zero);
+        if (ctx->modulated) {
+            s_lo = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s_lo, modulate));
+            s_hi = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(s_hi, modulate));
+        }
+        if (ctx->op >= 0) {
+            const __m256i d = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *)(dst + i)), dst_shuffle);
+            s_lo = SDL_Blit_Auto_Blend_AVX2(s_lo, _mm256_unpacklo_epi8(d, zero), ctx->op);
+            s_hi = SDL_Blit_Auto_Blend_AVX2(s_hi, _mm256_unpackhi_epi8(d, zero), ctx->op);
+        }
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_shuffle_epi8(_mm256_packus_epi16(s_lo, s_hi), out_shuffle));
+    }
+    SDL_Blit_Auto_Row_SSE41(src + i, dst + i, n - i, ctx);
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
+#endif /* SDL_SSE4_1_INTRINSICS */
+
+__EOF__
+}
+
+# The SIMD versions are only worth it for the blitters doing math on the channels
+sub has_simd
+{
+    my $modulate = shift;
+    my $blend = shift;
+
+    return ( $modulate || $blend );
+}
+
+sub output_copyfunc_simd
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $modulate_arg = $modulate ? "SDL_TRUE" : "SDL_FALSE";
+    my $blend_arg = $blend ? "SDL_TRUE" : "SDL_FALSE";
+    my $scale_arg = $scale ? "SDL_TRUE" : "SDL_FALSE";
+
+    print FILE "#ifdef SDL_SSE4_1_INTRINSICS\n";
+    foreach my $isa ("SSE41", "AVX2") {
+        if ( $isa eq "AVX2" ) {
+            print FILE "#ifdef SDL_AVX2_INTRINSICS\n";
+        }
+        output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 0, "_$isa(SDL_BlitInfo *info)\n");
+        print FILE <<__EOF__;
+{
+    SDL_Blit_Auto_SIMD(info, $format_order{$src}, $format_order{$dst}, $modulate_arg, $blend_arg, $scale_arg, SDL_Blit_Auto_Row_$isa);
+}
+
+__EOF__
+        if ( $isa eq "AVX2" ) {
+            print FILE "#endif\n";
+        }
+    }
+    print FILE "#endif\n\n";
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
@@ -603,7 +917,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -633,8 +946,18 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            if ( has_simd($modulate, $blend) ) {
+                                print FILE "#ifdef SDL_SSE4_1_INTRINSICS\n";
+                                print FILE "#ifdef SDL_AVX2_INTRINSICS\n";
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_AVX2,";
+                                output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, 0, "_AVX2 },\n");
+                                print FILE "#endif\n";
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_SSE41,";
+                                output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, 0, "_SSE41 },\n");
+                                print FILE "#endif\n";
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), SDL_CPU_ANY,";
+                            output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, 0, " },\n");
                         }
                     }
                 }
@@ -658,6 +981,9 @@ sub output_copyfunc_c
             for (my $scale = 0; $scale <= 1; ++$scale) {
                 if ( $modulate || $blend || $scale ) {
                     output_copyfunc($src, $dst, $modulate, $blend, $scale);
+                    if ( has_simd($modulate, $blend) ) {
+                        output_copyfunc_simd($src, $dst, $modulate, $blend, $scale);
+                    }
                 }
             }
         }
@@ -676,6 +1002,7 @@ close_file("SDL_blit_auto.h");
 
 open_file("SDL_blit_auto.c");
 output_copyinc();
+output_simdhelpers();
 for (my $i = 0; $i <= $#src_formats; ++$i) {
     for (my $j = 0; $j <= $#dst_formats; ++$j) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
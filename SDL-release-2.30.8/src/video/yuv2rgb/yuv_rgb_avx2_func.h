@@ -0,0 +1,450 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* This is the 256-bit counterpart of yuv_rgb_sse_func.h. It walks the image
+   exactly like the SSE version (32 pixels of two lines per iteration) and
+   uses the same 16-bit fixed point math, so the output is bit-identical.
+   AVX2 unpack/pack instructions work within 128-bit lanes, so the values
+   are kept in pixel order with a few cross-lane permutes. */
+
+#define LOAD_SI256 _mm256_loadu_si256
+#define SAVE_SI256 _mm256_storeu_si256
+
+/* 16 U/V values (16 bits, in order) to the chroma part of 32 pixels:
+   R1/G1/B1 hold pixels 0-15, R2/G2/B2 hold pixels 16-31 */
+#define UV2RGB_32(U,V,R1,G1,B1,R2,G2,B2) \
+	r_tmp = _mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_r_factor)); \
+	g_tmp = _mm256_add_epi16( \
+		_mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_g_factor)), \
+		_mm256_mullo_epi16(V, _mm256_set1_epi16(param->v_g_factor))); \
+	b_tmp = _mm256_mullo_epi16(U, _mm256_set1_epi16(param->u_b_factor)); \
+	r_tmp = _mm256_permute4x64_epi64(r_tmp, 0xD8); \
+	g_tmp = _mm256_permute4x64_epi64(g_tmp, 0xD8); \
+	b_tmp = _mm256_permute4x64_epi64(b_tmp, 0xD8); \
+	R1 = _mm256_unpacklo_epi16(r_tmp, r_tmp); \
+	G1 = _mm256_unpacklo_epi16(g_tmp, g_tmp); \
+	B1 = _mm256_unpacklo_epi16(b_tmp, b_tmp); \
+	R2 = _mm256_unpackhi_epi16(r_tmp, r_tmp); \
+	G2 = _mm256_unpackhi_epi16(g_tmp, g_tmp); \
+	B2 = _mm256_unpackhi_epi16(b_tmp, b_tmp); \
+
+#define ADD_Y2RGB_32(Y1,Y2,R1,G1,B1,R2,G2,B2) \
+	Y1 = _mm256_mullo_epi16(_mm256_sub_epi16(Y1, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	Y2 = _mm256_mullo_epi16(_mm256_sub_epi16(Y2, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor)); \
+	\
+	R1 = _mm256_srai_epi16(_mm256_add_epi16(R1, Y1), PRECISION); \
+	G1 = _mm256_srai_epi16(_mm256_add_epi16(G1, Y1), PRECISION); \
+	B1 = _mm256_srai_epi16(_mm256_add_epi16(B1, Y1), PRECISION); \
+	R2 = _mm256_srai_epi16(_mm256_add_epi16(R2, Y2), PRECISION); \
+	G2 = _mm256_srai_epi16(_mm256_add_epi16(G2, Y2), PRECISION); \
+	B2 = _mm256_srai_epi16(_mm256_add_epi16(B2, Y2), PRECISION); \
+
+/* saturate 2x16 pixels of 16 bits to 32 pixels of 8 bits, in order */
+#define PACK_8_32(A, B) \
+	_mm256_permute4x64_epi64(_mm256_packus_epi16(A, B), 0xD8)
+
+#define PACK_RGB565_32(R, G, B, RGB1, RGB2) \
+{ \
+	__m256i red_mask, r1, r2, g1, g2, b1, b2; \
+\
+	red_mask = _mm256_set1_epi16((unsigned short)0xF800); \
+	r1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(R)); \
+	r2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(R, 1)); \
+	g1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(G)); \
+	g2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(G, 1)); \
+	b1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(B)); \
+	b2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(B, 1)); \
+	RGB1 = _mm256_and_si256(_mm256_slli_epi16(r1, 8), red_mask); \
+	RGB2 = _mm256_and_si256(_mm256_slli_epi16(r2, 8), red_mask); \
+	RGB1 = _mm256_or_si256(RGB1, _mm256_slli_epi16(_mm256_srli_epi16(g1, 2), 5)); \
+	RGB2 = _mm256_or_si256(RGB2, _mm256_slli_epi16(_mm256_srli_epi16(g2, 2), 5)); \
+	RGB1 = _mm256_or_si256(RGB1, _mm256_srli_epi16(b1, 3)); \
+	RGB2 = _mm256_or_si256(RGB2, _mm256_srli_epi16(b2, 3)); \
+}
+
+/* 16 pixels of separate R, G and B bytes to 48 bytes of packed RGB */
+#define PACK_RGB24_16(R, G, B, RGB1, RGB2, RGB3) \
+	RGB1 = _mm_or_si128(_mm_or_si128( \
+		_mm_shuffle_epi8(R, _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1, 5)), \
+		_mm_shuffle_epi8(G, _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1, -1))), \
+		_mm_shuffle_epi8(B, _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1, 2, -1, -1, 3, -1, -1, 4, -1))); \
+	RGB2 = _mm_or_si128(_mm_or_si128( \
+		_mm_shuffle_epi8(R, _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10, -1)), \
+		_mm_shuffle_epi8(G, _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1, 10))), \
+		_mm_shuffle_epi8(B, _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7, -1, -1, 8, -1, -1, 9, -1, -1))); \
+	RGB3 = _mm_or_si128(_mm_or_si128( \
+		_mm_shuffle_epi8(R, _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1)), \
+		_mm_shuffle_epi8(G, _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1))), \
+		_mm_shuffle_epi8(B, _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15))); \
+
+#define PACK_RGB24_32(R, G, B, RGB1, RGB2, RGB3, RGB4, RGB5, RGB6) \
+	PACK_RGB24_16(_mm256_castsi256_si128(R), _mm256_castsi256_si128(G), _mm256_castsi256_si128(B), RGB1, RGB2, RGB3) \
+	PACK_RGB24_16(_mm256_extracti128_si256(R, 1), _mm256_extracti128_si256(G, 1), _mm256_extracti128_si256(B, 1), RGB4, RGB5, RGB6) \
+
+/* same byte order as PACK_RGBA_32 of the SSE version: R, G, B, A are the
+   bytes from the most to the least significant of each 32-bit pixel */
+#define PACK_RGBA_32(R, G, B, A, RGB1, RGB2, RGB3, RGB4) \
+{ \
+	__m256i lo_ab, hi_ab, lo_gr, hi_gr, t1, t2, t3, t4; \
+\
+	lo_ab = _mm256_unpacklo_epi8( A, B ); \
+	hi_ab = _mm256_unpackhi_epi8( A, B ); \
+	lo_gr = _mm256_unpacklo_epi8( G, R ); \
+	hi_gr = _mm256_unpackhi_epi8( G, R ); \
+	t1 = _mm256_unpacklo_epi16( lo_ab, lo_gr ); \
+	t2 = _mm256_unpackhi_epi16( lo_ab, lo_gr ); \
+	t3 = _mm256_unpacklo_epi16( hi_ab, hi_gr ); \
+	t4 = _mm256_unpackhi_epi16( hi_ab, hi_gr ); \
+	RGB1 = _mm256_permute2x128_si256(t1, t2, 0x20); \
+	RGB2 = _mm256_permute2x128_si256(t3, t4, 0x20); \
+	RGB3 = _mm256_permute2x128_si256(t1, t2, 0x31); \
+	RGB4 = _mm256_permute2x128_si256(t3, t4, 0x31); \
+}
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define PACK_PIXEL \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4; \
+	\
+	PACK_RGB565_32(r_8_1, g_8_1, b_8_1, rgb_1, rgb_2) \
+	\
+	PACK_RGB565_32(r_8_2, g_8_2, b_8_2, rgb_3, rgb_4) \
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define PACK_PIXEL \
+	__m128i rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6; \
+	__m128i rgb_7, rgb_8, rgb_9, rgb_10, rgb_11, rgb_12; \
+	\
+	PACK_RGB24_32(r_8_1, g_8_1, b_8_1, rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6) \
+	\
+	PACK_RGB24_32(r_8_2, g_8_2, b_8_2, rgb_7, rgb_8, rgb_9, rgb_10, rgb_11, rgb_12) \
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA
+
+#define PACK_PIXEL \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6, rgb_7, rgb_8; \
+	__m256i a = _mm256_set1_epi8((char)0xFF); \
+	\
+	PACK_RGBA_32(r_8_1, g_8_1, b_8_1, a, rgb_1, rgb_2, rgb_3, rgb_4) \
+	\
+	PACK_RGBA_32(r_8_2, g_8_2, b_8_2, a, rgb_5, rgb_6, rgb_7, rgb_8) \
+
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+
+#define PACK_PIXEL \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6, rgb_7, rgb_8; \
+	__m256i a = _mm256_set1_epi8((char)0xFF); \
+	\
+	PACK_RGBA_32(b_8_1, g_8_1, r_8_1, a, rgb_1, rgb_2, rgb_3, rgb_4) \
+	\
+	PACK_RGBA_32(b_8_2, g_8_2, r_8_2, a, rgb_5, rgb_6, rgb_7, rgb_8) \
+
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+
+#define PACK_PIXEL \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6, rgb_7, rgb_8; \
+	__m256i a = _mm256_set1_epi8((char)0xFF); \
+	\
+	PACK_RGBA_32(a, r_8_1, g_8_1, b_8_1, rgb_1, rgb_2, rgb_3, rgb_4) \
+	\
+	PACK_RGBA_32(a, r_8_2, g_8_2, b_8_2, rgb_5, rgb_6, rgb_7, rgb_8) \
+
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+
+#define PACK_PIXEL \
+	__m256i rgb_1, rgb_2, rgb_3, rgb_4, rgb_5, rgb_6, rgb_7, rgb_8; \
+	__m256i a = _mm256_set1_epi8((char)0xFF); \
+	\
+	PACK_RGBA_32(a, b_8_1, g_8_1, r_8_1, rgb_1, rgb_2, rgb_3, rgb_4) \
+	\
+	PACK_RGBA_32(a, b_8_2, g_8_2, r_8_2, rgb_5, rgb_6, rgb_7, rgb_8) \
+
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define SAVE_LINE1 \
+	SAVE_SI256((__m256i*)(rgb_ptr1), rgb_1); \
+	SAVE_SI256((__m256i*)(rgb_ptr1+32), rgb_2); \
+
+#define SAVE_LINE2 \
+	SAVE_SI256((__m256i*)(rgb_ptr2), rgb_3); \
+	SAVE_SI256((__m256i*)(rgb_ptr2+32), rgb_4); \
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define SAVE_LINE1 \
+	_mm_storeu_si128((__m128i*)(rgb_ptr1), rgb_1); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr1+16), rgb_2); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr1+32), rgb_3); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr1+48), rgb_4); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr1+64), rgb_5); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr1+80), rgb_6); \
+
+#define SAVE_LINE2 \
+	_mm_storeu_si128((__m128i*)(rgb_ptr2), rgb_7); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr2+16), rgb_8); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr2+32), rgb_9); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr2+48), rgb_10); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr2+64), rgb_11); \
+	_mm_storeu_si128((__m128i*)(rgb_ptr2+80), rgb_12); \
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+
+#define SAVE_LINE1 \
+	SAVE_SI256((__m256i*)(rgb_ptr1), rgb_1); \
+	SAVE_SI256((__m256i*)(rgb_ptr1+32), rgb_2); \
+	SAVE_SI256((__m256i*)(rgb_ptr1+64), rgb_3); \
+	SAVE_SI256((__m256i*)(rgb_ptr1+96), rgb_4); \
+
+#define SAVE_LINE2 \
+	SAVE_SI256((__m256i*)(rgb_ptr2), rgb_5); \
+	SAVE_SI256((__m256i*)(rgb_ptr2+32), rgb_6); \
+	SAVE_SI256((__m256i*)(rgb_ptr2+64), rgb_7); \
+	SAVE_SI256((__m256i*)(rgb_ptr2+96), rgb_8); \
+
+#else
+#error SAVE_LINE unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_Y(y_ptr) \
+{ \
+	__m256i y = LOAD_SI256((const __m256i*)(y_ptr)); \
+	y_16_1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(y)); \
+	y_16_2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(y, 1)); \
+}
+
+#define READ_UV	\
+	u_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(u_ptr))); \
+	v_16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(v_ptr))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_Y(y_ptr) \
+	y_16_1 = _mm256_and_si256(LOAD_SI256((const __m256i*)(y_ptr)), _mm256_set1_epi16(0xFF)); \
+	y_16_2 = _mm256_and_si256(LOAD_SI256((const __m256i*)(y_ptr+32)), _mm256_set1_epi16(0xFF)); \
+
+#define READ_UV	\
+{ \
+	__m256i u1, u2, v1, v2; \
+	u1 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(u_ptr)), 24), 24); \
+	u2 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(u_ptr+32)), 24), 24); \
+	u_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(u1, u2), 0xD8); \
+	v1 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(v_ptr)), 24), 24); \
+	v2 = _mm256_srli_epi32(_mm256_slli_epi32(LOAD_SI256((const __m256i*)(v_ptr+32)), 24), 24); \
+	v_16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(v1, v2), 0xD8); \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+{ \
+	__m256i y = LOAD_SI256((const __m256i*)(y_ptr)); \
+	y_16_1 = _mm256_cvtepu8_epi16(_mm256_castsi256_si128(y)); \
+	y_16_2 = _mm256_cvtepu8_epi16(_mm256_extracti128_si256(y, 1)); \
+}
+
+#define READ_UV	\
+	u_16 = _mm256_and_si256(LOAD_SI256((const __m256i*)(u_ptr)), _mm256_set1_epi16(0xFF)); \
+	v_16 = _mm256_and_si256(LOAD_SI256((const __m256i*)(v_ptr)), _mm256_set1_epi16(0xFF)); \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define YUV2RGB_32 \
+	__m256i r_tmp, g_tmp, b_tmp; \
+	__m256i r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2; \
+	__m256i r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2; \
+	__m256i y_16_1, y_16_2; \
+	__m256i u_16, v_16; \
+	__m256i r_8_1, g_8_1, b_8_1, r_8_2, g_8_2, b_8_2; \
+	\
+	READ_UV \
+	\
+	u_16 = _mm256_add_epi16(u_16, _mm256_set1_epi16(-128)); \
+	v_16 = _mm256_add_epi16(v_16, _mm256_set1_epi16(-128)); \
+	\
+	UV2RGB_32(u_16, v_16, r_uv_16_1, g_uv_16_1, b_uv_16_1, r_uv_16_2, g_uv_16_2, b_uv_16_2) \
+	\
+	/* process 32 pixels of first line */\
+	r_16_1=r_uv_16_1; g_16_1=g_uv_16_1; b_16_1=b_uv_16_1; \
+	r_16_2=r_uv_16_2; g_16_2=g_uv_16_2; b_16_2=b_uv_16_2; \
+	\
+	READ_Y(y_ptr1) \
+	\
+	ADD_Y2RGB_32(y_16_1, y_16_2, r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2) \
+	\
+	r_8_1 = PACK_8_32(r_16_1, r_16_2); \
+	g_8_1 = PACK_8_32(g_16_1, g_16_2); \
+	b_8_1 = PACK_8_32(b_16_1, b_16_2); \
+	\
+	/* process 32 pixels of second line */\
+	r_16_1=r_uv_16_1; g_16_1=g_uv_16_1; b_16_1=b_uv_16_1; \
+	r_16_2=r_uv_16_2; g_16_2=g_uv_16_2; b_16_2=b_uv_16_2; \
+	\
+	READ_Y(y_ptr2) \
+	\
+	ADD_Y2RGB_32(y_16_1, y_16_2, r_16_1, g_16_1, b_16_1, r_16_2, g_16_2, b_16_2) \
+	\
+	r_8_2 = PACK_8_32(r_16_1, r_16_2); \
+	g_8_2 = PACK_8_32(g_16_1, g_16_2); \
+	b_8_2 = PACK_8_32(b_16_1, b_16_2); \
+	\
+
+
+SDL_TARGETING("avx2")
+void AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	/* READ_UV reads one byte past the last U/V pair, see yuv_rgb_sse_func.h */
+	const int fix_read_nv12 = ((width & 31) == 0);
+#else
+	const int fix_read_nv12 = 0;
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_422
+	/* Avoid invalid read on last line */
+	const int fix_read_422 = 1;
+#else
+	const int fix_read_422 = 0;
+#endif
+
+
+	if (width >= 32) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)) - fix_read_422; ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-31) - fix_read_nv12; xpos+=32)
+			{
+				YUV2RGB_32
+				{
+					PACK_PIXEL
+					SAVE_LINE1
+					if (uv_y_sample_interval > 1)
+					{
+						SAVE_LINE2
+					}
+				}
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=32*rgb_pixel_stride;
+				rgb_ptr2+=32*rgb_pixel_stride;
+			}
+		}
+
+		if (fix_read_422) {
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+			ypos += uv_y_sample_interval;
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		uint32_t converted = (width & ~31);
+		if (fix_read_nv12) {
+			converted -= 32;
+		}
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef LOAD_SI256
+#undef SAVE_SI256
+#undef UV2RGB_32
+#undef ADD_Y2RGB_32
+#undef PACK_8_32
+#undef PACK_RGB565_32
+#undef PACK_RGB24_16
+#undef PACK_RGB24_32
+#undef PACK_RGBA_32
+#undef PACK_PIXEL
+#undef SAVE_LINE1
+#undef SAVE_LINE2
+#undef READ_Y
+#undef READ_UV
+#undef YUV2RGB_32
@@ -469,6 +469,82 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * @brief Compare threaded YUV to RGB conversion against the single threaded one
+ *
+ * Odd heights leave a 4:2:2 band with an odd row count, which needs the
+ * last row of every band redone the way the serial conversion sees it.
+ */
+int pixels_convertYUVThreaded(void *arg)
+{
+    const Uint32 yuv_formats[] = {
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12
+    };
+    const Uint32 rgb_formats[] = {
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGB24
+    };
+    const int widths[] = { 66, 75 };
+    const int heights[] = { 129, 257, 263 };
+    const int max_w = 75, max_h = 263;
+    const int yuv_len = ((max_w + 1) / 2) * 4 * max_h;
+    const int rgb_len = max_w * 4 * max_h;
+    Uint8 *yuv = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *serial = (Uint8 *)SDL_malloc(rgb_len);
+    Uint8 *threaded = (Uint8 *)SDL_malloc(rgb_len);
+    int i, f, r, wi, hi;
+
+    SDLTest_AssertCheck(yuv && serial && threaded, "Verify buffers were allocated");
+    if (!yuv || !serial || !threaded) {
+        SDL_free(yuv);
+        SDL_free(serial);
+        SDL_free(threaded);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < yuv_len; ++i) {
+        yuv[i] = (Uint8)(i * 7 + i / 131);
+    }
+
+    for (f = 0; f < SDL_arraysize(yuv_formats); ++f) {
+        const SDL_bool packed = (yuv_formats[f] == SDL_PIXELFORMAT_YUY2 ||
+                                 yuv_formats[f] == SDL_PIXELFORMAT_UYVY ||
+                                 yuv_formats[f] == SDL_PIXELFORMAT_YVYU);
+        for (r = 0; r < SDL_arraysize(rgb_formats); ++r) {
+            for (wi = 0; wi < SDL_arraysize(widths); ++wi) {
+                for (hi = 0; hi < SDL_arraysize(heights); ++hi) {
+                    const int w = widths[wi];
+                    const int h = heights[hi];
+                    const int yuv_pitch = packed ? ((w + 1) / 2) * 4 : w;
+                    const int rgb_pitch = w * SDL_BYTESPERPIXEL(rgb_formats[r]);
+                    int ret1, ret2;
+
+                    SDL_memset(serial, 0, rgb_len);
+                    SDL_memset(threaded, 0xFF, rgb_len);
+                    SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS, "1");
+                    ret1 = SDL_ConvertPixels(w, h, yuv_formats[f], yuv, yuv_pitch, rgb_formats[r], serial, rgb_pitch);
+                    SDL_SetHint(SDL_HINT_YUV_CONVERSION_THREADS, "4");
+                    ret2 = SDL_ConvertPixels(w, h, yuv_formats[f], yuv, yuv_pitch, rgb_formats[r], threaded, rgb_pitch);
+                    SDLTest_AssertCheck(ret1 == 0 && ret2 == 0, "Verify %s to %s %dx%d converts, got %d and %d",
+                                        SDL_GetPixelFormatName(yuv_formats[f]), SDL_GetPixelFormatName(rgb_formats[r]), w, h, ret1, ret2);
+                    SDLTest_AssertCheck(SDL_memcmp(serial, threaded, (size_t)rgb_pitch * h) == 0,
+                                        "Verify threaded %s to %s %dx%d matches the single threaded conversion",
+                                        SDL_GetPixelFormatName(yuv_formats[f]), SDL_GetPixelFormatName(rgb_formats[r]), w, h);
+                }
+            }
+        }
+    }
+
+    SDL_ResetHint(SDL_HINT_YUV_CONVERSION_THREADS);
+    SDL_free(yuv);
+    SDL_free(serial);
+    SDL_free(threaded);
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -486,9 +562,12 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_convertYUVThreaded, "pixels_convertYUVThreaded", "Compare threaded and single threaded YUV to RGB conversion", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, NULL
 };
 
 /* Pixels test suite (global) */
@@ -811,6 +811,766 @@ int render_testBlitBlend(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests reading back presented frames asynchronously.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderReadPixelsAsync
+ * http://wiki.libsdl.org/SDL_RenderGetReadbackPixels
+ * http://wiki.libsdl.org/SDL_RenderReleaseReadback
+ */
+int render_testReadPixelsAsync(void *arg)
+{
+    int ret;
+    int y;
+    int pitch;
+    int checkFailCount1;
+    SDL_Rect rect;
+    Uint8 *expected;
+    const void *pixels;
+    SDL_RenderReadback *readbacks[3];
+
+    /* Clear surface. */
+    _clearScreen();
+
+    /* Draw something to read back. */
+    rect.x = 10;
+    rect.y = 5;
+    rect.w = 40;
+    rect.h = 30;
+    ret = SDL_SetRenderDrawColor(renderer, 13, 73, 200, SDL_ALPHA_OPAQUE);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+    ret = SDL_RenderFillRect(renderer, &rect);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+    ret = SDL_SetRenderDrawColor(renderer, 255, 200, 0, SDL_ALPHA_OPAQUE);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+    ret = SDL_RenderDrawLine(renderer, 0, 0, TESTRENDER_SCREEN_W - 1, TESTRENDER_SCREEN_H - 1);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderDrawLine, expected: 0, got: %i", ret);
+
+    /* Read the frame synchronously, in another format than the window's. */
+    expected = (Uint8 *)SDL_malloc(4 * TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H);
+    SDLTest_AssertCheck(expected != NULL, "Validate allocated temp pixel buffer");
+    if (expected == NULL) {
+        return TEST_ABORTED;
+    }
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = TESTRENDER_SCREEN_W;
+    rect.h = TESTRENDER_SCREEN_H;
+    ret = SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ABGR8888, expected, TESTRENDER_SCREEN_W * 4);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+    /* Request it asynchronously, using up the default two buffers. */
+    readbacks[0] = SDL_RenderReadPixelsAsync(renderer, &rect, SDL_PIXELFORMAT_ABGR8888);
+    SDLTest_AssertCheck(readbacks[0] != NULL, "Validate result from SDL_RenderReadPixelsAsync is not NULL");
+    readbacks[1] = SDL_RenderReadPixelsAsync(renderer, &rect, 0);
+    SDLTest_AssertCheck(readbacks[1] != NULL, "Validate result from SDL_RenderReadPixelsAsync is not NULL");
+    readbacks[2] = SDL_RenderReadPixelsAsync(renderer, &rect, 0);
+    SDLTest_AssertCheck(readbacks[2] == NULL, "Validate result from SDL_RenderReadPixelsAsync is NULL with all buffers in use");
+    if (readbacks[0] == NULL || readbacks[1] == NULL) {
+        SDL_RenderReleaseReadback(readbacks[0]);
+        SDL_RenderReleaseReadback(readbacks[1]);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+
+    ret = SDL_RenderGetReadbackPixels(readbacks[0], SDL_TRUE, &pixels, &pitch);
+    SDLTest_AssertCheck(ret == 1, "Validate result from SDL_RenderGetReadbackPixels before presenting, expected: 1, got: %i", ret);
+
+    /* The frame is read when presented. */
+    SDL_RenderPresent(renderer);
+
+    ret = SDL_RenderGetReadbackPixels(readbacks[0], SDL_TRUE, &pixels, &pitch);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetReadbackPixels, expected: 0, got: %i", ret);
+    if (ret == 0) {
+        checkFailCount1 = 0;
+        for (y = 0; y < TESTRENDER_SCREEN_H; y++) {
+            if (SDL_memcmp((const Uint8 *)pixels + y * pitch, expected + y * TESTRENDER_SCREEN_W * 4, TESTRENDER_SCREEN_W * 4) != 0) {
+                checkFailCount1++;
+            }
+        }
+        SDLTest_AssertCheck(checkFailCount1 == 0, "Validate rows matching SDL_RenderReadPixels, expected: 0 different, got: %i", checkFailCount1);
+    }
+    ret = SDL_RenderGetReadbackPixels(readbacks[1], SDL_FALSE, &pixels, &pitch);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetReadbackPixels in the window format, expected: 0, got: %i", ret);
+
+    /* Clean up. */
+    SDL_RenderReleaseReadback(readbacks[0]);
+    SDL_RenderReleaseReadback(readbacks[1]);
+    SDLTest_AssertPass("Call to SDL_RenderReleaseReadback()");
+    SDL_free(expected);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests drawing sprites packed into a texture atlas.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_CreateTextureAtlas
+ * http://wiki.libsdl.org/SDL_AddSurfaceToTextureAtlas
+ * http://wiki.libsdl.org/SDL_RenderCopySprites
+ * http://wiki.libsdl.org/SDL_DestroyTextureAtlas
+ */
+int render_testBlitSprites(void *arg)
+{
+    int ret;
+    SDL_TextureAtlas *atlas;
+    SDL_Surface *face;
+    SDL_Surface *filler;
+    SDL_Surface *referenceSurface = NULL;
+    SDL_Texture *texture;
+    SDL_Rect rect;
+    SDL_Rect *srcrects;
+    SDL_FRect *dstrects;
+    int i, j, ni, nj, count;
+
+    /* Clear surface. */
+    _clearScreen();
+
+    /* Need drawcolor or just skip test. */
+    SDLTest_AssertCheck(_hasDrawColor(), "_hasDrawColor)");
+
+    atlas = SDL_CreateTextureAtlas(renderer, SDL_PIXELFORMAT_ARGB8888, 64, 64);
+    SDLTest_AssertCheck(atlas != NULL, "Verify SDL_CreateTextureAtlas() result");
+    if (atlas == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Take some space first, so the face isn't packed at the origin. */
+    filler = SDL_CreateRGBSurfaceWithFormat(0, 40, 20, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(filler != NULL, "Verify SDL_CreateRGBSurfaceWithFormat() result");
+    if (filler == NULL) {
+        SDL_DestroyTextureAtlas(atlas);
+        return TEST_ABORTED;
+    }
+    ret = SDL_AddSurfaceToTextureAtlas(atlas, filler, &texture, &rect);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_AddSurfaceToTextureAtlas, expected 0, got %i", ret);
+    SDLTest_AssertCheck(rect.x == 0 && rect.y == 0, "Verify filler is packed at 0,0, got %i,%i", rect.x, rect.y);
+    SDL_FreeSurface(filler);
+
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Verify SDLTest_ImageFace() result");
+    if (face == NULL) {
+        SDL_DestroyTextureAtlas(atlas);
+        return TEST_ABORTED;
+    }
+    ret = SDL_AddSurfaceToTextureAtlas(atlas, face, &texture, &rect);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_AddSurfaceToTextureAtlas, expected 0, got %i", ret);
+    SDLTest_AssertCheck(rect.x == 0 && rect.y == 20, "Verify face is packed at 0,20, got %i,%i", rect.x, rect.y);
+    SDL_FreeSurface(face);
+
+    /* A surface larger than the atlas is refused. */
+    filler = SDL_CreateRGBSurfaceWithFormat(0, 65, 1, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (filler != NULL) {
+        SDL_Texture *unused;
+        SDL_Rect unused_rect;
+        ret = SDL_AddSurfaceToTextureAtlas(atlas, filler, &unused, &unused_rect);
+        SDLTest_AssertCheck(ret < 0, "Verify result from SDL_AddSurfaceToTextureAtlas with a surface too large, expected <0, got %i", ret);
+        SDL_FreeSurface(filler);
+    }
+
+    /* Same layout as render_testBlit, in one call. */
+    ni = TESTRENDER_SCREEN_W - rect.w;
+    nj = TESTRENDER_SCREEN_H - rect.h;
+    count = ((ni / 4) + 1) * ((nj / 4) + 1);
+    srcrects = (SDL_Rect *)SDL_malloc(count * sizeof(*srcrects));
+    dstrects = (SDL_FRect *)SDL_malloc(count * sizeof(*dstrects));
+    SDLTest_AssertCheck(srcrects != NULL && dstrects != NULL, "Validate allocated rectangles");
+    if (srcrects == NULL || dstrects == NULL) {
+        SDL_free(srcrects);
+        SDL_free(dstrects);
+        SDL_DestroyTextureAtlas(atlas);
+        return TEST_ABORTED;
+    }
+    count = 0;
+    for (j = 0; j <= nj; j += 4) {
+        for (i = 0; i <= ni; i += 4) {
+            srcrects[count] = rect;
+            dstrects[count].x = (float)i;
+            dstrects[count].y = (float)j;
+            dstrects[count].w = (float)rect.w;
+            dstrects[count].h = (float)rect.h;
+            count++;
+        }
+    }
+    ret = SDL_RenderCopySprites(renderer, texture, srcrects, dstrects, count);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopySprites, expected: 0, got: %i", ret);
+
+    /* See if it's the same */
+    referenceSurface = SDLTest_ImageBlit();
+    _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+
+    /* Make current */
+    SDL_RenderPresent(renderer);
+
+    /* Clean up. */
+    SDL_free(srcrects);
+    SDL_free(dstrects);
+    SDL_DestroyTextureAtlas(atlas);
+    SDLTest_AssertPass("Call to SDL_DestroyTextureAtlas()");
+    SDL_FreeSurface(referenceSurface);
+    referenceSurface = NULL;
+
+    return TEST_COMPLETED;
+}
+
+/* Checks SDL_RenderCopySprites() against one SDL_RenderCopyF() per sprite, including
+   sprites it has to clip or skip, with and without source rectangles */
+static void _compareSpritesToCopies(void)
+{
+    SDL_Texture *tface;
+    SDL_Rect srcrects[5];
+    SDL_FRect dstrects[5];
+    Uint32 *sprites, *copies;
+    int tw, th, w, h, pass, i, mismatches;
+
+    tface = _loadTestFace();
+    SDL_GetRendererOutputSize(renderer, &w, &h);
+    sprites = (Uint32 *)SDL_malloc(w * h * sizeof(Uint32));
+    copies = (Uint32 *)SDL_malloc(w * h * sizeof(Uint32));
+    SDLTest_AssertCheck(tface != NULL && sprites != NULL && copies != NULL, "Verify the face texture and pixel buffers were created");
+    if (!tface || !sprites || !copies) {
+        if (tface) {
+            SDL_DestroyTexture(tface);
+        }
+        SDL_free(sprites);
+        SDL_free(copies);
+        return;
+    }
+    SDL_QueryTexture(tface, NULL, NULL, &tw, &th);
+
+    for (i = 0; i < 5; ++i) {
+        srcrects[i].x = 0;
+        srcrects[i].y = 0;
+        srcrects[i].w = tw;
+        srcrects[i].h = th;
+        dstrects[i].x = 10.0f + i * 45.0f;
+        dstrects[i].y = 20.0f + i * 30.0f;
+        dstrects[i].w = (float)tw;
+        dstrects[i].h = (float)th;
+    }
+    /* Half outside the texture, outside the texture, scaled, outside the viewport */
+    srcrects[1].x = tw / 2;
+    srcrects[1].y = th / 2;
+    srcrects[2].x = tw + 5;
+    dstrects[3].w = tw * 1.75f;
+    dstrects[3].h = th * 0.5f;
+    dstrects[4].x = -200.0f;
+
+    for (pass = 0; pass < 2; ++pass) {
+        const SDL_Rect *src = pass == 0 ? srcrects : NULL;
+
+        _clearScreen();
+        SDL_RenderCopySprites(renderer, tface, src, dstrects, 5);
+        SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_ARGB8888, sprites, w * sizeof(Uint32));
+
+        _clearScreen();
+        for (i = 0; i < 5; ++i) {
+            SDL_RenderCopyF(renderer, tface, src ? &src[i] : NULL, &dstrects[i]);
+        }
+        SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_ARGB8888, copies, w * sizeof(Uint32));
+
+        mismatches = 0;
+        for (i = 0; i < w * h; ++i) {
+            if (sprites[i] != copies[i]) {
+                ++mismatches;
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Verify sprites %s source rects match single copies, mismatched pixels: %i",
+                            src ? "with" : "without", mismatches);
+    }
+
+    SDL_DestroyTexture(tface);
+    SDL_free(sprites);
+    SDL_free(copies);
+}
+
+/**
+ * @brief Tests drawing sprites on the renderers that draw them as geometry.
+ *
+ * The software renderer copies rectangles natively, so this restarts video
+ * on the offscreen driver, where the GL renderers may be available.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderCopySprites
+ */
+int render_testBlitSpritesGeometry(void *arg)
+{
+    const char *current = SDL_GetCurrentVideoDriver();
+    char *driver = current ? SDL_strdup(current) : NULL;
+    int i, tested = 0, result = TEST_COMPLETED;
+
+    /* The suite's window belongs to the current video driver */
+    CleanupDestroyRenderer(arg);
+    SDL_VideoQuit();
+    if (SDL_VideoInit("offscreen") == 0) {
+        for (i = 0; i < SDL_GetNumRenderDrivers(); ++i) {
+            SDL_RendererInfo info;
+
+            SDL_GetRenderDriverInfo(i, &info);
+            if (SDL_strcmp(info.name, "software") == 0) {
+                continue;
+            }
+            window = SDL_CreateWindow("render_testBlitSpritesGeometry", 0, 0, 320, 240, 0);
+            renderer = window ? SDL_CreateRenderer(window, i, 0) : NULL;
+            if (renderer) {
+                SDLTest_Log("Drawing sprites with the %s renderer", info.name);
+                if (render_testBlitSprites(arg) != TEST_COMPLETED) {
+                    result = TEST_ABORTED;
+                }
+                _compareSpritesToCopies();
+                ++tested;
+            } else {
+                SDLTest_Log("Couldn't create the %s renderer: %s", info.name, SDL_GetError());
+            }
+            CleanupDestroyRenderer(arg);
+        }
+    } else {
+        SDLTest_Log("Couldn't initialize the offscreen video driver: %s", SDL_GetError());
+    }
+    SDL_VideoQuit();
+    SDL_VideoInit(driver);
+    SDL_free(driver);
+    InitCreateRenderer(arg);
+
+    if (!tested) {
+        SDLTest_Log("Skipping sprite geometry test, no renderer draws sprites as geometry");
+        return TEST_SKIPPED;
+    }
+    return result;
+}
+
+/* Draws fills, points, lines, copies and geometry, part of it through a render target */
+static void _drawTileScene(SDL_Renderer *tiled, SDL_Texture *face, SDL_Texture *target)
+{
+    SDL_Vertex verts[6];
+    SDL_Rect rect;
+    SDL_FRect frect;
+    int i;
+
+    SDL_SetRenderTarget(tiled, target);
+    SDL_SetRenderDrawColor(tiled, 20, 40, 60, 255);
+    SDL_RenderClear(tiled);
+    for (i = 0; i < 12; ++i) {
+        rect.x = i * 23;
+        rect.y = i * 17;
+        rect.w = 90;
+        rect.h = 70;
+        SDL_RenderCopy(tiled, face, NULL, &rect);
+    }
+    SDL_SetRenderTarget(tiled, NULL);
+
+    SDL_SetRenderDrawColor(tiled, 200, 100, 50, 255);
+    SDL_RenderClear(tiled);
+    SDL_RenderCopy(tiled, target, NULL, NULL);
+    SDL_SetRenderDrawBlendMode(tiled, SDL_BLENDMODE_BLEND);
+    for (i = 0; i < 20; ++i) {
+        rect.x = (i * 37) % 280 - 10;
+        rect.y = (i * 53) % 250 - 10;
+        rect.w = 40 + i * 7;
+        rect.h = 30 + i * 5;
+        SDL_SetRenderDrawColor(tiled, (Uint8)(i * 13), (Uint8)(255 - i * 11), (Uint8)(i * 29), (Uint8)(60 + i * 9));
+        SDL_RenderFillRect(tiled, &rect);
+    }
+    for (i = 0; i < 200; ++i) {
+        SDL_RenderDrawPoint(tiled, (i * 97) % 320, (i * 61) % 290);
+    }
+    SDL_RenderDrawLine(tiled, 0, 0, 319, 289);
+    SDL_SetTextureBlendMode(face, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureAlphaMod(face, 180);
+    for (i = 0; i < 8; ++i) {
+        rect.x = 20 + i * 33;
+        rect.y = 140 - i * 12;
+        rect.w = 42;
+        rect.h = 42;
+        SDL_RenderCopy(tiled, face, NULL, &rect);
+    }
+    frect.x = 100.5f;
+    frect.y = 30.25f;
+    frect.w = 150.0f;
+    frect.h = 120.0f;
+    SDL_RenderCopyExF(tiled, face, NULL, &frect, 30.0, NULL, SDL_FLIP_NONE);
+    SDL_SetTextureAlphaMod(face, 255);
+
+    for (i = 0; i < 6; ++i) {
+        verts[i].position.x = (float)((i * 113) % 300 + 5);
+        verts[i].position.y = (float)((i * 71) % 280 + 3);
+        verts[i].color.r = (Uint8)(i * 40);
+        verts[i].color.g = (Uint8)(255 - i * 30);
+        verts[i].color.b = 128;
+        verts[i].color.a = 200;
+        verts[i].tex_coord.x = (float)(i & 1);
+        verts[i].tex_coord.y = (float)((i >> 1) & 1);
+    }
+    SDL_RenderGeometry(tiled, NULL, verts, 3, NULL, 0);
+    SDL_RenderGeometry(tiled, face, verts + 3, 3, NULL, 0);
+    SDL_RenderFlush(tiled);
+}
+
+/**
+ * @brief Tests that drawing by tile on several threads matches drawing on one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_SOFTWARE_THREADS
+ */
+int render_testSoftwareTiles(void *arg)
+{
+    SDL_Surface *surface, *face_surface, *serial;
+    SDL_Renderer *tiled;
+    SDL_Texture *face, *target;
+    int pass, y, rows;
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 320, 290, 32, SDL_PIXELFORMAT_ARGB8888);
+    serial = SDL_CreateRGBSurfaceWithFormat(0, 320, 290, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL && serial != NULL, "Verify SDL_CreateRGBSurfaceWithFormat() result");
+    if (!surface || !serial) {
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(serial);
+        return TEST_ABORTED;
+    }
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "1");
+    tiled = SDL_CreateSoftwareRenderer(surface);
+    SDLTest_AssertCheck(tiled != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+    face_surface = SDLTest_ImageFace();
+    face = tiled && face_surface ? SDL_CreateTextureFromSurface(tiled, face_surface) : NULL;
+    target = tiled ? SDL_CreateTexture(tiled, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, 300, 280) : NULL;
+    SDLTest_AssertCheck(face != NULL && target != NULL, "Verify textures were created");
+    if (!face || !target) {
+        SDL_FreeSurface(face_surface);
+        if (tiled) {
+            SDL_DestroyRenderer(tiled);
+        }
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(serial);
+        SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+        return TEST_ABORTED;
+    }
+
+    _drawTileScene(tiled, face, target);
+    SDL_BlitSurface(surface, NULL, serial, NULL);
+
+    /* The second tiled pass reuses the views of both targets */
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, "4");
+    for (pass = 0; pass < 2; ++pass) {
+        SDL_FillRect(surface, NULL, 0);
+        _drawTileScene(tiled, face, target);
+        for (y = 0, rows = 0; y < surface->h; ++y) {
+            if (SDL_memcmp((Uint8 *)surface->pixels + y * surface->pitch, (Uint8 *)serial->pixels + y * serial->pitch, surface->w * 4) == 0) {
+                ++rows;
+            }
+        }
+        SDLTest_AssertCheck(rows == surface->h, "Verify tiled pass %i matches the serial one, matching rows: %i of %i", pass, rows, surface->h);
+    }
+
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    SDL_DestroyTexture(face);
+    SDL_DestroyTexture(target);
+    SDL_DestroyRenderer(tiled);
+    SDL_FreeSurface(face_surface);
+    SDL_FreeSurface(surface);
+    SDL_FreeSurface(serial);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that rotating with the SSE4.1 and AVX2 row kernels matches the scalar code.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderCopyEx
+ * http://wiki.libsdl.org/SDL_HINT_CPU_FEATURE_MASK
+ */
+int render_testRotateSIMD(void *arg)
+{
+    const int widths[] = { 37, 61, 13 };
+    const int heights[] = { 23, 18, 31 };
+    const double angles[] = { 30.0, 137.5, -71.25 };
+    const SDL_RendererFlip flips[] = { SDL_FLIP_NONE, SDL_FLIP_HORIZONTAL, SDL_FLIP_VERTICAL, SDL_FLIP_HORIZONTAL | SDL_FLIP_VERTICAL };
+    const SDL_ScaleMode modes[] = { SDL_ScaleModeNearest, SDL_ScaleModeLinear };
+    /* Scalar code first, then SSE4.1, then everything the CPU has */
+    const char *masks[] = { "-all", "-avx2", NULL };
+    SDL_Surface *surface, *scalar;
+    SDL_Renderer *soft;
+    Uint32 pixels[61 * 31];
+    int size, angle, flip, mode, mask, i, rows, mismatches = 0;
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 80, 80, 32, SDL_PIXELFORMAT_ARGB8888);
+    scalar = SDL_CreateRGBSurfaceWithFormat(0, 80, 80, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL && scalar != NULL, "Verify SDL_CreateRGBSurfaceWithFormat() result");
+    if (!surface || !scalar) {
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(scalar);
+        return TEST_ABORTED;
+    }
+    soft = SDL_CreateSoftwareRenderer(surface);
+    SDLTest_AssertCheck(soft != NULL, "Verify SDL_CreateSoftwareRenderer() result");
+    if (!soft) {
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(scalar);
+        return TEST_ABORTED;
+    }
+    /* The rotated pixels are translucent, keep the copy of the scalar result exact */
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+    SDLTest_Log("SSE4.1: %s, AVX2: %s", SDL_HasSSE41() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no");
+
+    /* Translucent noise, so that every channel is interpolated */
+    for (i = 0; i < SDL_arraysize(pixels); ++i) {
+        pixels[i] = (Uint32)SDLTest_RandomUint32();
+    }
+
+    for (size = 0; size < SDL_arraysize(widths); ++size) {
+        SDL_Texture *texture = SDL_CreateTexture(soft, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, widths[size], heights[size]);
+        SDL_Rect dst;
+
+        SDLTest_AssertCheck(texture != NULL, "Verify SDL_CreateTexture() result for %ix%i", widths[size], heights[size]);
+        if (!texture) {
+            continue;
+        }
+        SDL_UpdateTexture(texture, NULL, pixels, widths[size] * 4);
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+        dst.x = 40 - widths[size] / 2;
+        dst.y = 40 - heights[size] / 2;
+        dst.w = widths[size];
+        dst.h = heights[size];
+
+        for (angle = 0; angle < SDL_arraysize(angles); ++angle) {
+            for (flip = 0; flip < SDL_arraysize(flips); ++flip) {
+                for (mode = 0; mode < SDL_arraysize(modes); ++mode) {
+                    SDL_SetTextureScaleMode(texture, modes[mode]);
+                    for (mask = 0; mask < SDL_arraysize(masks); ++mask) {
+                        SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, masks[mask]);
+                        SDL_FillRect(surface, NULL, 0);
+                        SDL_RenderCopyEx(soft, texture, NULL, &dst, angles[angle], NULL, flips[flip]);
+                        SDL_RenderFlush(soft);
+                        if (mask == 0) {
+                            SDL_BlitSurface(surface, NULL, scalar, NULL);
+                            continue;
+                        }
+                        for (i = 0, rows = 0; i < surface->h; ++i) {
+                            if (SDL_memcmp((Uint8 *)surface->pixels + i * surface->pitch, (Uint8 *)scalar->pixels + i * scalar->pitch, surface->w * 4) == 0) {
+                                ++rows;
+                            }
+                        }
+                        if (rows != surface->h) {
+                            SDLTest_LogError("%ix%i rotated by %g, flip %i, scale mode %i with mask \"%s\": %i of %i rows match the scalar code",
+                                             widths[size], heights[size], angles[angle], (int)flips[flip], (int)modes[mode],
+                                             masks[mask] ? masks[mask] : "", rows, surface->h);
+                            ++mismatches;
+                        }
+                    }
+                }
+            }
+        }
+        SDL_DestroyTexture(texture);
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify the SIMD rotations match the scalar ones, mismatches: %i", mismatches);
+
+    SDL_ResetHint(SDL_HINT_CPU_FEATURE_MASK);
+    SDL_DestroyRenderer(soft);
+    SDL_FreeSurface(surface);
+    SDL_FreeSurface(scalar);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that triangles drawn from a colorkeyed surface leave the keyed
+ * pixels alone and keep sampling the right texels after them.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGeometry
+ * http://wiki.libsdl.org/SDL_SetColorKey
+ */
+int render_testGeometryColorKey(void *arg)
+{
+    const int w = 32, h = 16;
+    SDL_Surface *source, *filled;
+    SDL_Texture *keyed, *opaque;
+    SDL_Vertex verts[6];
+    SDL_Rect rect;
+    Uint32 key, background, expected[40 * 24], pixels[40 * 24];
+    int i, x, y, mismatches;
+
+    source = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_RGB888);
+    filled = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_RGB888);
+    SDLTest_AssertCheck(source != NULL && filled != NULL, "Verify SDL_CreateRGBSurfaceWithFormat() result");
+    if (!source || !filled) {
+        SDL_FreeSurface(source);
+        SDL_FreeSurface(filled);
+        return TEST_ABORTED;
+    }
+    /* Keyed pixels scattered along every row, the background in their place for the reference */
+    key = SDL_MapRGB(source->format, 255, 0, 255);
+    background = SDL_MapRGB(source->format, 10, 20, 30);
+    for (y = 0; y < h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)source->pixels + y * source->pitch);
+        Uint32 *filled_row = (Uint32 *)((Uint8 *)filled->pixels + y * filled->pitch);
+        for (x = 0; x < w; ++x) {
+            const SDL_bool keyed_pixel = (x * 7 + y * 3) % 5 == 0;
+            row[x] = keyed_pixel ? key : SDL_MapRGB(source->format, (Uint8)(x * 8), (Uint8)(y * 16), 100);
+            filled_row[x] = keyed_pixel ? background : row[x];
+        }
+    }
+    SDL_SetColorKey(source, SDL_TRUE, key);
+    keyed = SDL_CreateTextureFromSurface(renderer, source);
+    opaque = SDL_CreateTextureFromSurface(renderer, filled);
+    SDLTest_AssertCheck(keyed != NULL && opaque != NULL, "Verify SDL_CreateTextureFromSurface() result");
+    if (!keyed || !opaque) {
+        if (keyed) {
+            SDL_DestroyTexture(keyed);
+        }
+        if (opaque) {
+            SDL_DestroyTexture(opaque);
+        }
+        SDL_FreeSurface(source);
+        SDL_FreeSurface(filled);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < 6; ++i) {
+        /* Two triangles covering the texture, stretched a little, corners 0 1 2 and 2 1 3 */
+        static const int corners[6] = { 0, 1, 2, 2, 1, 3 };
+        const int c = corners[i];
+        verts[i].position.x = 4.0f + (c & 1) * 31.5f;
+        verts[i].position.y = 4.0f + (c >> 1) * 17.25f;
+        verts[i].tex_coord.x = (float)(c & 1);
+        verts[i].tex_coord.y = (float)(c >> 1);
+        verts[i].color.r = verts[i].color.g = verts[i].color.b = verts[i].color.a = 255;
+    }
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = 40;
+    rect.h = 24;
+
+    SDL_SetRenderDrawColor(renderer, 10, 20, 30, 255);
+    SDL_RenderClear(renderer);
+    SDL_SetTextureBlendMode(opaque, SDL_BLENDMODE_NONE);
+    SDL_RenderGeometry(renderer, opaque, verts, 6, NULL, 0);
+    SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, expected, rect.w * sizeof(Uint32));
+
+    SDL_RenderClear(renderer);
+    SDL_RenderGeometry(renderer, keyed, verts, 6, NULL, 0);
+    SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, pixels, rect.w * sizeof(Uint32));
+
+    mismatches = 0;
+    for (i = 0; i < rect.w * rect.h; ++i) {
+        if (pixels[i] != expected[i]) {
+            ++mismatches;
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify keyed triangles match the background filled ones, mismatched pixels: %i", mismatches);
+
+    SDL_DestroyTexture(keyed);
+    SDL_DestroyTexture(opaque);
+    SDL_FreeSurface(source);
+    SDL_FreeSurface(filled);
+
+    return TEST_COMPLETED;
+}
+
+/* Draws one frame of a mostly static scene, scaled, with a few moving parts */
+static void _drawDirtyFrame(SDL_Renderer *target, SDL_Texture *face, int frame)
+{
+    SDL_FRect rect;
+    SDL_FPoint points[3];
+
+    SDL_RenderSetScale(target, 1.5f, 0.75f);
+    if (frame == 0) {
+        SDL_SetRenderDrawColor(target, 30, 30, 30, 255);
+        SDL_RenderClear(target);
+    }
+    SDL_SetRenderDrawColor(target, (Uint8)(frame * 40), 200, (Uint8)(255 - frame * 30), 255);
+    rect.x = -10.5f + frame * 17.25f;
+    rect.y = 20.0f + frame * 13.5f;
+    rect.w = 30.0f;
+    rect.h = 25.0f;
+    SDL_RenderFillRectF(target, &rect);
+
+    rect.x = 150.25f - frame * 23.0f;
+    rect.y = -15.75f + frame * 29.0f;
+    rect.w = 41.0f;
+    rect.h = 37.0f;
+    SDL_RenderCopyExF(target, face, NULL, &rect, 17.0 + frame * 41.0, NULL, (SDL_RendererFlip)(frame % 3));
+
+    points[0].x = 5.0f + frame * 11.0f;
+    points[0].y = 300.0f;
+    points[1].x = 200.0f - frame * 9.0f;
+    points[1].y = 10.0f + frame * 7.0f;
+    points[2].x = 210.0f;
+    points[2].y = 310.0f - frame * 19.0f;
+    SDL_RenderDrawLinesF(target, points, 3);
+    SDL_RenderSetScale(target, 1.0f, 1.0f);
+}
+
+/**
+ * @brief Tests that presenting only the areas drawn since the last present
+ * shows the same frames as drawing everything.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderPresent
+ */
+int render_testDirtyPresent(void *arg)
+{
+    SDL_RendererInfo info;
+    SDL_Surface *full;
+    SDL_Renderer *full_renderer;
+    SDL_Texture *face, *full_face;
+    SDL_Surface *face_surface;
+    Uint32 *pixels;
+    int w, h, frame, y, rows;
+
+    if (SDL_GetRendererInfo(renderer, &info) < 0 || SDL_strcmp(info.name, "software") != 0) {
+        SDLTest_Log("Skipping dirty present test, the renderer isn't the software one");
+        return TEST_SKIPPED;
+    }
+
+    SDL_GetRendererOutputSize(renderer, &w, &h);
+    full = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    pixels = (Uint32 *)SDL_malloc(w * h * sizeof(*pixels));
+    full_renderer = full ? SDL_CreateSoftwareRenderer(full) : NULL;
+    face_surface = SDLTest_ImageFace();
+    face = _loadTestFace();
+    full_face = full_renderer && face_surface ? SDL_CreateTextureFromSurface(full_renderer, face_surface) : NULL;
+    SDLTest_AssertCheck(pixels != NULL && full_renderer != NULL && face != NULL && full_face != NULL, "Verify the reference renderer and textures were created");
+    if (!pixels || !full_renderer || !face || !full_face) {
+        if (face) {
+            SDL_DestroyTexture(face);
+        }
+        if (full_renderer) {
+            SDL_DestroyRenderer(full_renderer);
+        }
+        SDL_FreeSurface(face_surface);
+        SDL_FreeSurface(full);
+        SDL_free(pixels);
+        return TEST_ABORTED;
+    }
+
+    for (frame = 0; frame < 8; ++frame) {
+        _drawDirtyFrame(renderer, face, frame);
+        SDL_RenderPresent(renderer);
+        _drawDirtyFrame(full_renderer, full_face, frame);
+        SDL_RenderFlush(full_renderer);
+
+        SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_ARGB8888, pixels, w * sizeof(*pixels));
+        for (y = 0, rows = 0; y < h; ++y) {
+            if (SDL_memcmp(pixels + y * w, (Uint8 *)full->pixels + y * full->pitch, w * sizeof(*pixels)) == 0) {
+                ++rows;
+            }
+        }
+        SDLTest_AssertCheck(rows == h, "Verify frame %i matches a full redraw, matching rows: %i of %i", frame, rows, h);
+    }
+
+    SDL_DestroyTexture(face);
+    SDL_DestroyTexture(full_face);
+    SDL_DestroyRenderer(full_renderer);
+    SDL_FreeSurface(face_surface);
+    SDL_FreeSurface(full);
+    SDL_free(pixels);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1161,9 +1921,39 @@ static const SDLTest_TestCaseReference renderTest7 = {
     (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED
 };
 
+static const SDLTest_TestCaseReference renderTest8 = {
+    (SDLTest_TestCaseFp)render_testReadPixelsAsync, "render_testReadPixelsAsync", "Tests reading back presented frames asynchronously", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest9 = {
+    (SDLTest_TestCaseFp)render_testBlitSprites, "render_testBlitSprites", "Tests drawing sprites from a texture atlas", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest10 = {
+    (SDLTest_TestCaseFp)render_testSoftwareTiles, "render_testSoftwareTiles", "Tests drawing by tile on several threads against drawing on one", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest11 = {
+    (SDLTest_TestCaseFp)render_testDirtyPresent, "render_testDirtyPresent", "Tests presenting only the drawn areas against a full redraw", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest12 = {
+    (SDLTest_TestCaseFp)render_testGeometryColorKey, "render_testGeometryColorKey", "Tests triangles drawn from a colorkeyed surface", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest13 = {
+    (SDLTest_TestCaseFp)render_testBlitSpritesGeometry, "render_testBlitSpritesGeometry", "Tests drawing sprites on the renderers that draw them as geometry", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest14 = {
+    (SDLTest_TestCaseFp)render_testRotateSIMD, "render_testRotateSIMD", "Tests rotating with the SIMD row kernels against the scalar code", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9,
+    &renderTest10, &renderTest11, &renderTest12,
+    &renderTest13, &renderTest14, NULL
 };
 
 /* Render test suite (global) */
@@ -594,6 +594,231 @@ int surface_testBlitBlendLoop(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests premultiplied alpha blitting against the blend equation.
+ */
+int surface_testBlitBlendPremultiplied(void *arg)
+{
+    const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888 };
+    const Uint8 colorMods[] = { 255, 128 };
+    SDL_BlendMode blendMode;
+    SDL_Surface *src, *dst;
+    int f, m, i, ret;
+
+    for (f = 0; f < SDL_arraysize(formats); ++f) {
+        /* 35 pixels covers the vector loops and the leftover pixels, the color mod uses the generic blitter */
+        for (m = 0; m < SDL_arraysize(colorMods); ++m) {
+            src = SDL_CreateRGBSurfaceWithFormat(0, 35, 1, 32, formats[f]);
+            dst = SDL_CreateRGBSurfaceWithFormat(0, 35, 1, 32, formats[f]);
+            SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+            if (!src || !dst) {
+                return TEST_ABORTED;
+            }
+            for (i = 0; i < src->w; ++i) {
+                Uint8 a = (Uint8)(i * 255 / (src->w - 1));
+                ((Uint32 *)src->pixels)[i] = SDL_MapRGBA(src->format, a / 2, a / 3, a, a);
+                ((Uint32 *)dst->pixels)[i] = SDL_MapRGBA(dst->format, 200, (Uint8)(i * 7), 30, 255 - a);
+            }
+
+            ret = SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+            SDL_GetSurfaceBlendMode(src, &blendMode);
+            SDLTest_AssertCheck(blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED, "Verify blend mode, expected: %i, got: %i", SDL_BLENDMODE_BLEND_PREMULTIPLIED, blendMode);
+            SDL_SetSurfaceColorMod(src, 255, 255, colorMods[m]);
+            ret = SDL_BlitSurface(src, NULL, dst, NULL);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+            for (i = 0; i < src->w; ++i) {
+                Uint8 a = (Uint8)(i * 255 / (src->w - 1));
+                Uint8 sr = a / 2, sg = a / 3, sb = (Uint8)(a * colorMods[m] / 255);
+                Uint8 r, g, b, da;
+                int er = sr + (200 * (255 - a) + 127) / 255;
+                int eg = sg + ((i * 7) * (255 - a) + 127) / 255;
+                int eb = sb + (30 * (255 - a) + 127) / 255;
+                int ea = a + ((255 - a) * (255 - a) + 127) / 255;
+
+                SDL_GetRGBA(((Uint32 *)dst->pixels)[i], dst->format, &r, &g, &b, &da);
+                if (r != er || g != eg || b != eb || da != ea) {
+                    SDLTest_AssertCheck(SDL_FALSE, "Pixel %i: expected %i,%i,%i,%i, got %i,%i,%i,%i", i, er, eg, eb, ea, r, g, b, da);
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(i == src->w, "Verify premultiplied blend result for format %s", SDL_GetPixelFormatName(formats[f]));
+
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
+/* 32 bit surfaces use the one pass linear scaler when not scaling up vertically,
+   24 bit surfaces always take the two pass one, and both must agree */
+int surface_testStretchLinearPasses(void *arg)
+{
+    const struct
+    {
+        int w, h;
+    } sizes[] = { { 20, 11 }, { 61, 23 }, { 13, 17 }, { 80, 5 }, { 37, 1 }, { 7, 46 }, { 100, 70 } };
+    SDL_Surface *src32, *src24, *dst32, *dst24, *cmp;
+    int i, x, y, ret;
+
+    src32 = SDL_CreateRGBSurfaceWithFormat(0, 37, 23, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src32 != NULL, "Verify source surface is not NULL");
+    if (!src32) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < src32->h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src32->pixels + y * src32->pitch);
+        for (x = 0; x < src32->w; ++x) {
+            row[x] = SDL_MapRGBA(src32->format, (Uint8)(x * 67 + y * 13), (Uint8)(x * y * 5), (Uint8)(255 - y * 11), 255);
+        }
+    }
+    src24 = SDL_ConvertSurfaceFormat(src32, SDL_PIXELFORMAT_RGB24, 0);
+    SDLTest_AssertCheck(src24 != NULL, "Verify 24 bit source surface is not NULL");
+    if (!src24) {
+        SDL_FreeSurface(src32);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(sizes); ++i) {
+        dst32 = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].w, sizes[i].h, 32, SDL_PIXELFORMAT_ARGB8888);
+        dst24 = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].w, sizes[i].h, 24, SDL_PIXELFORMAT_RGB24);
+        SDLTest_AssertCheck(dst32 != NULL && dst24 != NULL, "Verify destination surfaces are not NULL");
+        if (!dst32 || !dst24) {
+            SDL_FreeSurface(dst32);
+            SDL_FreeSurface(dst24);
+            break;
+        }
+
+        ret = SDL_SoftStretchLinear(src32, NULL, dst32, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear (32 bit), expected: 0, got: %i", ret);
+        ret = SDL_SoftStretchLinear(src24, NULL, dst24, NULL);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SoftStretchLinear (24 bit), expected: 0, got: %i", ret);
+
+        cmp = SDL_ConvertSurfaceFormat(dst24, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDLTest_AssertCheck(cmp != NULL, "Verify converted surface is not NULL");
+        if (cmp) {
+            for (y = 0; y < cmp->h; ++y) {
+                if (SDL_memcmp((Uint8 *)dst32->pixels + y * dst32->pitch, (Uint8 *)cmp->pixels + y * cmp->pitch, cmp->w * 4) != 0) {
+                    break;
+                }
+            }
+            SDLTest_AssertCheck(y == cmp->h, "Verify 37x23 to %ix%i matches between passes, matching rows: %i of %i", sizes[i].w, sizes[i].h, y, cmp->h);
+            SDL_FreeSurface(cmp);
+        }
+
+        SDL_FreeSurface(dst32);
+        SDL_FreeSurface(dst24);
+    }
+
+    SDL_FreeSurface(src24);
+    SDL_FreeSurface(src32);
+
+    return TEST_COMPLETED;
+}
+
+/* Draws src over all of dst with a software renderer using scaleMode, the only
+   way to reach the bicubic and Lanczos scalers */
+static int _stretchWithScaleMode(SDL_Surface *src, SDL_Surface *dst, SDL_ScaleMode scaleMode)
+{
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    int ret = -1;
+
+    renderer = SDL_CreateSoftwareRenderer(dst);
+    if (!renderer) {
+        return -1;
+    }
+    texture = SDL_CreateTexture(renderer, src->format->format, SDL_TEXTUREACCESS_STATIC, src->w, src->h);
+    if (texture &&
+        SDL_UpdateTexture(texture, NULL, src->pixels, src->pitch) == 0 &&
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE) == 0 &&
+        SDL_SetTextureScaleMode(texture, scaleMode) == 0 &&
+        SDL_RenderCopy(renderer, texture, NULL, NULL) == 0) {
+        ret = SDL_RenderFlush(renderer);
+    }
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    return ret;
+}
+
+/* The filter taps are clamped to the edges of the source and sum to one, so flat
+   areas, 1 pixel sources included, come out unchanged right up to the edges */
+int surface_testStretchFilters(void *arg)
+{
+    const SDL_ScaleMode modes[] = { SDL_ScaleModeBicubic, SDL_ScaleModeLanczos };
+    const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24 };
+    const struct
+    {
+        int src_w, src_h, dst_w, dst_h;
+    } sizes[] = {
+        { 1, 1, 7, 5 }, { 1, 9, 6, 13 }, { 9, 1, 4, 3 }, { 1, 1, 1, 1 },
+        { 16, 8, 40, 20 }, { 48, 8, 18, 3 }, { 16, 8, 16, 8 }, { 24, 4, 61, 2 }
+    };
+    SDL_Surface *src, *dst;
+    int m, f, i, x, y, ret;
+
+    for (m = 0; m < SDL_arraysize(modes); ++m) {
+        for (f = 0; f < SDL_arraysize(formats); ++f) {
+            for (i = 0; i < SDL_arraysize(sizes); ++i) {
+                Uint32 left, right;
+                int mismatches = 0;
+
+                src = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].src_w, sizes[i].src_h, 0, formats[f]);
+                dst = SDL_CreateRGBSurfaceWithFormat(0, sizes[i].dst_w, sizes[i].dst_h, 0, formats[f]);
+                SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+                if (!src || !dst) {
+                    SDL_FreeSurface(src);
+                    SDL_FreeSurface(dst);
+                    return TEST_ABORTED;
+                }
+
+                /* Wide sources get two flat halves, far enough apart that the edge columns only see one of them */
+                left = SDL_MapRGBA(src->format, 200, 30, 90, 160);
+                right = (src->w >= 16) ? SDL_MapRGBA(src->format, 10, 250, 120, 40) : left;
+                SDL_FillRect(src, NULL, left);
+                if (src->w >= 16) {
+                    SDL_Rect half;
+                    half.x = src->w / 2;
+                    half.y = 0;
+                    half.w = src->w - half.x;
+                    half.h = src->h;
+                    SDL_FillRect(src, &half, right);
+                }
+                SDL_FillRect(dst, NULL, 0);
+
+                ret = _stretchWithScaleMode(src, dst, modes[m]);
+                SDLTest_AssertCheck(ret == 0, "Verify result from drawing with scale mode %i, expected: 0, got: %i", modes[m], ret);
+
+                for (y = 0; y < dst->h; ++y) {
+                    for (x = 0; x < dst->w; ++x) {
+                        const Uint8 *p = (const Uint8 *)dst->pixels + y * dst->pitch + x * dst->format->BytesPerPixel;
+                        Uint32 pixel = 0;
+
+                        if (right != left && x != 0 && x != dst->w - 1) {
+                            continue;
+                        }
+                        SDL_memcpy(&pixel, p, dst->format->BytesPerPixel);
+                        if (pixel != ((x == 0) ? left : right)) {
+                            mismatches++;
+                        }
+                    }
+                }
+                SDLTest_AssertCheck(mismatches == 0, "Verify %s %ix%i to %ix%i with scale mode %i keeps flat areas, mismatches: %i",
+                                    SDL_GetPixelFormatName(formats[f]), sizes[i].src_w, sizes[i].src_h,
+                                    sizes[i].dst_w, sizes[i].dst_h, modes[m], mismatches);
+
+                SDL_FreeSurface(src);
+                SDL_FreeSurface(dst);
+            }
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
 int surface_testOverflow(void *arg)
 {
     char buf[1024];
@@ -852,6 +1077,18 @@ static const SDLTest_TestCaseReference surfaceTest12 = {
     (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTest13 = {
+    (SDLTest_TestCaseFp)surface_testBlitBlendPremultiplied, "surface_testBlitBlendPremultiplied", "Tests blitting routines with premultiplied alpha blending mode.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest14 = {
+    (SDLTest_TestCaseFp)surface_testStretchLinearPasses, "surface_testStretchLinearPasses", "Tests the one and two pass linear scalers against each other.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest15 = {
+    (SDLTest_TestCaseFp)surface_testStretchFilters, "surface_testStretchFilters", "Tests the bicubic and Lanczos scalers on flat areas, edges and 1 pixel sources.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestOverflow = {
     surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED
 };
@@ -860,7 +1097,8 @@ static const SDLTest_TestCaseReference surfaceTestOverflow = {
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14,
+    &surfaceTest15, &surfaceTestOverflow, NULL
 };
 
 /* Surface test suite (global) */
@@ -2251,6 +2251,281 @@ static int video_getWindowSurface(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Frames streamed by the offscreen driver in the frame sink tests */
+#define SINK_W 24
+#define SINK_H 10
+
+static const char *OffscreenSinkFilename = "video_offscreen_frames";
+static char *videoDriverBeforeSink;
+
+/*
+ * Restarts the video subsystem on the offscreen driver, with its frames sent to 'sink'
+ */
+static SDL_bool _startOffscreenSink(const char *sink, const char *format)
+{
+    const char *driver = SDL_GetCurrentVideoDriver();
+
+    videoDriverBeforeSink = driver ? SDL_strdup(driver) : NULL;
+    SDL_VideoQuit();
+    SDL_SetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK, sink);
+    SDL_SetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAME_FORMAT, format);
+    if (SDL_VideoInit("offscreen") < 0) {
+        SDLTest_Log("Skipping frame sink test, the offscreen video driver isn't available: %s", SDL_GetError());
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/*
+ * Goes back to the video driver the tests were started with
+ */
+static void _stopOffscreenSink(void)
+{
+    SDL_VideoQuit();
+    SDL_ResetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK);
+    SDL_ResetHint(SDL_HINT_VIDEO_OFFSCREEN_FRAME_FORMAT);
+    SDL_VideoInit(videoDriverBeforeSink);
+    SDL_free(videoDriverBeforeSink);
+    videoDriverBeforeSink = NULL;
+}
+
+static Uint32 _sinkPixel(int x, int y, int frame)
+{
+    return ((Uint32)((x * 10 + frame * 40) & 0xFF) << 16) | ((Uint32)((y * 20) & 0xFF) << 8) | (Uint32)((frame * 50) & 0xFF);
+}
+
+/*
+ * Presents 'count' frames of a pattern changing with the frame number, then destroys the window
+ */
+static void _presentSinkFrames(int count)
+{
+    SDL_Window *window;
+    SDL_Surface *surface;
+    int frame, x, y, result;
+
+    window = SDL_CreateWindow("Frame sink", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SINK_W, SINK_H, 0);
+    SDLTest_AssertCheck(window != NULL, "Validate that returned window is not NULL");
+    if (!window) {
+        return;
+    }
+    surface = SDL_GetWindowSurface(window);
+    SDLTest_AssertCheck(surface != NULL && surface->format->format == SDL_PIXELFORMAT_RGB888,
+                        "Validate that the window surface is RGB888");
+    if (surface && surface->format->format == SDL_PIXELFORMAT_RGB888) {
+        for (frame = 0; frame < count; ++frame) {
+            for (y = 0; y < SINK_H; ++y) {
+                Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+                for (x = 0; x < SINK_W; ++x) {
+                    row[x] = _sinkPixel(x, y, frame);
+                }
+            }
+            result = SDL_UpdateWindowSurface(window);
+            SDLTest_AssertCheck(result == 0, "Verify frame %d was presented, got: %d", frame, result);
+        }
+    }
+    SDL_DestroyWindow(window);
+}
+
+/*
+ * Checks that 'count' raw RGB888 frames from _presentSinkFrames() start at 'frames'
+ */
+static void _checkSinkFrames(const Uint8 *frames, int first, int count, size_t stride)
+{
+    int frame, x, y, mismatches = 0;
+
+    for (frame = first; frame < first + count; ++frame) {
+        const Uint8 *pixels = frames + (frame - first) * stride;
+        for (y = 0; y < SINK_H; ++y) {
+            for (x = 0; x < SINK_W; ++x) {
+                Uint32 pixel;
+                SDL_memcpy(&pixel, pixels + (y * SINK_W + x) * 4, 4);
+                if ((pixel & 0x00FFFFFF) != _sinkPixel(x, y, frame)) {
+                    ++mismatches;
+                }
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify frames %d to %d match what was presented, mismatched pixels: %d", first, first + count - 1, mismatches);
+}
+
+/**
+ * Tests the offscreen driver writing frames to a file
+ *
+ * @sa SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK
+ */
+static int video_offscreenFrameSinkFile(void *arg)
+{
+    const size_t frame_size = SINK_W * SINK_H * 4;
+    const size_t yuv_frame_size = SINK_W * SINK_H + 2 * ((SINK_W + 1) / 2) * ((SINK_H + 1) / 2);
+    const char *header = "YUV4MPEG2 W24 H10 ";
+    SDL_Window *window;
+    Uint8 *data;
+    size_t size, offset;
+    int frame;
+
+    if (!_startOffscreenSink(OffscreenSinkFilename, "rgb")) {
+        _stopOffscreenSink();
+        return TEST_SKIPPED;
+    }
+    _presentSinkFrames(3);
+    _stopOffscreenSink();
+    data = (Uint8 *)SDL_LoadFile(OffscreenSinkFilename, &size);
+    SDLTest_AssertCheck(data != NULL && size == 3 * frame_size, "Verify raw stream size, expected: %d, got: %d", (int)(3 * frame_size), (int)size);
+    if (data && size == 3 * frame_size) {
+        _checkSinkFrames(data, 0, 3, frame_size);
+    }
+    SDL_free(data);
+
+    /* A YUV4MPEG2 stream has a header, then a FRAME line before each frame */
+    _startOffscreenSink(OffscreenSinkFilename, "yuv");
+    _presentSinkFrames(2);
+    _stopOffscreenSink();
+    data = (Uint8 *)SDL_LoadFile(OffscreenSinkFilename, &size);
+    SDLTest_AssertCheck(data != NULL && size > SDL_strlen(header) && SDL_memcmp(data, header, SDL_strlen(header)) == 0,
+                        "Verify the stream starts with '%s'", header);
+    if (data) {
+        for (offset = 0; offset < size && data[offset] != '\n'; ++offset) {
+        }
+        ++offset;
+        for (frame = 0; frame < 2 && offset + 6 <= size; ++frame) {
+            SDLTest_AssertCheck(SDL_memcmp(data + offset, "FRAME\n", 6) == 0, "Verify frame %d starts with a FRAME line", frame);
+            offset += 6 + yuv_frame_size;
+        }
+        SDLTest_AssertCheck(frame == 2 && offset == size, "Verify the stream holds 2 frames of %d bytes", (int)yuv_frame_size);
+    }
+    SDL_free(data);
+    (void)remove(OffscreenSinkFilename);
+
+    /* A sink that can't be opened fails the window surface, not a later present */
+    _startOffscreenSink("no_such_directory/frames", "rgb");
+    window = SDL_CreateWindow("Frame sink", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SINK_W, SINK_H, 0);
+    SDLTest_AssertCheck(window != NULL, "Validate that returned window is not NULL");
+    if (window) {
+        SDLTest_AssertCheck(SDL_GetWindowSurface(window) == NULL, "Validate that the window surface can't be created");
+        SDL_DestroyWindow(window);
+    }
+    _stopOffscreenSink();
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests the offscreen driver writing frames to a file descriptor
+ *
+ * @sa SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK
+ */
+static int video_offscreenFrameSinkFd(void *arg)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const size_t frame_size = SINK_W * SINK_H * 4;
+    char spec[32];
+    Uint8 *data;
+    FILE *fp;
+    long size;
+
+    fp = fopen(OffscreenSinkFilename, "w+b");
+    SDLTest_AssertCheck(fp != NULL, "Verify the frame file was opened");
+    if (!fp) {
+        return TEST_ABORTED;
+    }
+    (void)SDL_snprintf(spec, sizeof(spec), "fd:%d", fileno(fp));
+    if (!_startOffscreenSink(spec, "rgb")) {
+        _stopOffscreenSink();
+        fclose(fp);
+        (void)remove(OffscreenSinkFilename);
+        return TEST_SKIPPED;
+    }
+    _presentSinkFrames(2);
+    _stopOffscreenSink();
+
+    /* Closing the sink leaves our descriptor open */
+    SDLTest_AssertCheck(fseek(fp, 0, SEEK_END) == 0, "Verify the descriptor is still open");
+    size = ftell(fp);
+    SDLTest_AssertCheck(size == (long)(2 * frame_size), "Verify stream size, expected: %d, got: %ld", (int)(2 * frame_size), size);
+    data = (Uint8 *)SDL_malloc(2 * frame_size);
+    if (data && size == (long)(2 * frame_size) && fseek(fp, 0, SEEK_SET) == 0 && fread(data, 2 * frame_size, 1, fp) == 1) {
+        _checkSinkFrames(data, 0, 2, frame_size);
+    }
+    SDL_free(data);
+
+    /* A descriptor that isn't open fails the window surface */
+    _startOffscreenSink("fd:-1", "rgb");
+    {
+        SDL_Window *window = SDL_CreateWindow("Frame sink", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, SINK_W, SINK_H, 0);
+        SDLTest_AssertCheck(window != NULL, "Validate that returned window is not NULL");
+        if (window) {
+            SDLTest_AssertCheck(SDL_GetWindowSurface(window) == NULL, "Validate that the window surface can't be created");
+            SDL_DestroyWindow(window);
+        }
+    }
+    _stopOffscreenSink();
+
+    fclose(fp);
+    (void)remove(OffscreenSinkFilename);
+    return TEST_COMPLETED;
+#else
+    SDLTest_Log("Skipping frame sink test, file descriptor sinks need POSIX");
+    return TEST_SKIPPED;
+#endif
+}
+
+/**
+ * Tests the offscreen driver copying frames into a shared memory ring
+ *
+ * @sa SDL_HINT_VIDEO_OFFSCREEN_FRAME_SINK
+ */
+static int video_offscreenFrameSinkRing(void *arg)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    const Uint32 frame_size = SINK_W * SINK_H * 4;
+    const Uint32 slot_size = (frame_size + 63) & ~63u;
+    Uint32 fields[10];
+    char spec[64];
+    Uint8 *data;
+    size_t size;
+    int frame;
+
+    (void)SDL_snprintf(spec, sizeof(spec), "ring:%s", OffscreenSinkFilename);
+    if (!_startOffscreenSink(spec, "rgb")) {
+        _stopOffscreenSink();
+        return TEST_SKIPPED;
+    }
+    /* 6 frames go around the 4 slots, leaving frames 2 to 5 */
+    _presentSinkFrames(6);
+    _stopOffscreenSink();
+
+    data = (Uint8 *)SDL_LoadFile(OffscreenSinkFilename, &size);
+    SDLTest_AssertCheck(data != NULL && size >= 64, "Verify the ring file holds at least a header");
+    if (data && size >= 64) {
+        /* version, header_size, format, width, height, pitch, frame_size, slot_size, slot_count, frame_count */
+        SDL_memcpy(fields, data + 8, sizeof(fields));
+        SDLTest_AssertCheck(SDL_memcmp(data, "SDLFRAME", 8) == 0, "Verify the ring magic");
+        SDLTest_AssertCheck(fields[0] == 1 && fields[1] == 64, "Verify version 1 and a 64 byte header, got: %d, %d", (int)fields[0], (int)fields[1]);
+        SDLTest_AssertCheck(fields[2] == SDL_PIXELFORMAT_RGB888, "Verify the format is RGB888, got: %s", SDL_GetPixelFormatName(fields[2]));
+        SDLTest_AssertCheck(fields[3] == SINK_W && fields[4] == SINK_H && fields[5] == SINK_W * 4,
+                            "Verify the frame is %dx%d with pitch %d, got: %dx%d with pitch %d",
+                            SINK_W, SINK_H, SINK_W * 4, (int)fields[3], (int)fields[4], (int)fields[5]);
+        SDLTest_AssertCheck(fields[6] == frame_size && fields[7] == slot_size && fields[8] == 4,
+                            "Verify 4 slots of %d bytes holding %d byte frames, got: %d slots of %d bytes holding %d byte frames",
+                            (int)slot_size, (int)frame_size, (int)fields[8], (int)fields[7], (int)fields[6]);
+        SDLTest_AssertCheck(fields[9] == 6, "Verify the frame count, expected: 6, got: %d", (int)fields[9]);
+        SDLTest_AssertCheck(size == 64 + 4 * (size_t)slot_size, "Verify the ring size, expected: %d, got: %d", (int)(64 + 4 * slot_size), (int)size);
+        if (fields[1] == 64 && fields[7] == slot_size && fields[8] == 4 && size == 64 + 4 * (size_t)slot_size) {
+            for (frame = 2; frame < 6; ++frame) {
+                _checkSinkFrames(data + 64 + (frame % 4) * slot_size, frame, 1, slot_size);
+            }
+        }
+    }
+    SDL_free(data);
+    (void)remove(OffscreenSinkFilename);
+
+    return TEST_COMPLETED;
+#else
+    SDLTest_Log("Skipping frame sink test, frame rings need POSIX");
+    return TEST_SKIPPED;
+#endif
+}
+
 /* ================= Test References ================== */
 
 /* Video test cases */
@@ -2339,13 +2614,26 @@ static const SDLTest_TestCaseReference videoTest25 = {
     (SDLTest_TestCaseFp)video_getWindowSurface, "video_getWindowSurface", "Checks window surface functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference videoTest26 = {
+    (SDLTest_TestCaseFp)video_offscreenFrameSinkFile, "video_offscreenFrameSinkFile", "Checks the offscreen driver writing frames to a file", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference videoTest27 = {
+    (SDLTest_TestCaseFp)video_offscreenFrameSinkFd, "video_offscreenFrameSinkFd", "Checks the offscreen driver writing frames to a file descriptor", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference videoTest28 = {
+    (SDLTest_TestCaseFp)video_offscreenFrameSinkRing, "video_offscreenFrameSinkRing", "Checks the offscreen driver copying frames into a shared memory ring", TEST_ENABLED
+};
+
 /* Sequence of Video test cases */
 static const SDLTest_TestCaseReference *videoTests[] = {
     &videoTest1, &videoTest2, &videoTest3, &videoTest4, &videoTest5, &videoTest6,
     &videoTest7, &videoTest8, &videoTest9, &videoTest10, &videoTest11, &videoTest12,
     &videoTest13, &videoTest14, &videoTest15, &videoTest16, &videoTest17,
     &videoTest18, &videoTest19, &videoTest20, &videoTest21, &videoTest22,
-    &videoTest23, &videoTest24, &videoTest25, NULL
+    &videoTest23, &videoTest24, &videoTest25, &videoTest26, &videoTest27,
+    &videoTest28, NULL
 };
 
 /* Video test suite (global) */
@@ -38,7 +38,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
 
         /* R, G, B in alternating horizontal bands */
         for (y = 0; y < pattern->h; y += thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && y + i < pattern->h; ++i) {
                 p = (Uint8 *)pattern->pixels + (y + i) * pattern->pitch + ((y / thickness) % 3);
                 for (x = 0; x < pattern->w; ++x) {
                     *p = 0xFF;
@@ -50,7 +50,7 @@ static SDL_Surface *generate_test_pattern(int pattern_size)
         /* Black and white in alternating vertical bands */
         c = 0xFF;
         for (x = 1 * thickness; x < pattern->w; x += 2 * thickness) {
-            for (i = 0; i < thickness; ++i) {
+            for (i = 0; i < thickness && x + i < pattern->w; ++i) {
                 p = (Uint8 *)pattern->pixels + (x + i) * 3;
                 for (y = 0; y < pattern->h; ++y) {
                     SDL_memset(p, c, 3);
@@ -211,6 +211,156 @@ done:
     return result;
 }
 
+static const Uint32 benchmark_formats[] = {
+    SDL_PIXELFORMAT_YV12,
+    SDL_PIXELFORMAT_IYUV,
+    SDL_PIXELFORMAT_NV12,
+    SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2,
+    SDL_PIXELFORMAT_UYVY,
+    SDL_PIXELFORMAT_YVYU
+};
+
+/* SDL repeats the last luma sample of an odd width packed row and reads
+   the repeated sample back, so make the pattern look like that */
+static void repeat_last_packed_luma(Uint32 format, Uint8 *yuv, int pitch, int width, int height)
+{
+    const int y_offset = (format == SDL_PIXELFORMAT_UYVY) ? 1 : 0;
+    int y;
+
+    if (!is_packed_yuv_format(format) || !(width & 1)) {
+        return;
+    }
+    for (y = 0; y < height; ++y) {
+        Uint8 *row = yuv + y * pitch + y_offset;
+        row[2 * width] = row[2 * (width - 1)];
+    }
+}
+
+/* Check SDL_ConvertPixels() between YUV formats against the scalar reference
+   at every size up to max_width x max_height, covering the SIMD row tails */
+static int check_yuv_conversions(int max_width, int max_height)
+{
+    const Uint32 *formats = benchmark_formats;
+    const int yuv_len = MAX_YUV_SURFACE_SIZE(max_width, max_height, 0);
+    Uint8 *src = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *dst1 = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *dst2 = (Uint8 *)SDL_malloc(yuv_len);
+    int i, j, n, width, height;
+    int result = -1;
+
+    if (!src || !dst1 || !dst2) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate conversion buffers");
+        goto done;
+    }
+    for (n = 0; n < yuv_len; ++n) {
+        src[n] = (Uint8)rand();
+    }
+
+    for (i = 0; i < SDL_arraysize(benchmark_formats); ++i) {
+        for (j = 0; j < SDL_arraysize(benchmark_formats); ++j) {
+            if (i == j) {
+                continue;
+            }
+            for (height = 1; height <= max_height; ++height) {
+                for (width = 1; width <= max_width; ++width) {
+                    const int src_pitch = CalculateYUVPitch(formats[i], width);
+                    const int dst_pitch = CalculateYUVPitch(formats[j], width);
+
+                    repeat_last_packed_luma(formats[i], src, src_pitch, width, height);
+                    SDL_memset(dst1, 0xAA, yuv_len);
+                    SDL_memset(dst2, 0xAA, yuv_len);
+                    if (SDL_ConvertPixels(width, height, formats[i], src, src_pitch, formats[j], dst1, dst_pitch) < 0) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s\n", SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), SDL_GetError());
+                        goto done;
+                    }
+                    ConvertYUVtoYUV(formats[i], src, src_pitch, formats[j], dst2, dst_pitch, width, height);
+                    if (SDL_memcmp(dst1, dst2, yuv_len) != 0) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s to %s at %dx%d doesn't match the scalar reference\n", SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), width, height);
+                        goto done;
+                    }
+                }
+            }
+        }
+    }
+    result = 0;
+
+done:
+    SDL_free(src);
+    SDL_free(dst1);
+    SDL_free(dst2);
+    return result;
+}
+
+/* Time SDL_ConvertPixels() between YUV formats against the scalar reference in testyuv_cvt.c */
+static int run_benchmark(int width, int height, int iterations)
+{
+    const Uint32 *formats = benchmark_formats;
+    const int yuv_len = MAX_YUV_SURFACE_SIZE(width, height, 0);
+    const double frequency = (double)SDL_GetPerformanceFrequency();
+    Uint8 *src = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *dst1 = (Uint8 *)SDL_calloc(1, yuv_len);
+    Uint8 *dst2 = (Uint8 *)SDL_calloc(1, yuv_len);
+    int i, j, n;
+    int result = -1;
+
+    if (!src || !dst1 || !dst2) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate benchmark buffers");
+        goto done;
+    }
+    if (check_yuv_conversions(72, 7) < 0) {
+        goto done;
+    }
+    for (n = 0; n < yuv_len; ++n) {
+        src[n] = (Uint8)rand();
+    }
+
+    SDL_Log("Converting %dx%d, %d iterations\n", width, height, iterations);
+    for (i = 0; i < SDL_arraysize(benchmark_formats); ++i) {
+        for (j = 0; j < SDL_arraysize(benchmark_formats); ++j) {
+            const int src_pitch = CalculateYUVPitch(formats[i], width);
+            const int dst_pitch = CalculateYUVPitch(formats[j], width);
+            Uint64 start, sdl_time, reference_time;
+
+            if (i == j) {
+                continue;
+            }
+
+            start = SDL_GetPerformanceCounter();
+            for (n = 0; n < iterations; ++n) {
+                if (SDL_ConvertPixels(width, height, formats[i], src, src_pitch, formats[j], dst1, dst_pitch) < 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s to %s: %s\n", SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), SDL_GetError());
+                    goto done;
+                }
+            }
+            sdl_time = SDL_GetPerformanceCounter() - start;
+
+            start = SDL_GetPerformanceCounter();
+            for (n = 0; n < iterations; ++n) {
+                ConvertYUVtoYUV(formats[i], src, src_pitch, formats[j], dst2, dst_pitch, width, height);
+            }
+            reference_time = SDL_GetPerformanceCounter() - start;
+
+            if (SDL_memcmp(dst1, dst2, yuv_len) != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s to %s doesn't match the scalar reference\n", SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]));
+                goto done;
+            }
+            SDL_Log("%-24s -> %-24s %8.3f ms, scalar %8.3f ms, %5.2fx\n",
+                    SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]),
+                    (sdl_time * 1000.0) / (frequency * iterations),
+                    (reference_time * 1000.0) / (frequency * iterations),
+                    sdl_time ? (double)reference_time / sdl_time : 0.0);
+        }
+    }
+    result = 0;
+
+done:
+    SDL_free(src);
+    SDL_free(dst1);
+    SDL_free(dst2);
+    return result;
+}
+
 int main(int argc, char **argv)
 {
     struct
@@ -260,6 +410,7 @@ int main(int argc, char **argv)
     Uint8 *raw_yuv;
     Uint32 then, now, i, iterations = 100;
     SDL_bool should_run_automated_tests = SDL_FALSE;
+    SDL_bool should_run_benchmark = SDL_FALSE;
 
     while (argv[arg] && *argv[arg] == '-') {
         if (SDL_strcmp(argv[arg], "--jpeg") == 0) {
@@ -300,8 +451,10 @@ int main(int argc, char **argv)
             rgb_format = SDL_PIXELFORMAT_BGRA8888;
         } else if (SDL_strcmp(argv[arg], "--automated") == 0) {
             should_run_automated_tests = SDL_TRUE;
+        } else if (SDL_strcmp(argv[arg], "--benchmark") == 0) {
+            should_run_benchmark = SDL_TRUE;
         } else {
-            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--jpeg|--bt601|-bt709|--auto] [--yv12|--iyuv|--yuy2|--uyvy|--yvyu|--nv12|--nv21] [--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra] [image_filename]\n", argv[0]);
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--jpeg|--bt601|-bt709|--auto] [--yv12|--iyuv|--yuy2|--uyvy|--yvyu|--nv12|--nv21] [--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra] [--automated|--benchmark] [image_filename]\n", argv[0]);
             return 1;
         }
         ++arg;
@@ -321,6 +474,11 @@ int main(int argc, char **argv)
         return 0;
     }
 
+    /* Run the YUV to YUV benchmark */
+    if (should_run_benchmark) {
+        return run_benchmark(1920, 1080, 20) < 0 ? 2 : 0;
+    }
+
     if (argv[arg]) {
         filename = argv[arg];
     } else {
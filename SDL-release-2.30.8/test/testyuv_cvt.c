@@ -278,6 +278,105 @@ SDL_bool ConvertRGBtoYUV(Uint32 format, Uint8 *src, int pitch, Uint8 *out, int w
     }
 }
 
+typedef struct
+{
+    Uint8 *y, *u, *v;
+    int y_pitch, uv_pitch;
+    int y_step, uv_step;
+    int uv_rows; /* number of image rows per chroma row */
+} YUVPlanes;
+
+static SDL_bool GetYUVPlanes(Uint32 format, Uint8 *yuv, int pitch, int h, YUVPlanes *planes)
+{
+    const int uv_pitch = (pitch + 1) / 2;
+    Uint8 *uv = yuv + pitch * h;
+
+    planes->y = yuv;
+    planes->y_pitch = pitch;
+    planes->y_step = 1;
+    planes->uv_rows = 2;
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+        planes->v = uv;
+        planes->u = uv + uv_pitch * ((h + 1) / 2);
+        planes->uv_pitch = uv_pitch;
+        planes->uv_step = 1;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_IYUV:
+        planes->u = uv;
+        planes->v = uv + uv_pitch * ((h + 1) / 2);
+        planes->uv_pitch = uv_pitch;
+        planes->uv_step = 1;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        planes->u = (format == SDL_PIXELFORMAT_NV12) ? uv : uv + 1;
+        planes->v = (format == SDL_PIXELFORMAT_NV12) ? uv + 1 : uv;
+        planes->uv_pitch = 2 * uv_pitch;
+        planes->uv_step = 2;
+        return SDL_TRUE;
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        planes->y = (format == SDL_PIXELFORMAT_UYVY) ? yuv + 1 : yuv;
+        planes->u = yuv + ((format == SDL_PIXELFORMAT_YUY2) ? 1 : (format == SDL_PIXELFORMAT_UYVY) ? 0 : 3);
+        planes->v = yuv + ((format == SDL_PIXELFORMAT_YUY2) ? 3 : (format == SDL_PIXELFORMAT_UYVY) ? 2 : 1);
+        planes->uv_pitch = pitch;
+        planes->y_step = 2;
+        planes->uv_step = 4;
+        planes->uv_rows = 1;
+        return SDL_TRUE;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+static Uint8 GetChroma(const Uint8 *plane, const YUVPlanes *src, int x, int y, SDL_bool average)
+{
+    const Uint8 *p = plane + (y / src->uv_rows) * src->uv_pitch + x * src->uv_step;
+
+    if (average) {
+        return (Uint8)((p[0] + p[src->uv_pitch]) / 2);
+    }
+    return p[0];
+}
+
+SDL_bool ConvertYUVtoYUV(Uint32 src_format, Uint8 *src, int src_pitch, Uint32 dst_format, Uint8 *dst, int dst_pitch, int w, int h)
+{
+    YUVPlanes s, d;
+    int x, y;
+
+    if (!GetYUVPlanes(src_format, src, src_pitch, h, &s) || !GetYUVPlanes(dst_format, dst, dst_pitch, h, &d)) {
+        return SDL_FALSE;
+    }
+
+    for (y = 0; y < h; ++y) {
+        const Uint8 *srcY = s.y + y * s.y_pitch;
+        Uint8 *dstY = d.y + y * d.y_pitch;
+
+        for (x = 0; x < w; ++x) {
+            dstY[x * d.y_step] = srcY[x * s.y_step];
+        }
+        /* SDL repeats the last luma sample in an odd width packed row */
+        if ((w & 1) && d.y_step == 2) {
+            dstY[w * 2] = srcY[(w - 1) * s.y_step];
+        }
+    }
+
+    for (y = 0; y < h; y += d.uv_rows) {
+        Uint8 *dstU = d.u + (y / d.uv_rows) * d.uv_pitch;
+        Uint8 *dstV = d.v + (y / d.uv_rows) * d.uv_pitch;
+        /* Two packed rows are averaged down to one row of 2x2 chroma */
+        const SDL_bool average = (d.uv_rows > s.uv_rows && y + 1 < h);
+
+        for (x = 0; x < (w + 1) / 2; ++x) {
+            dstU[x * d.uv_step] = GetChroma(s.u, &s, x, y, average);
+            dstV[x * d.uv_step] = GetChroma(s.v, &s, x, y, average);
+        }
+    }
+    return SDL_TRUE;
+}
+
 int CalculateYUVPitch(Uint32 format, int width)
 {
     switch (format) {
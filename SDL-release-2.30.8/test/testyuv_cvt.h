@@ -13,4 +13,5 @@
 /* These functions are designed for testing correctness, not for speed */
 
 extern SDL_bool ConvertRGBtoYUV(Uint32 format, Uint8 *src, int pitch, Uint8 *out, int w, int h, SDL_YUV_CONVERSION_MODE mode, int monochrome, int luminance);
+extern SDL_bool ConvertYUVtoYUV(Uint32 src_format, Uint8 *src, int src_pitch, Uint32 dst_format, Uint8 *dst, int dst_pitch, int w, int h);
 extern int CalculateYUVPitch(Uint32 format, int width);
@@ -0,0 +1,12 @@
+cl.exe /DEBUG:FULL /Zi ^
+/I "vendor/sources/ffmpeg" ^
+/I "SDL-release-2.30.8/include" ^
+/I "vendor/build/ffmpeg/libavutil" ^
+/Fe:Debug\test-analysis.exe test_analysis.cpp ^
+vendor\installed\bin\avcodec.lib ^
+vendor\installed\bin\avformat.lib ^
+vendor\installed\bin\avutil.lib ^
+vendor\installed\bin\swscale.lib ^
+SDL-release-2.30.8\VisualC\x64\Debug\SDL2main.lib ^
+SDL-release-2.30.8\VisualC\x64\Debug\SDL2.lib ^
+/link /SUBSYSTEM:CONSOLE Shell32.lib && Debug\test-analysis.exe
@@ -2,8 +2,24 @@ extern "C" {
     #include <libavcodec/avcodec.h>
     #include <libavformat/avformat.h>
     #include <libswscale/swscale.h>
+    #include <libavutil/pixdesc.h>
+    #include <libavutil/imgutils.h>
+    #include <libavutil/crc.h>
 }
 #include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+// MSVC has SSE2 on every x64 target but doesn't define __SSE2__
+#if defined(__SSE2__) || defined(_M_X64)
+#define NECTAR_HAVE_SSE2 1
+#include <emmintrin.h>
+#endif
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
 #include <SDL.h>
 
 //
@@ -12,6 +28,7 @@ extern "C" {
 //
 // 1. ffmpeg/libav
 //
+const char *source_path = "small_bunny_1080p_60fps.mp4";
 AVFormatContext *format_ctx = NULL;
 AVCodecContext *codec_ctx = NULL;
 const AVCodec *codec = NULL;
@@ -19,17 +36,57 @@ int video_stream_index = -1;
 AVFrame *curr_frame = NULL;
 AVPacket *curr_pkt = NULL;
 
-int64_t frame_ptss[1024] = {0};
+// frames past MAX_FRAMES are not indexed for seeking or per-frame metrics
+#define MAX_FRAMES 1024
+int64_t frame_ptss[MAX_FRAMES] = {0};
 
 //
 // 2. SDL2
 //
 SDL_Window *sdl_window = NULL;
 SDL_Renderer *sdl_renderer = NULL;
-SDL_Texture *sdl_display_texture = NULL;
 int sdl_display_texture_w = 1024;
 int sdl_display_texture_h = 768;
 
+// display textures are used as a ring: one slot is presented while the
+// converter thread fills the locked pixels of the following ones. Slots are
+// filled and presented in ring order, so a slot can only be refilled once
+// the frames after it have reached the screen.
+#define DISPLAY_TEXTURE_RING_SIZE 3
+
+enum DisplaySlotState {
+    DISPLAY_SLOT_FREE,
+    DISPLAY_SLOT_CONVERTING, // locked, owned by the converter thread
+    DISPLAY_SLOT_READY,      // unlocked, waiting for its turn on screen
+    DISPLAY_SLOT_SHOWN,
+};
+
+SDL_Texture *sdl_display_textures[DISPLAY_TEXTURE_RING_SIZE] = {0};
+DisplaySlotState display_slot_states[DISPLAY_TEXTURE_RING_SIZE] = {DISPLAY_SLOT_FREE};
+int display_ring_present_index = -1;
+int display_ring_queue_index = -1; // last slot handed to the converter
+
+// a frame waiting to be written into locked texture pixels by the converter thread.
+// pixels/pitch come from SDL_LockTexture on the main thread, the converter
+// only writes to that memory and never calls into the renderer.
+struct TextureUploadJob {
+    AVFrame *frame;
+    void *pixels;
+    int pitch;
+};
+
+SDL_Thread *texture_converter_thread = NULL;
+SDL_sem *texture_job_ready_sem = NULL;
+SDL_sem *texture_job_done_sem = NULL;
+SDL_atomic_t texture_converter_quit = {0};
+TextureUploadJob texture_upload_jobs[DISPLAY_TEXTURE_RING_SIZE] = {0};
+int texture_uploads_in_flight = 0;
+
+// worst block the UI jumped to (see show_worst_block), in source pixels.
+// it is outlined while playback stays paused on its frame, w is 0 otherwise.
+int worst_block_rank = -1;
+SDL_Rect worst_block_rect = {0};
+
 //
 // 3. texture pixel format map
 //
@@ -58,6 +115,179 @@ static const struct TextureFormatEntry {
     { AV_PIX_FMT_UYVY422,        SDL_PIXELFORMAT_UYVY },
 };
 
+//
+// 4. quality metrics
+//
+#define MAX_TEST_ENCODES 8
+#define METRIC_BLOCK_SIZE 64
+#define METRIC_PSNR_MAX 100.0
+#define WORST_BLOCKS_MAX 64
+
+// per-frame grid of luma PSNR values, one per METRIC_BLOCK_SIZE square.
+// PSNR is stored in 1/256 dB steps to keep a 4K frame grid under 4KB.
+struct BlockMetricGrid {
+    int width; // of the compared frames, see ScaleTarget
+    int height;
+    int blocks_w;
+    int blocks_h;
+    uint16_t *block_psnr_q8;
+    double frame_psnr;
+};
+
+// one entry of the clip-wide "worst blocks" index.
+// the UI jumps to frame_index of encode_index and highlights the block.
+struct WorstBlockEntry {
+    int encode_index;
+    int frame_index;
+    int block_x;
+    int block_y;
+    uint16_t psnr_q8;
+};
+
+// written by analysis workers, guarded by block_metrics_mutex
+BlockMetricGrid block_metric_grids[MAX_TEST_ENCODES][MAX_FRAMES] = {0};
+WorstBlockEntry worst_blocks[WORST_BLOCKS_MAX] = {0};
+int worst_blocks_count = 0;
+int worst_blocks_stale = 0; // a frame was analyzed again, see rebuild_worst_blocks
+SDL_mutex *block_metrics_mutex = NULL;
+
+//
+// 5. multi-resolution scaling
+//
+// ladder encodes (540p/720p/...) are compared at either the source or the
+// encode geometry, the other frame is rescaled with a selectable swscale kernel.
+// scaled frames are not cached: a worker scales each frame pair once and
+// drops it, and keeping the scaled source around for the next encode of the
+// same rung would mean holding a whole decoded clip in memory.
+enum ScaleKernel {
+    SCALE_KERNEL_BILINEAR,
+    SCALE_KERNEL_BICUBIC,
+    SCALE_KERNEL_LANCZOS,
+};
+
+static const int scale_kernel_sws_flags[] = {
+    SWS_BILINEAR,
+    SWS_BICUBIC,
+    SWS_LANCZOS,
+};
+
+static const char *const scale_kernel_names[] = {
+    "bilinear",
+    "bicubic",
+    "lanczos",
+};
+
+enum ScaleTarget {
+    SCALE_TARGET_SOURCE, // encodes are upscaled to the source
+    SCALE_TARGET_ENCODE, // the source is downscaled to each encode
+};
+
+static const char *const scale_target_names[] = {
+    "source",
+    "encode",
+};
+
+ScaleKernel scale_kernel = SCALE_KERNEL_LANCZOS;
+ScaleTarget scale_target = SCALE_TARGET_SOURCE;
+
+//
+// 6. analysis jobs
+//
+// full metric passes are split at source keyframes into segments that
+// decode independently, so every worker runs its own demux+decode contexts.
+// every finished segment is appended to a checkpoint file next to the
+// test encode ("<test>.chunks") so an interrupted job resumes where it stopped.
+// the file starts with a header naming the source, metric and test file
+// version the records belong to, a checkpoint written for other inputs is
+// discarded. records carry the block grids of their frames too, so the
+// worst blocks index is complete after a resume.
+#define ANALYSIS_MIN_SEGMENT_FRAMES 120
+#define ANALYSIS_MAX_THREADS 64
+#define CHECKPOINT_MAGIC 0x4b48434e // "NCHK"
+#define CHECKPOINT_FILE_MAGIC 0x4648434e // "NCHF"
+#define CHECKPOINT_FILE_VERSION 3
+#define CHECKPOINT_METRIC_LUMA_PSNR 1
+
+// an independent demux+decode context, one per worker thread and file
+struct DecodeContext {
+    AVFormatContext *format_ctx;
+    AVCodecContext *codec_ctx;
+    AVFrame *frame;
+    AVPacket *pkt;
+    int video_stream_index;
+    int eof;
+};
+
+// every frame of a file in display order
+struct FrameIndexEntry {
+    int64_t pts;
+    int keyframe;
+};
+
+struct FrameIndex {
+    FrameIndexEntry *entries;
+    int count;
+};
+
+// start of the checkpoint file, followed by source_path_length bytes
+// of the source path (not NUL terminated).
+// the test file is identified by its size, modification time and a CRC of
+// its frame index, so re-encoding to the same path starts over.
+struct CheckpointFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t metric;
+    uint32_t scale_kernel; // kernel frames of another geometry were scaled with
+    uint32_t scale_target;
+    uint32_t source_path_length;
+    uint32_t test_index_crc;
+    int64_t test_size;
+    int64_t test_mtime;
+};
+
+// one append-only record of the checkpoint file, followed by frame_count
+// doubles of per-frame PSNR, then the block_psnr_q8 arrays of the frames
+// below MAX_FRAMES if grid_width is not 0
+struct CheckpointRecordHeader {
+    uint32_t magic;
+    uint32_t segment_index;
+    uint32_t first_frame;
+    uint32_t frame_count;
+    uint32_t grid_width; // BlockMetricGrid width and height of every frame
+    uint32_t grid_height;
+    uint32_t crc;
+};
+
+struct AnalysisJob;
+
+// a worker owns the segments [head, tail). it works forward from head so
+// its decoders mostly seek forward, and idle workers steal from tail.
+struct AnalysisWorker {
+    AnalysisJob *job;
+    int worker_index;
+    SDL_mutex *mutex;
+    int head;
+    int tail;
+};
+
+struct AnalysisJob {
+    const char *source_path;
+    const char *test_path;
+    int encode_index; // block grids are stored for this encode, -1 for none
+    FrameIndex source_index;
+    FrameIndex test_index;
+    int frame_count;
+    int segment_count;
+    int *segment_starts; // segment_count + 1 frame indexes, all source keyframes
+    uint8_t *segment_done;
+    double *frame_psnr;
+    FILE *checkpoint_file;
+    SDL_mutex *checkpoint_mutex;
+    AnalysisWorker workers[ANALYSIS_MAX_THREADS];
+    int worker_count;
+    SDL_atomic_t failed;
+};
+
 //
 // FUNCTIONS
 //
@@ -75,15 +305,40 @@ SDL_PixelFormatEnum pix_fmt_av_to_sdl(enum AVPixelFormat format) {
     return SDL_PIXELFORMAT_UNKNOWN;
 }
 
+int finish_texture_upload(int wait);
+
 // close
 //
 // Closes the SDL2 window and cleans up ffmpeg/libav resources
 void close() {
     { // SDL2
-        if (sdl_display_texture) {
-            SDL_DestroyTexture(sdl_display_texture);
-            sdl_display_texture = NULL;
+        if (texture_converter_thread) {
+            while (texture_uploads_in_flight) {
+                finish_texture_upload(1);
+            }
+            SDL_AtomicSet(&texture_converter_quit, 1);
+            SDL_SemPost(texture_job_ready_sem);
+            SDL_WaitThread(texture_converter_thread, NULL);
+            texture_converter_thread = NULL;
+        }
+        if (texture_job_ready_sem) {
+            SDL_DestroySemaphore(texture_job_ready_sem);
+            texture_job_ready_sem = NULL;
+        }
+        if (texture_job_done_sem) {
+            SDL_DestroySemaphore(texture_job_done_sem);
+            texture_job_done_sem = NULL;
+        }
+        for (int i = 0; i < DISPLAY_TEXTURE_RING_SIZE; i++) {
+            av_frame_free(&texture_upload_jobs[i].frame);
+            if (sdl_display_textures[i]) {
+                SDL_DestroyTexture(sdl_display_textures[i]);
+                sdl_display_textures[i] = NULL;
+            }
+            display_slot_states[i] = DISPLAY_SLOT_FREE;
         }
+        display_ring_present_index = -1;
+        display_ring_queue_index = -1;
         if (sdl_renderer) {
             SDL_DestroyRenderer(sdl_renderer);
             sdl_renderer = NULL;
@@ -94,6 +349,19 @@ void close() {
         }
         SDL_Quit();
     }
+    { // metrics
+        for (int e = 0; e < MAX_TEST_ENCODES; e++) {
+            for (int f = 0; f < MAX_FRAMES; f++) {
+                av_freep(&block_metric_grids[e][f].block_psnr_q8);
+            }
+        }
+        worst_blocks_count = 0;
+        worst_blocks_stale = 0;
+        if (block_metrics_mutex) {
+            SDL_DestroyMutex(block_metrics_mutex);
+            block_metrics_mutex = NULL;
+        }
+    }
     { // ffmpeg/libav
         if (curr_frame) {
             av_frame_free(&curr_frame);
@@ -169,7 +437,7 @@ const void *log_av_ptr_err(const void *ptr, const char *func_call_str, const cha
 
 int init_libav() {
     format_ctx = avformat_alloc_context();
-    if(LOGAVERR(avformat_open_input(&format_ctx, "small_bunny_1080p_60fps.mp4", NULL, NULL)) < 0) {
+    if(LOGAVERR(avformat_open_input(&format_ctx, source_path, NULL, NULL)) < 0) {
         return -1;
     }
     if(LOGAVERR(avformat_find_stream_info(format_ctx, NULL)) < 0) {
@@ -239,17 +507,19 @@ int init_sdl() {
         return -1;
     }
 
-    // texture 
-    if(LOG_SDL_PTR_ERR(sdl_display_texture, 
-        SDL_CreateTexture(
-            sdl_renderer, 
-            pix_fmt_av_to_sdl(codec_ctx->pix_fmt), 
-            SDL_TEXTUREACCESS_STREAMING, 
-            codec_ctx->width, 
-            codec_ctx->height
-        )
-    ) == NULL) {
-        return -1;
+    // textures
+    for (int i = 0; i < DISPLAY_TEXTURE_RING_SIZE; i++) {
+        if(LOG_SDL_PTR_ERR(sdl_display_textures[i], 
+            SDL_CreateTexture(
+                sdl_renderer, 
+                pix_fmt_av_to_sdl(codec_ctx->pix_fmt), 
+                SDL_TEXTUREACCESS_STREAMING, 
+                codec_ctx->width, 
+                codec_ctx->height
+            )
+        ) == NULL) {
+            return -1;
+        }
     }
 
     return 0;
@@ -257,89 +527,1336 @@ int init_sdl() {
    
 }
 
-int is_read_frame_err_ok(int errnum) {
-    if(errnum < 0) {
-        if(errnum == AVERROR_EOF) {
+// read_until_not_eagain_frame
+//
+// Decodes the next frame into curr_frame. At end of file the decoder is
+// drained with a NULL packet, so the frames it still buffers are returned too.
+// returns 0 on success, AVERROR_EOF when no frames are left, 1 on error
+int read_until_not_eagain_frame() {
+    for (;;) {
+        int errnum = avcodec_receive_frame(codec_ctx, curr_frame);
+        if(errnum == 0 || errnum == AVERROR_EOF) {
+            return errnum;
+        }
+        if(errnum != AVERROR(EAGAIN)) {
+            print_err_str(errnum);
             return 1;
         }
-        if(errnum == AVERROR(EAGAIN)) {
+        int read_frame_errnum = av_read_frame(format_ctx, curr_pkt);
+        if(read_frame_errnum == AVERROR_EOF) {
+            if(LOGAVERR(avcodec_send_packet(codec_ctx, NULL)) < 0) {
+                return 1;
+            }
+            continue;
+        }
+        if(read_frame_errnum < 0) {
+            print_err_str(read_frame_errnum);
             return 1;
         }
-        print_err_str(errnum);
-        return 0;
+        if(curr_pkt->stream_index == video_stream_index && LOGAVERR(avcodec_send_packet(codec_ctx, curr_pkt)) < 0) {
+            av_packet_unref(curr_pkt);
+            return 1;
+        }
+        av_packet_unref(curr_pkt);
     }
-    return 1;
 }
 
-int read_until_not_eagain_frame() {
-    int read_frame_errnum = 0;
-    while(read_frame_errnum = av_read_frame(format_ctx, curr_pkt), read_frame_errnum >= 0) {
-        if(curr_pkt->stream_index != video_stream_index) {
-            av_packet_unref(curr_pkt);
-            continue;
+// fill_frames_pts_array
+//
+// Decodes the whole file once to record the timestamp of every frame, then
+// seeks back to the first one. The caller flushes the drained decoder.
+int fill_frames_pts_array() {
+    int frame_index = 0;
+    int errnum = 0;
+    while((errnum = read_until_not_eagain_frame()) == 0) {
+        if(frame_index < MAX_FRAMES) {
+            frame_ptss[frame_index] = curr_frame->pts;
         }
-        if(LOGAVERR(avcodec_send_packet(codec_ctx, curr_pkt)) < 0) {
-            return 1;
+        frame_index++;
+    }
+    if(errnum != AVERROR_EOF) {
+        return 1;
+    }
+
+    // seek to first frame
+    if(LOGAVERR(av_seek_frame(format_ctx, video_stream_index, frame_ptss[0], AVSEEK_FLAG_BACKWARD)) < 0) {
+        return 1;
+    }
+    
+    return 0;
+}
+
+// row_sse_u8
+//
+// Sum of squared differences between two rows of 8-bit samples.
+// This is the only kernel used by both the block grid and the full-frame
+// PSNR, so the two can never disagree.
+static uint64_t row_sse_u8(const uint8_t *a, const uint8_t *b, int n) {
+    uint64_t sse = 0;
+    int i = 0;
+#ifdef NECTAR_HAVE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_setzero_si128();
+    // each 32-bit lane gains at most 4 * 255^2 per iteration (two madds of
+    // two products each), so flush to 64-bit before it can overflow.
+    int pending = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        __m128i dlo = _mm_sub_epi16(_mm_unpacklo_epi8(va, zero), _mm_unpacklo_epi8(vb, zero));
+        __m128i dhi = _mm_sub_epi16(_mm_unpackhi_epi8(va, zero), _mm_unpackhi_epi8(vb, zero));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(dlo, dlo));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(dhi, dhi));
+        if (++pending == 4096) {
+            uint32_t lanes[4];
+            _mm_storeu_si128((__m128i *)lanes, acc);
+            sse += (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            acc = _mm_setzero_si128();
+            pending = 0;
         }
-        int errnum = LOGAVERR(avcodec_receive_frame(codec_ctx, curr_frame));
-        if(!is_read_frame_err_ok(errnum)) {
-            print_err_str(errnum);
-            return 1;
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, acc);
+    sse += (uint64_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+    for (; i < n; i++) {
+        int d = (int)a[i] - (int)b[i];
+        sse += (uint64_t)(d * d);
+    }
+    return sse;
+}
+
+// sse_to_psnr
+//
+// Converts a sum of squared errors over sample_count 8-bit samples to PSNR in dB.
+// Identical blocks are clamped to METRIC_PSNR_MAX instead of infinity.
+static double sse_to_psnr(uint64_t sse, uint64_t sample_count) {
+    if (sse == 0 || sample_count == 0) {
+        return METRIC_PSNR_MAX;
+    }
+    double mse = (double)sse / (double)sample_count;
+    double psnr = 10.0 * log10((255.0 * 255.0) / mse);
+    return psnr > METRIC_PSNR_MAX ? METRIC_PSNR_MAX : psnr;
+}
+
+// insert_worst_block
+//
+// Keeps worst_blocks sorted from lowest to highest PSNR, holding at most
+// WORST_BLOCKS_MAX entries across every encode and frame analyzed so far.
+static void insert_worst_block(int encode_index, int frame_index, int block_x, int block_y, uint16_t psnr_q8) {
+    if (worst_blocks_count == WORST_BLOCKS_MAX && psnr_q8 >= worst_blocks[WORST_BLOCKS_MAX - 1].psnr_q8) {
+        return;
+    }
+    int pos = worst_blocks_count < WORST_BLOCKS_MAX ? worst_blocks_count : WORST_BLOCKS_MAX - 1;
+    while (pos > 0 && worst_blocks[pos - 1].psnr_q8 > psnr_q8) {
+        worst_blocks[pos] = worst_blocks[pos - 1];
+        pos--;
+    }
+    worst_blocks[pos].encode_index = encode_index;
+    worst_blocks[pos].frame_index = frame_index;
+    worst_blocks[pos].block_x = block_x;
+    worst_blocks[pos].block_y = block_y;
+    worst_blocks[pos].psnr_q8 = psnr_q8;
+    if (worst_blocks_count < WORST_BLOCKS_MAX) {
+        worst_blocks_count++;
+    }
+}
+
+// rebuild_worst_blocks
+//
+// Refills worst_blocks from every stored block grid. Entries dropped when a
+// frame is analyzed again may have evicted other blocks earlier, so only a
+// full rebuild gives the true worst blocks again.
+static void rebuild_worst_blocks() {
+    worst_blocks_count = 0;
+    for (int e = 0; e < MAX_TEST_ENCODES; e++) {
+        for (int f = 0; f < MAX_FRAMES; f++) {
+            const BlockMetricGrid *grid = &block_metric_grids[e][f];
+            if (grid->block_psnr_q8 == NULL) {
+                continue;
+            }
+            for (int by = 0; by < grid->blocks_h; by++) {
+                for (int bx = 0; bx < grid->blocks_w; bx++) {
+                    insert_worst_block(e, f, bx, by, grid->block_psnr_q8[by * grid->blocks_w + bx]);
+                }
+            }
         }
-        if(errnum == AVERROR(EAGAIN)) {
-            av_packet_unref(curr_pkt);
-            continue;
+    }
+    worst_blocks_stale = 0;
+}
+
+// compute_frame_block_metrics
+//
+// Computes the luma PSNR of test_frame against source_frame for every
+// METRIC_BLOCK_SIZE block and for the whole frame in a single pass into grid,
+// (re)allocating its block array when the geometry changed.
+// Only grid is touched, so analysis workers can call it concurrently.
+// Both frames must be the same size and use an 8-bit pixel format.
+// returns 0 on success, -1 on error
+int compute_frame_block_metrics(const AVFrame *source_frame, const AVFrame *test_frame, BlockMetricGrid *grid) {
+    if (source_frame->width != test_frame->width || source_frame->height != test_frame->height) {
+        LOGERR();
+        return -1;
+    }
+    const AVPixFmtDescriptor *desc = av_pix_fmt_desc_get((enum AVPixelFormat)test_frame->format);
+    if (desc == NULL || desc->comp[0].depth != 8 || source_frame->format != test_frame->format) {
+        LOGERR();
+        return -1;
+    }
+    // packed formats interleave luma with chroma, only planar luma is supported
+    if (desc->comp[0].step != 1) {
+        LOGERR();
+        return -1;
+    }
+
+    int width = test_frame->width;
+    int height = test_frame->height;
+    int blocks_w = (width + METRIC_BLOCK_SIZE - 1) / METRIC_BLOCK_SIZE;
+    int blocks_h = (height + METRIC_BLOCK_SIZE - 1) / METRIC_BLOCK_SIZE;
+    if (grid->block_psnr_q8 == NULL || grid->blocks_w != blocks_w || grid->blocks_h != blocks_h) {
+        av_freep(&grid->block_psnr_q8);
+        if (LOGAVPTRERR(grid->block_psnr_q8, (uint16_t *)av_malloc_array(blocks_w * blocks_h, sizeof(uint16_t))) == NULL) {
+            return -1;
         }
-        av_packet_unref(curr_pkt);
-        break;
+        grid->blocks_w = blocks_w;
+        grid->blocks_h = blocks_h;
+    }
+    grid->width = width;
+    grid->height = height;
+
+    uint64_t frame_sse = 0;
+    for (int by = 0; by < blocks_h; by++) {
+        int y0 = by * METRIC_BLOCK_SIZE;
+        int rows = SDL_min(METRIC_BLOCK_SIZE, height - y0);
+        for (int bx = 0; bx < blocks_w; bx++) {
+            int x0 = bx * METRIC_BLOCK_SIZE;
+            int cols = SDL_min(METRIC_BLOCK_SIZE, width - x0);
+            uint64_t block_sse = 0;
+            for (int y = y0; y < y0 + rows; y++) {
+                const uint8_t *src_row = source_frame->data[0] + (ptrdiff_t)y * source_frame->linesize[0] + x0;
+                const uint8_t *test_row = test_frame->data[0] + (ptrdiff_t)y * test_frame->linesize[0] + x0;
+                block_sse += row_sse_u8(src_row, test_row, cols);
+            }
+            frame_sse += block_sse;
+
+            double psnr = sse_to_psnr(block_sse, (uint64_t)rows * cols);
+            uint16_t psnr_q8 = (uint16_t)(psnr * 256.0 + 0.5);
+            grid->block_psnr_q8[by * blocks_w + bx] = psnr_q8;
+        }
+    }
+    grid->frame_psnr = sse_to_psnr(frame_sse, (uint64_t)width * height);
+    return 0;
+}
+
+// store_frame_block_metrics
+//
+// Makes grid the block grid of frame_index of encode_index and replaces that
+// frame's entries in the clip-wide worst blocks index.
+// The previous grid of the frame is handed back in grid, so a worker reuses its
+// block array for the next frame instead of allocating one per frame.
+void store_frame_block_metrics(int encode_index, int frame_index, BlockMetricGrid *grid) {
+    SDL_LockMutex(block_metrics_mutex);
+    BlockMetricGrid *stored = &block_metric_grids[encode_index][frame_index];
+    BlockMetricGrid previous = *stored;
+    *stored = *grid;
+    *grid = previous;
+    // the old blocks of a frame analyzed again can't be taken out of the
+    // index alone, it is rebuilt the next time it is read instead
+    if (previous.block_psnr_q8 != NULL) {
+        worst_blocks_stale = 1;
+    }
+    for (int by = 0; !worst_blocks_stale && by < stored->blocks_h; by++) {
+        for (int bx = 0; bx < stored->blocks_w; bx++) {
+            insert_worst_block(encode_index, frame_index, bx, by, stored->block_psnr_q8[by * stored->blocks_w + bx]);
+        }
+    }
+    SDL_UnlockMutex(block_metrics_mutex);
+}
+
+// get_worst_block
+//
+// Returns the rank-th worst block across the whole clip (0 is the worst),
+// or NULL if fewer blocks have been analyzed.
+// The pixel rect of the block is block_x/block_y times METRIC_BLOCK_SIZE.
+// Only call it while no analysis job is running.
+const WorstBlockEntry *get_worst_block(int rank) {
+    if (worst_blocks_stale) {
+        rebuild_worst_blocks();
+    }
+    if (rank < 0 || rank >= worst_blocks_count) {
+        return NULL;
+    }
+    return &worst_blocks[rank];
+}
+
+// copy_frame_to_texture_pixels
+//
+// Writes a decoded frame into memory returned by SDL_LockTexture.
+// Planar IYUV textures are locked as one buffer: Y, then U, then V
+// with half the pitch for the chroma planes.
+void copy_frame_to_texture_pixels(const AVFrame *frame, void *pixels, int pitch) {
+    uint8_t *dst = (uint8_t *)pixels;
+    if (frame->format == AV_PIX_FMT_YUV420P) {
+        int uv_pitch = (pitch + 1) / 2;
+        int uv_w = (frame->width + 1) / 2;
+        int uv_h = (frame->height + 1) / 2;
+        uint8_t *dst_u = dst + (ptrdiff_t)pitch * frame->height;
+        uint8_t *dst_v = dst_u + (ptrdiff_t)uv_pitch * uv_h;
+        av_image_copy_plane(dst, pitch, frame->data[0], frame->linesize[0], frame->width, frame->height);
+        av_image_copy_plane(dst_u, uv_pitch, frame->data[1], frame->linesize[1], uv_w, uv_h);
+        av_image_copy_plane(dst_v, uv_pitch, frame->data[2], frame->linesize[2], uv_w, uv_h);
+        return;
+    }
+    int bytes_per_row = av_image_get_linesize((enum AVPixelFormat)frame->format, frame->width, 0);
+    if (bytes_per_row < 0) {
+        LOGERR();
+        return;
+    }
+    av_image_copy_plane(dst, pitch, frame->data[0], frame->linesize[0], bytes_per_row, frame->height);
+}
 
+// texture_converter_thread_func
+//
+// Waits for upload jobs posted by the render loop and copies each job frame
+// into the locked pixels of its ring slot. Jobs are queued in ring order,
+// so the thread just follows the ring.
+int texture_converter_thread_func(void *data) {
+    (void)data;
+    int ring_index = 0;
+    for (;;) {
+        SDL_SemWait(texture_job_ready_sem);
+        if (SDL_AtomicGet(&texture_converter_quit)) {
+            break;
+        }
+        TextureUploadJob *job = &texture_upload_jobs[ring_index];
+        copy_frame_to_texture_pixels(job->frame, job->pixels, job->pitch);
+        av_frame_unref(job->frame);
+        ring_index = (ring_index + 1) % DISPLAY_TEXTURE_RING_SIZE;
+        SDL_SemPost(texture_job_done_sem);
+    }
+    return 0;
+}
+
+// init_texture_converter
+//
+// Starts the converter thread that fills display ring textures.
+// returns 0 on success, -1 on error
+int init_texture_converter() {
+    for (int i = 0; i < DISPLAY_TEXTURE_RING_SIZE; i++) {
+        if(LOGAVPTRERR(texture_upload_jobs[i].frame, av_frame_alloc()) == NULL) {
+            return -1;
+        }
+    }
+    if(LOG_SDL_PTR_ERR(texture_job_ready_sem, SDL_CreateSemaphore(0)) == NULL) {
+        return -1;
     }
-    if(read_frame_errnum < 0 && read_frame_errnum != AVERROR_EOF) {
-        print_err_str(read_frame_errnum);
+    if(LOG_SDL_PTR_ERR(texture_job_done_sem, SDL_CreateSemaphore(0)) == NULL) {
+        return -1;
+    }
+    if(LOG_SDL_PTR_ERR(texture_converter_thread, SDL_CreateThread(texture_converter_thread_func, "texture_converter", NULL)) == NULL) {
+        return -1;
+    }
+    return 0;
+}
+
+// finish_texture_upload
+//
+// Completes the oldest in-flight upload: unlocks its texture and marks the
+// slot ready to present. With wait set it blocks until the converter is done,
+// otherwise it only picks up an upload that has already finished.
+// returns 0 if an upload was completed, 1 otherwise
+int finish_texture_upload(int wait) {
+    if (texture_uploads_in_flight == 0) {
+        return 1;
+    }
+    if (wait) {
+        SDL_SemWait(texture_job_done_sem);
+    } else if (SDL_SemTryWait(texture_job_done_sem) != 0) {
         return 1;
     }
+    int ring_index = (display_ring_queue_index - texture_uploads_in_flight + 1 + DISPLAY_TEXTURE_RING_SIZE) % DISPLAY_TEXTURE_RING_SIZE;
+    texture_uploads_in_flight--;
+    SDL_UnlockTexture(sdl_display_textures[ring_index]);
+    display_slot_states[ring_index] = DISPLAY_SLOT_READY;
+    return 0;
 }
 
-int fill_frames_pts_array() {
-    int read_frame_errnum = 0;
-    int frame_index = 0;
-    while(read_frame_errnum = av_read_frame(format_ctx, curr_pkt), read_frame_errnum >= 0) {
-        if(curr_pkt->stream_index != video_stream_index) {
-            av_packet_unref(curr_pkt);
+// can_queue_texture_upload
+//
+// Whether the next ring slot can take a frame now, or once its own upload
+// finishes. Slots that are on screen or still waiting for it cannot.
+int can_queue_texture_upload() {
+    DisplaySlotState state = display_slot_states[(display_ring_queue_index + 1) % DISPLAY_TEXTURE_RING_SIZE];
+    return state == DISPLAY_SLOT_FREE || state == DISPLAY_SLOT_CONVERTING;
+}
+
+// queue_texture_upload
+//
+// Locks the next ring slot and hands frame to the converter thread. This only
+// waits when that slot is still being converted, i.e. every slot is in flight.
+// The frame is referenced, so the caller may reuse it right away.
+// returns 0 on success, -1 on error
+int queue_texture_upload(const AVFrame *frame) {
+    int ring_index = (display_ring_queue_index + 1) % DISPLAY_TEXTURE_RING_SIZE;
+    while (display_slot_states[ring_index] == DISPLAY_SLOT_CONVERTING) {
+        finish_texture_upload(1);
+    }
+    if (display_slot_states[ring_index] != DISPLAY_SLOT_FREE) {
+        LOGERR();
+        return -1;
+    }
+    TextureUploadJob *job = &texture_upload_jobs[ring_index];
+    if (SDL_LockTexture(sdl_display_textures[ring_index], NULL, &job->pixels, &job->pitch) < 0) {
+        fprintf(stderr, "Error: %s\n", SDL_GetError());
+        return -1;
+    }
+    if(LOGAVERR(av_frame_ref(job->frame, frame)) < 0) {
+        SDL_UnlockTexture(sdl_display_textures[ring_index]);
+        return -1;
+    }
+    display_slot_states[ring_index] = DISPLAY_SLOT_CONVERTING;
+    display_ring_queue_index = ring_index;
+    texture_uploads_in_flight++;
+    SDL_SemPost(texture_job_ready_sem);
+    return 0;
+}
+
+// present_display_ring
+//
+// Advances to the next ring slot if its frame is ready, frees the slot it
+// replaces and presents. With vsync on this blocks until the next refresh,
+// while the converter thread keeps filling the slots after it.
+void present_display_ring() {
+    int next_index = (display_ring_present_index + 1) % DISPLAY_TEXTURE_RING_SIZE;
+    if (display_slot_states[next_index] == DISPLAY_SLOT_READY) {
+        if (display_ring_present_index >= 0) {
+            display_slot_states[display_ring_present_index] = DISPLAY_SLOT_FREE;
+        }
+        display_slot_states[next_index] = DISPLAY_SLOT_SHOWN;
+        display_ring_present_index = next_index;
+    }
+    SDL_RenderClear(sdl_renderer);
+    if (display_ring_present_index >= 0) {
+        SDL_RenderCopy(sdl_renderer, sdl_display_textures[display_ring_present_index], NULL, NULL);
+        if (worst_block_rect.w > 0) {
+            // the frame is stretched over the whole output, so is the outline
+            int output_w = 0;
+            int output_h = 0;
+            SDL_GetRendererOutputSize(sdl_renderer, &output_w, &output_h);
+            float scale_x = (float)output_w / codec_ctx->width;
+            float scale_y = (float)output_h / codec_ctx->height;
+            SDL_FRect outline = {
+                worst_block_rect.x * scale_x,
+                worst_block_rect.y * scale_y,
+                worst_block_rect.w * scale_x,
+                worst_block_rect.h * scale_y
+            };
+            SDL_SetRenderDrawColor(sdl_renderer, 255, 0, 0, 255);
+            SDL_RenderDrawRectF(sdl_renderer, &outline);
+            SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 255);
+        }
+    }
+    SDL_RenderPresent(sdl_renderer);
+}
+
+// drop_queued_frames
+//
+// Waits for the uploads in flight and drops every frame that has not reached
+// the screen yet, so the next queued frame is the next one presented.
+void drop_queued_frames() {
+    while (texture_uploads_in_flight) {
+        finish_texture_upload(1);
+    }
+    for (int i = 0; i < DISPLAY_TEXTURE_RING_SIZE; i++) {
+        if (display_slot_states[i] == DISPLAY_SLOT_READY) {
+            display_slot_states[i] = DISPLAY_SLOT_FREE;
+        }
+    }
+    display_ring_queue_index = display_ring_present_index;
+}
+
+// seek_to_frame
+//
+// Moves playback to frame_index of the source and queues that frame for display.
+// returns 0 on success, -1 on error
+int seek_to_frame(int frame_index) {
+    drop_queued_frames();
+    int64_t pts = frame_ptss[frame_index];
+    if(LOGAVERR(av_seek_frame(format_ctx, video_stream_index, pts, AVSEEK_FLAG_BACKWARD)) < 0) {
+        return -1;
+    }
+    avcodec_flush_buffers(codec_ctx);
+    while(read_until_not_eagain_frame() == 0) {
+        if(curr_frame->pts != AV_NOPTS_VALUE && curr_frame->pts >= pts) {
+            return queue_texture_upload(curr_frame);
+        }
+        av_frame_unref(curr_frame);
+    }
+    LOGERR();
+    return -1;
+}
+
+// show_worst_block
+//
+// Seeks to the frame of the rank-th worst block of the clip and outlines the
+// block on it. The caller pauses playback so the frame stays on screen.
+// returns 0 on success, 1 if there is no such block, -1 on error
+int show_worst_block(int rank) {
+    const WorstBlockEntry *entry = get_worst_block(rank);
+    if (entry == NULL) {
+        return 1;
+    }
+    if (seek_to_frame(entry->frame_index) < 0) {
+        return -1;
+    }
+    // blocks of encodes compared at their own geometry are mapped back to source pixels
+    const BlockMetricGrid *grid = &block_metric_grids[entry->encode_index][entry->frame_index];
+    double scale_x = (double)codec_ctx->width / grid->width;
+    double scale_y = (double)codec_ctx->height / grid->height;
+    int x0 = entry->block_x * METRIC_BLOCK_SIZE;
+    int y0 = entry->block_y * METRIC_BLOCK_SIZE;
+    int x1 = SDL_min(x0 + METRIC_BLOCK_SIZE, grid->width);
+    int y1 = SDL_min(y0 + METRIC_BLOCK_SIZE, grid->height);
+    worst_block_rank = rank;
+    worst_block_rect.x = (int)floor(x0 * scale_x);
+    worst_block_rect.y = (int)floor(y0 * scale_y);
+    worst_block_rect.w = (int)ceil(x1 * scale_x) - worst_block_rect.x;
+    worst_block_rect.h = (int)ceil(y1 * scale_y) - worst_block_rect.y;
+    printf("worst block #%d: encode %d, frame %d, block %d,%d, %.2f dB\n",
+        rank, entry->encode_index, entry->frame_index, entry->block_x, entry->block_y, entry->psnr_q8 / 256.0);
+    return 0;
+}
+
+// set_scale_kernel
+//
+// Selects the swscale kernel used to bring frames to the compared geometry.
+// Analysis jobs started afterwards use the new kernel.
+void set_scale_kernel(ScaleKernel kernel) {
+    scale_kernel = kernel;
+}
+
+// set_scale_target
+//
+// Selects whether encodes are compared at the source or at their own geometry.
+// Analysis jobs started afterwards use the new target.
+void set_scale_target(ScaleTarget target) {
+    scale_target = target;
+}
+
+// find_name
+//
+// returns the index of name in names, -1 if it is not there
+int find_name(const char *name, const char *const *names, int count) {
+    for (int i = 0; i < count; i++) {
+        if (strcmp(name, names[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// open_decode_context
+//
+// Opens path and its first video stream decoder into ctx.
+// returns 0 on success, -1 on error
+int open_decode_context(const char *path, DecodeContext *ctx) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->video_stream_index = -1;
+    if(LOGAVERR(avformat_open_input(&ctx->format_ctx, path, NULL, NULL)) < 0) {
+        return -1;
+    }
+    if(LOGAVERR(avformat_find_stream_info(ctx->format_ctx, NULL)) < 0) {
+        return -1;
+    }
+    if(LOGAVERR(ctx->video_stream_index = av_find_best_stream(ctx->format_ctx, AVMEDIA_TYPE_VIDEO, -1, -1, NULL, 0)) < 0) {
+        return -1;
+    }
+    const AVCodecParameters *codecpar = ctx->format_ctx->streams[ctx->video_stream_index]->codecpar;
+    const AVCodec *decoder = NULL;
+    if(LOGAVPTRERR(decoder, avcodec_find_decoder(codecpar->codec_id)) == NULL) {
+        return -1;
+    }
+    if(LOGAVPTRERR(ctx->codec_ctx, avcodec_alloc_context3(decoder)) == NULL) {
+        return -1;
+    }
+    if(LOGAVERR(avcodec_parameters_to_context(ctx->codec_ctx, codecpar)) < 0) {
+        return -1;
+    }
+    if(LOGAVERR(avcodec_open2(ctx->codec_ctx, decoder, NULL)) < 0) {
+        return -1;
+    }
+    if(LOGAVPTRERR(ctx->frame, av_frame_alloc()) == NULL) {
+        return -1;
+    }
+    if(LOGAVPTRERR(ctx->pkt, av_packet_alloc()) == NULL) {
+        return -1;
+    }
+    return 0;
+}
+
+void close_decode_context(DecodeContext *ctx) {
+    av_frame_free(&ctx->frame);
+    av_packet_free(&ctx->pkt);
+    avcodec_free_context(&ctx->codec_ctx);
+    avformat_close_input(&ctx->format_ctx);
+}
+
+// decode_next_frame
+//
+// Decodes the next frame of ctx into ctx->frame, draining the decoder at end of file.
+// returns 0 on success, AVERROR_EOF when no frames are left, another negative AVERROR on error
+int decode_next_frame(DecodeContext *ctx) {
+    for (;;) {
+        int errnum = avcodec_receive_frame(ctx->codec_ctx, ctx->frame);
+        if (errnum != AVERROR(EAGAIN)) {
+            return errnum == AVERROR_EOF ? AVERROR_EOF : LOGAVERR(errnum);
+        }
+        if (ctx->eof) {
+            return AVERROR_EOF;
+        }
+        errnum = av_read_frame(ctx->format_ctx, ctx->pkt);
+        if (errnum == AVERROR_EOF) {
+            ctx->eof = 1;
+            LOGAVERR(avcodec_send_packet(ctx->codec_ctx, NULL));
             continue;
         }
-        if(LOGAVERR(avcodec_send_packet(codec_ctx, curr_pkt)) < 0) {
-            return 1;
+        if (LOGAVERR(errnum) < 0) {
+            return errnum;
         }
-        int errnum = LOGAVERR(avcodec_receive_frame(codec_ctx, curr_frame));
-        if(!is_read_frame_err_ok(errnum)) {
-            print_err_str(errnum);
-            return 1;
+        if (ctx->pkt->stream_index == ctx->video_stream_index) {
+            errnum = avcodec_send_packet(ctx->codec_ctx, ctx->pkt);
+            if (errnum < 0 && errnum != AVERROR_INVALIDDATA) {
+                av_packet_unref(ctx->pkt);
+                return LOGAVERR(errnum);
+            }
         }
-        if(errnum == AVERROR(EAGAIN)) {
-            av_packet_unref(curr_pkt);
+        av_packet_unref(ctx->pkt);
+    }
+}
+
+// seek_decode_context
+//
+// Positions ctx so the next decode_next_frame returns the frame with timestamp pts.
+// returns 0 on success, a negative AVERROR on error
+int seek_decode_context(DecodeContext *ctx, int64_t pts) {
+    int errnum = LOGAVERR(av_seek_frame(ctx->format_ctx, ctx->video_stream_index, pts, AVSEEK_FLAG_BACKWARD));
+    if (errnum < 0) {
+        return errnum;
+    }
+    avcodec_flush_buffers(ctx->codec_ctx);
+    ctx->eof = 0;
+    // decode up to pts and keep that frame around for the caller
+    while ((errnum = decode_next_frame(ctx)) == 0) {
+        if (ctx->frame->pts != AV_NOPTS_VALUE && ctx->frame->pts >= pts) {
+            return 0;
+        }
+        av_frame_unref(ctx->frame);
+    }
+    return errnum;
+}
+
+// decode_frame_at
+//
+// Decodes forward to the frame with timestamp pts. Frames before it are
+// dropped, and so are frames without a timestamp, which the frame index
+// leaves out, so decoded frames keep lining up with their index entries.
+// returns 0 on success, -1 on error or when the frame is missing
+int decode_frame_at(DecodeContext *ctx, int64_t pts) {
+    while (decode_next_frame(ctx) == 0) {
+        int64_t frame_pts = ctx->frame->pts;
+        if (frame_pts == pts) {
+            return 0;
+        }
+        av_frame_unref(ctx->frame);
+        if (frame_pts != AV_NOPTS_VALUE && frame_pts > pts) {
+            break;
+        }
+    }
+    LOGERR();
+    return -1;
+}
+
+static int compare_frame_index_entries(const void *a, const void *b) {
+    int64_t x = ((const FrameIndexEntry *)a)->pts;
+    int64_t y = ((const FrameIndexEntry *)b)->pts;
+    return (x > y) - (x < y);
+}
+
+// build_frame_index
+//
+// Demuxes (without decoding) the whole video stream of ctx and records every
+// frame timestamp and keyframe flag in display order, then rewinds ctx to the start.
+// Packets without a timestamp are left out, see decode_frame_at.
+// returns 0 on success, -1 on error
+int build_frame_index(DecodeContext *ctx, FrameIndex *index) {
+    int capacity = 0;
+    index->entries = NULL;
+    index->count = 0;
+    int errnum = 0;
+    while ((errnum = av_read_frame(ctx->format_ctx, ctx->pkt)) >= 0) {
+        if (ctx->pkt->stream_index == ctx->video_stream_index && ctx->pkt->pts != AV_NOPTS_VALUE) {
+            if (index->count == capacity) {
+                capacity = capacity ? capacity * 2 : 1024;
+                FrameIndexEntry *entries = (FrameIndexEntry *)av_realloc_array(index->entries, capacity, sizeof(FrameIndexEntry));
+                if (entries == NULL) {
+                    av_packet_unref(ctx->pkt);
+                    LOGERR();
+                    return -1;
+                }
+                index->entries = entries;
+            }
+            index->entries[index->count].pts = ctx->pkt->pts;
+            index->entries[index->count].keyframe = (ctx->pkt->flags & AV_PKT_FLAG_KEY) != 0;
+            index->count++;
+        }
+        av_packet_unref(ctx->pkt);
+    }
+    if (errnum != AVERROR_EOF) {
+        LOGAVERR(errnum);
+        return -1;
+    }
+    qsort(index->entries, index->count, sizeof(FrameIndexEntry), compare_frame_index_entries);
+    if (index->count > 0 && seek_decode_context(ctx, index->entries[0].pts) < 0) {
+        return -1;
+    }
+    av_frame_unref(ctx->frame);
+    return 0;
+}
+
+// compute_frame_psnr
+//
+// Whole-frame luma PSNR using the same row kernel as the block metrics,
+// for frames past MAX_FRAMES that get no block grid.
+double compute_frame_psnr(const AVFrame *source_frame, const AVFrame *test_frame) {
+    uint64_t sse = 0;
+    for (int y = 0; y < source_frame->height; y++) {
+        const uint8_t *src_row = source_frame->data[0] + (ptrdiff_t)y * source_frame->linesize[0];
+        const uint8_t *test_row = test_frame->data[0] + (ptrdiff_t)y * test_frame->linesize[0];
+        sse += row_sse_u8(src_row, test_row, source_frame->width);
+    }
+    return sse_to_psnr(sse, (uint64_t)source_frame->width * source_frame->height);
+}
+
+static void sync_file(FILE *file) {
+    fflush(file);
+#ifdef _WIN32
+    _commit(_fileno(file));
+#else
+    fsync(fileno(file));
+#endif
+}
+
+// checkpoint_grid_frames
+//
+// returns the number of frames of a record that carry a block grid
+static int checkpoint_grid_frames(const CheckpointRecordHeader *header) {
+    if (header->grid_width == 0 || header->first_frame >= MAX_FRAMES) {
+        return 0;
+    }
+    return (int)SDL_min(header->frame_count, MAX_FRAMES - header->first_frame);
+}
+
+// checkpoint_grid_blocks
+//
+// returns the number of blocks of each grid of a record
+static int checkpoint_grid_blocks(const CheckpointRecordHeader *header) {
+    int blocks_w = (header->grid_width + METRIC_BLOCK_SIZE - 1) / METRIC_BLOCK_SIZE;
+    int blocks_h = (header->grid_height + METRIC_BLOCK_SIZE - 1) / METRIC_BLOCK_SIZE;
+    return blocks_w * blocks_h;
+}
+
+// checkpoint_payload_size
+//
+// returns the size of the data following a record header
+static uint64_t checkpoint_payload_size(const CheckpointRecordHeader *header) {
+    return (uint64_t)header->frame_count * sizeof(double)
+        + (uint64_t)checkpoint_grid_frames(header) * checkpoint_grid_blocks(header) * sizeof(uint16_t);
+}
+
+static uint32_t checkpoint_crc(const CheckpointRecordHeader *header, const uint8_t *payload) {
+    const AVCRC *table = av_crc_get_table(AV_CRC_32_IEEE_LE);
+    uint32_t crc = av_crc(table, 0, (const uint8_t *)header, offsetof(CheckpointRecordHeader, crc));
+    return av_crc(table, crc, payload, (size_t)checkpoint_payload_size(header));
+}
+
+// segment_frame_range
+//
+// First frame and frame count of segment_index within job.
+static void segment_frame_range(const AnalysisJob *job, int segment_index, int *first_frame, int *frame_count) {
+    *first_frame = job->segment_starts[segment_index];
+    *frame_count = job->segment_starts[segment_index + 1] - *first_frame;
+}
+
+// partition_at_keyframes
+//
+// Splits the job frames into segments starting at source keyframes. Short
+// GOPs are merged until a segment holds at least ANALYSIS_MIN_SEGMENT_FRAMES,
+// which keeps the seek and decoder warm-up cost per segment small.
+// returns 0 on success, -1 on error
+int partition_at_keyframes(AnalysisJob *job) {
+    if(LOGAVPTRERR(job->segment_starts, (int *)av_malloc_array(job->frame_count + 1, sizeof(int))) == NULL) {
+        return -1;
+    }
+    job->segment_count = 0;
+    job->segment_starts[0] = 0;
+    for (int i = 1; i < job->frame_count; i++) {
+        if (job->source_index.entries[i].keyframe && i - job->segment_starts[job->segment_count] >= ANALYSIS_MIN_SEGMENT_FRAMES) {
+            job->segment_starts[++job->segment_count] = i;
+        }
+    }
+    job->segment_starts[++job->segment_count] = job->frame_count;
+    return 0;
+}
+
+// get_file_identity
+//
+// Size and modification time of path, which change whenever it is rewritten.
+// returns 0 on success, -1 on error
+static int get_file_identity(const char *path, int64_t *size, int64_t *mtime) {
+#ifdef _WIN32
+    struct _stat64 st;
+    if (_stat64(path, &st) != 0) {
+#else
+    struct stat st;
+    if (stat(path, &st) != 0) {
+#endif
+        LOGERR();
+        return -1;
+    }
+    *size = (int64_t)st.st_size;
+    *mtime = (int64_t)st.st_mtime;
+    return 0;
+}
+
+// frame_index_crc
+//
+// CRC of the timestamps and keyframe flags of index, field by field since
+// the entries have padding.
+static uint32_t frame_index_crc(const FrameIndex *index) {
+    const AVCRC *table = av_crc_get_table(AV_CRC_32_IEEE_LE);
+    uint32_t crc = 0;
+    for (int i = 0; i < index->count; i++) {
+        crc = av_crc(table, crc, (const uint8_t *)&index->entries[i].pts, sizeof(index->entries[i].pts));
+        crc = av_crc(table, crc, (const uint8_t *)&index->entries[i].keyframe, sizeof(index->entries[i].keyframe));
+    }
+    return crc;
+}
+
+// fill_checkpoint_file_header
+//
+// The file header for the results job is about to compute.
+// returns 0 on success, -1 on error
+static int fill_checkpoint_file_header(const AnalysisJob *job, CheckpointFileHeader *header) {
+    // zero the padding too, headers are compared with memcmp
+    memset(header, 0, sizeof(*header));
+    header->magic = CHECKPOINT_FILE_MAGIC;
+    header->version = CHECKPOINT_FILE_VERSION;
+    header->metric = CHECKPOINT_METRIC_LUMA_PSNR;
+    header->scale_kernel = scale_kernel;
+    header->scale_target = scale_target;
+    header->source_path_length = (uint32_t)strlen(job->source_path);
+    header->test_index_crc = frame_index_crc(&job->test_index);
+    return get_file_identity(job->test_path, &header->test_size, &header->test_mtime);
+}
+
+// read_checkpoint_file
+//
+// Reads the whole checkpoint file into a buffer owned by the caller (av_free).
+// returns the file size, 0 if there is no file, -1 on error
+static long read_checkpoint_file(const char *checkpoint_path, uint8_t **data) {
+    *data = NULL;
+    FILE *file = fopen(checkpoint_path, "rb");
+    if (file == NULL) {
+        return 0;
+    }
+    long size = -1;
+    if (fseek(file, 0, SEEK_END) == 0) {
+        size = ftell(file);
+    }
+    if (size > 0 && fseek(file, 0, SEEK_SET) == 0) {
+        *data = (uint8_t *)av_malloc(size);
+        if (*data == NULL || fread(*data, 1, size, file) != (size_t)size) {
+            av_freep(data);
+            size = -1;
+        }
+    }
+    fclose(file);
+    if (size < 0) {
+        LOGERR();
+    }
+    return size;
+}
+
+// load_checkpoint_grids
+//
+// Stores the block grids of a checkpoint record for the job encode.
+// returns 0 on success, -1 on error
+static int load_checkpoint_grids(AnalysisJob *job, const CheckpointRecordHeader *header, const uint8_t *payload) {
+    const double *record_psnr = (const double *)payload;
+    const uint8_t *grid_data = payload + header->frame_count * sizeof(double);
+    int blocks = checkpoint_grid_blocks(header);
+    for (int i = 0; i < checkpoint_grid_frames(header); i++) {
+        BlockMetricGrid grid = {0};
+        if(LOGAVPTRERR(grid.block_psnr_q8, (uint16_t *)av_malloc_array(blocks, sizeof(uint16_t))) == NULL) {
+            return -1;
+        }
+        memcpy(grid.block_psnr_q8, grid_data + (size_t)i * blocks * sizeof(uint16_t), blocks * sizeof(uint16_t));
+        grid.width = header->grid_width;
+        grid.height = header->grid_height;
+        grid.blocks_w = (grid.width + METRIC_BLOCK_SIZE - 1) / METRIC_BLOCK_SIZE;
+        grid.blocks_h = (grid.height + METRIC_BLOCK_SIZE - 1) / METRIC_BLOCK_SIZE;
+        grid.frame_psnr = record_psnr[i];
+        store_frame_block_metrics(job->encode_index, header->first_frame + i, &grid);
+        av_freep(&grid.block_psnr_q8);
+    }
+    return 0;
+}
+
+// load_checkpoints
+//
+// Reads every intact record of the job checkpoint file and marks its segment done.
+// A record torn by a crash fails its CRC and is skipped by scanning for the next magic.
+// Records without the block grids the job needs are analyzed again.
+// A file written for another source, test file, metric or scaling setup is
+// reported and started over. The file is then (re)opened for appending.
+// returns 0 on success, -1 on error
+int load_checkpoints(AnalysisJob *job, const char *checkpoint_path) {
+    CheckpointFileHeader expected;
+    if (fill_checkpoint_file_header(job, &expected) < 0) {
+        return -1;
+    }
+    uint8_t *data = NULL;
+    long size = read_checkpoint_file(checkpoint_path, &data);
+    if (size < 0) {
+        return -1;
+    }
+
+    long records_start = (long)sizeof(expected) + expected.source_path_length;
+    int keyed = size >= records_start
+        && memcmp(data, &expected, sizeof(expected)) == 0
+        && memcmp(data + sizeof(expected), job->source_path, expected.source_path_length) == 0;
+    if (size > 0 && !keyed) {
+        fprintf(stderr, "Warning: %s was written for other inputs, analyzing from the start\n", checkpoint_path);
+    }
+
+    long record_start = records_start;
+    while (keyed && record_start + (long)sizeof(CheckpointRecordHeader) <= size) {
+        CheckpointRecordHeader header;
+        memcpy(&header, data + record_start, sizeof(header));
+        const uint8_t *payload = data + record_start + sizeof(header);
+        int valid = header.magic == CHECKPOINT_MAGIC
+            && header.frame_count <= (uint32_t)job->frame_count
+            && header.grid_width <= UINT16_MAX
+            && header.grid_height <= UINT16_MAX
+            && checkpoint_payload_size(&header) <= (uint64_t)(size - record_start - (long)sizeof(header))
+            && checkpoint_crc(&header, payload) == header.crc;
+        if (!valid) {
+            record_start++;
             continue;
         }
-        av_packet_unref(curr_pkt);
-        frame_ptss[frame_index] = curr_frame->pts;
-        frame_index++;
+        int first_frame = 0;
+        int frame_count = 0;
+        if ((int)header.segment_index < job->segment_count) {
+            segment_frame_range(job, header.segment_index, &first_frame, &frame_count);
+        }
+        int needs_grids = job->encode_index >= 0 && first_frame < MAX_FRAMES;
+        // records from a run with a different segmentation are ignored
+        if (frame_count > 0 && (int)header.first_frame == first_frame && (int)header.frame_count == frame_count &&
+            (!needs_grids || header.grid_width != 0)) {
+            memcpy(job->frame_psnr + first_frame, payload, frame_count * sizeof(double));
+            if (needs_grids && load_checkpoint_grids(job, &header, payload) < 0) {
+                av_free(data);
+                return -1;
+            }
+            job->segment_done[header.segment_index] = 1;
+        }
+        record_start += sizeof(header) + (long)checkpoint_payload_size(&header);
     }
-    if(read_frame_errnum < 0 && read_frame_errnum != AVERROR_EOF) {
-        print_err_str(read_frame_errnum);
-        return 1;
+    av_free(data);
+
+    if (keyed) {
+        if(LOG_SDL_PTR_ERR(job->checkpoint_file, fopen(checkpoint_path, "ab")) == NULL) {
+            return -1;
+        }
+        return 0;
     }
+    if(LOG_SDL_PTR_ERR(job->checkpoint_file, fopen(checkpoint_path, "wb")) == NULL) {
+        return -1;
+    }
+    fwrite(&expected, sizeof(expected), 1, job->checkpoint_file);
+    fwrite(job->source_path, 1, expected.source_path_length, job->checkpoint_file);
+    sync_file(job->checkpoint_file);
+    return 0;
+}
 
-    // seek to first frame
-    if(LOGAVERR(av_seek_frame(format_ctx, video_stream_index, frame_ptss[0], AVSEEK_FLAG_BACKWARD)) < 0) {
-        return 1;
+// append_checkpoint
+//
+// Appends the results and block grids of a finished segment and syncs the
+// file, so the segment survives a crash from here on. A segment that can't be
+// recorded is only analyzed again by the next run.
+void append_checkpoint(AnalysisJob *job, int segment_index) {
+    int first_frame = 0;
+    int frame_count = 0;
+    segment_frame_range(job, segment_index, &first_frame, &frame_count);
+
+    CheckpointRecordHeader header;
+    header.magic = CHECKPOINT_MAGIC;
+    header.segment_index = segment_index;
+    header.first_frame = first_frame;
+    header.frame_count = frame_count;
+    header.grid_width = 0;
+    header.grid_height = 0;
+    if (job->encode_index >= 0 && first_frame < MAX_FRAMES) {
+        SDL_LockMutex(block_metrics_mutex);
+        header.grid_width = block_metric_grids[job->encode_index][first_frame].width;
+        header.grid_height = block_metric_grids[job->encode_index][first_frame].height;
+        SDL_UnlockMutex(block_metrics_mutex);
     }
-    
+
+    size_t psnr_size = frame_count * sizeof(double);
+    size_t grid_size = checkpoint_grid_blocks(&header) * sizeof(uint16_t);
+    uint8_t *payload = (uint8_t *)av_malloc((size_t)checkpoint_payload_size(&header));
+    if (payload == NULL) {
+        LOGERR();
+        return;
+    }
+    memcpy(payload, job->frame_psnr + first_frame, psnr_size);
+    int grid_frames = checkpoint_grid_frames(&header);
+    if (grid_frames > 0) {
+        SDL_LockMutex(block_metrics_mutex);
+        for (int i = 0; i < grid_frames; i++) {
+            // the grids of a segment all come from the same pair of streams
+            const BlockMetricGrid *grid = &block_metric_grids[job->encode_index][first_frame + i];
+            if (grid->width != (int)header.grid_width || grid->height != (int)header.grid_height) {
+                SDL_UnlockMutex(block_metrics_mutex);
+                av_free(payload);
+                LOGERR();
+                return;
+            }
+            memcpy(payload + psnr_size + i * grid_size, grid->block_psnr_q8, grid_size);
+        }
+        SDL_UnlockMutex(block_metrics_mutex);
+    }
+    header.crc = checkpoint_crc(&header, payload);
+
+    SDL_LockMutex(job->checkpoint_mutex);
+    fwrite(&header, sizeof(header), 1, job->checkpoint_file);
+    fwrite(payload, 1, (size_t)checkpoint_payload_size(&header), job->checkpoint_file);
+    sync_file(job->checkpoint_file);
+    SDL_UnlockMutex(job->checkpoint_mutex);
+    av_free(payload);
+}
+
+// analyze_segment
+//
+// Decodes the frames of segment_index from both files and stores their PSNR.
+// When the geometries differ, the frame not at scale_target geometry is
+// scaled with scale_kernel.
+// returns 0 on success, -1 on error
+int analyze_segment(AnalysisJob *job, DecodeContext *source_ctx, DecodeContext *test_ctx, SwsContext **sws_ctx, AVFrame *scaled_frame, BlockMetricGrid *block_grid, int segment_index) {
+    int first_frame = 0;
+    int frame_count = 0;
+    segment_frame_range(job, segment_index, &first_frame, &frame_count);
+
+    const FrameIndexEntry *source_entries = job->source_index.entries + first_frame;
+    const FrameIndexEntry *test_entries = job->test_index.entries + first_frame;
+    if (seek_decode_context(source_ctx, source_entries[0].pts) < 0 || source_ctx->frame->pts != source_entries[0].pts) {
+        LOGERR();
+        return -1;
+    }
+    if (seek_decode_context(test_ctx, test_entries[0].pts) < 0 || test_ctx->frame->pts != test_entries[0].pts) {
+        LOGERR();
+        return -1;
+    }
+    for (int i = 0; i < frame_count; i++) {
+        if (i > 0 && (decode_frame_at(source_ctx, source_entries[i].pts) < 0 || decode_frame_at(test_ctx, test_entries[i].pts) < 0)) {
+            return -1;
+        }
+        const AVFrame *source_frame = source_ctx->frame;
+        const AVFrame *test_frame = test_ctx->frame;
+        if (test_frame->width != source_frame->width || test_frame->height != source_frame->height) {
+            const AVFrame *from = scale_target == SCALE_TARGET_SOURCE ? test_frame : source_frame;
+            const AVFrame *to = scale_target == SCALE_TARGET_SOURCE ? source_frame : test_frame;
+            if(LOGAVPTRERR(*sws_ctx,
+                sws_getCachedContext(
+                    *sws_ctx,
+                    from->width,
+                    from->height,
+                    (enum AVPixelFormat)from->format,
+                    to->width,
+                    to->height,
+                    (enum AVPixelFormat)to->format,
+                    scale_kernel_sws_flags[scale_kernel] | SWS_ACCURATE_RND,
+                    NULL,
+                    NULL,
+                    NULL
+                )
+            ) == NULL) {
+                return -1;
+            }
+            av_frame_unref(scaled_frame);
+            scaled_frame->width = to->width;
+            scaled_frame->height = to->height;
+            scaled_frame->format = to->format;
+            if(LOGAVERR(sws_scale_frame(*sws_ctx, scaled_frame, from)) < 0) {
+                return -1;
+            }
+            if (scale_target == SCALE_TARGET_SOURCE) {
+                test_frame = scaled_frame;
+            } else {
+                source_frame = scaled_frame;
+            }
+        }
+        if (source_frame->format != test_frame->format) {
+            LOGERR();
+            return -1;
+        }
+        int frame_index = first_frame + i;
+        if (job->encode_index >= 0 && frame_index < MAX_FRAMES) {
+            if (compute_frame_block_metrics(source_frame, test_frame, block_grid) < 0) {
+                return -1;
+            }
+            job->frame_psnr[frame_index] = block_grid->frame_psnr;
+            store_frame_block_metrics(job->encode_index, frame_index, block_grid);
+        } else {
+            job->frame_psnr[frame_index] = compute_frame_psnr(source_frame, test_frame);
+        }
+        av_frame_unref(source_ctx->frame);
+        av_frame_unref(test_ctx->frame);
+    }
+    return 0;
+}
+
+// next_worker_segment
+//
+// Takes the next segment from the front of worker's own range, or steals
+// one from the back of another worker's range once its own is empty.
+// returns a segment index, or -1 when every range is empty
+static int next_worker_segment(AnalysisWorker *worker) {
+    AnalysisJob *job = worker->job;
+    int segment_index = -1;
+    SDL_LockMutex(worker->mutex);
+    if (worker->head < worker->tail) {
+        segment_index = worker->head++;
+    }
+    SDL_UnlockMutex(worker->mutex);
+    for (int i = 1; segment_index < 0 && i < job->worker_count; i++) {
+        AnalysisWorker *victim = &job->workers[(worker->worker_index + i) % job->worker_count];
+        SDL_LockMutex(victim->mutex);
+        if (victim->head < victim->tail) {
+            segment_index = --victim->tail;
+        }
+        SDL_UnlockMutex(victim->mutex);
+    }
+    return segment_index;
+}
+
+// analysis_worker_func
+//
+// Runs segments until every worker range is empty. Each worker owns its own
+// decode contexts, so segments are fully independent and results land
+// directly at their frame index.
+int analysis_worker_func(void *data) {
+    AnalysisWorker *worker = (AnalysisWorker *)data;
+    AnalysisJob *job = worker->job;
+    DecodeContext source_ctx = {};
+    DecodeContext test_ctx = {};
+    SwsContext *sws_ctx = NULL;
+    AVFrame *scaled_frame = NULL;
+    BlockMetricGrid block_grid = {0};
+    int result = 0;
+    if (open_decode_context(job->source_path, &source_ctx) < 0 || open_decode_context(job->test_path, &test_ctx) < 0 ||
+        LOGAVPTRERR(scaled_frame, av_frame_alloc()) == NULL) {
+        SDL_AtomicSet(&job->failed, 1);
+        result = -1;
+    }
+    while (result == 0 && !SDL_AtomicGet(&job->failed)) {
+        int segment_index = next_worker_segment(worker);
+        if (segment_index < 0) {
+            break;
+        }
+        if (job->segment_done[segment_index]) {
+            continue;
+        }
+        if (analyze_segment(job, &source_ctx, &test_ctx, &sws_ctx, scaled_frame, &block_grid, segment_index) < 0) {
+            SDL_AtomicSet(&job->failed, 1);
+            result = -1;
+            break;
+        }
+        append_checkpoint(job, segment_index);
+        job->segment_done[segment_index] = 1;
+    }
+    av_frame_free(&scaled_frame);
+    av_freep(&block_grid.block_psnr_q8);
+    sws_freeContext(sws_ctx);
+    close_decode_context(&test_ctx);
+    close_decode_context(&source_ctx);
+    return result;
+}
+
+void free_analysis_job(AnalysisJob *job) {
+    if (job->checkpoint_file) {
+        fclose(job->checkpoint_file);
+        job->checkpoint_file = NULL;
+    }
+    if (job->checkpoint_mutex) {
+        SDL_DestroyMutex(job->checkpoint_mutex);
+        job->checkpoint_mutex = NULL;
+    }
+    for (int i = 0; i < ANALYSIS_MAX_THREADS; i++) {
+        if (job->workers[i].mutex) {
+            SDL_DestroyMutex(job->workers[i].mutex);
+            job->workers[i].mutex = NULL;
+        }
+    }
+    av_freep(&job->source_index.entries);
+    av_freep(&job->test_index.entries);
+    av_freep(&job->segment_starts);
+    av_freep(&job->segment_done);
+    av_freep(&job->frame_psnr);
+}
+
+// run_analysis_job
+//
+// Computes per-frame PSNR of test_path against source_path on all cores,
+// resuming from "<test_path>.chunks" when a previous run was interrupted.
+// Frames below MAX_FRAMES also get their block grid stored for encode_index
+// (if it is not -1), resumed segments from the checkpoint records.
+// On success *frame_psnr holds frame_count values owned by the caller (av_free).
+// returns 0 on success, -1 on error
+int run_analysis_job(const char *source_path, const char *test_path, int encode_index, double **frame_psnr, int *frame_count) {
+    AnalysisJob job;
+    memset(&job, 0, sizeof(job));
+    job.source_path = source_path;
+    job.test_path = test_path;
+    job.encode_index = encode_index < MAX_TEST_ENCODES ? encode_index : -1;
+    *frame_psnr = NULL;
+    *frame_count = 0;
+
+    { // frame indexes
+        DecodeContext ctx = {};
+        int errnum = open_decode_context(source_path, &ctx);
+        if (errnum == 0) {
+            errnum = build_frame_index(&ctx, &job.source_index);
+        }
+        close_decode_context(&ctx);
+        if (errnum == 0) {
+            errnum = open_decode_context(test_path, &ctx);
+            if (errnum == 0) {
+                errnum = build_frame_index(&ctx, &job.test_index);
+            }
+            close_decode_context(&ctx);
+        }
+        if (errnum < 0) {
+            free_analysis_job(&job);
+            return -1;
+        }
+    }
+    job.frame_count = SDL_min(job.source_index.count, job.test_index.count);
+    if (job.frame_count == 0) {
+        free_analysis_job(&job);
+        return 0;
+    }
+
+    if (job.encode_index >= 0 && block_metrics_mutex == NULL &&
+        LOG_SDL_PTR_ERR(block_metrics_mutex, SDL_CreateMutex()) == NULL) {
+        free_analysis_job(&job);
+        return -1;
+    }
+
+    char checkpoint_path[1024];
+    SDL_snprintf(checkpoint_path, sizeof(checkpoint_path), "%s.chunks", test_path);
+    if (partition_at_keyframes(&job) < 0 ||
+        LOGAVPTRERR(job.segment_done, (uint8_t *)av_mallocz(job.segment_count)) == NULL ||
+        LOGAVPTRERR(job.frame_psnr, (double *)av_calloc(job.frame_count, sizeof(double))) == NULL ||
+        LOG_SDL_PTR_ERR(job.checkpoint_mutex, SDL_CreateMutex()) == NULL ||
+        load_checkpoints(&job, checkpoint_path) < 0) {
+        free_analysis_job(&job);
+        return -1;
+    }
+
+    // contiguous ranges per worker, balanced later by stealing
+    int thread_count = SDL_min(SDL_min(SDL_GetCPUCount(), ANALYSIS_MAX_THREADS), job.segment_count);
+    job.worker_count = thread_count;
+    for (int i = 0; i < thread_count; i++) {
+        AnalysisWorker *worker = &job.workers[i];
+        worker->job = &job;
+        worker->worker_index = i;
+        worker->head = (int)((int64_t)job.segment_count * i / thread_count);
+        worker->tail = (int)((int64_t)job.segment_count * (i + 1) / thread_count);
+        if(LOG_SDL_PTR_ERR(worker->mutex, SDL_CreateMutex()) == NULL) {
+            free_analysis_job(&job);
+            return -1;
+        }
+    }
+    SDL_Thread *threads[ANALYSIS_MAX_THREADS] = {0};
+    for (int i = 0; i < thread_count; i++) {
+        if(LOG_SDL_PTR_ERR(threads[i], SDL_CreateThread(analysis_worker_func, "analysis_worker", &job.workers[i])) == NULL) {
+            SDL_AtomicSet(&job.failed, 1);
+            break;
+        }
+    }
+    for (int i = 0; i < thread_count; i++) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], NULL);
+        }
+    }
+
+    if (SDL_AtomicGet(&job.failed)) {
+        free_analysis_job(&job);
+        return -1;
+    }
+    *frame_psnr = job.frame_psnr;
+    *frame_count = job.frame_count;
+    job.frame_psnr = NULL;
+    free_analysis_job(&job);
     return 0;
 }
 
 // MAIN
 //
+// test_analysis.cpp includes this file with NECTAR_NO_MAIN defined
+#ifndef NECTAR_NO_MAIN
 int main(int argc, char **argv) {
+    // every extra argument is a test encode to analyze against the source.
+    // --scale-kernel bilinear|bicubic|lanczos and --scale-to source|encode
+    // apply to the encodes after them.
+    int encode_index = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--scale-kernel") == 0 || strcmp(argv[i], "--scale-to") == 0) {
+            int is_kernel = strcmp(argv[i], "--scale-kernel") == 0;
+            int value = -1;
+            if (i + 1 < argc) {
+                value = is_kernel
+                    ? find_name(argv[i + 1], scale_kernel_names, SDL_arraysize(scale_kernel_names))
+                    : find_name(argv[i + 1], scale_target_names, SDL_arraysize(scale_target_names));
+            }
+            if (value < 0) {
+                fprintf(stderr, "Error: %s expects %s\n", argv[i], is_kernel ? "bilinear, bicubic or lanczos" : "source or encode");
+                return 1;
+            }
+            if (is_kernel) {
+                set_scale_kernel((ScaleKernel)value);
+            } else {
+                set_scale_target((ScaleTarget)value);
+            }
+            i++;
+            continue;
+        }
+        double *frame_psnr = NULL;
+        int frame_count = 0;
+        if (run_analysis_job(source_path, argv[i], encode_index++, &frame_psnr, &frame_count) < 0) {
+            fprintf(stderr, "Error: analysis of %s failed\n", argv[i]);
+            continue;
+        }
+        double psnr_sum = 0.0;
+        for (int f = 0; f < frame_count; f++) {
+            psnr_sum += frame_psnr[f];
+        }
+        printf("%s: %d frames, average PSNR %.3f dB\n", argv[i], frame_count, frame_count ? psnr_sum / frame_count : 0.0);
+        av_free(frame_psnr);
+    }
+
     if(init_libav() < 0) {
         close();
         return 1;
@@ -350,8 +1867,63 @@ int main(int argc, char **argv) {
     }
 
     fill_frames_pts_array();
+    avcodec_flush_buffers(codec_ctx);
 
+    if(init_texture_converter() < 0) {
+        close();
+        return 1;
+    }
 
-    
+    // W jumps to the next worst block of the analyzed encodes, shift+W to the
+    // previous one. Playback stays on that frame until space is pressed.
+    int quit = 0;
+    int eof = 0;
+    int paused = 0;
+    while(!quit) {
+        SDL_Event event;
+        while(SDL_PollEvent(&event)) {
+            if(event.type == SDL_QUIT) {
+                quit = 1;
+            }
+            if(event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_ESCAPE) {
+                quit = 1;
+            }
+            if(event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_w) {
+                int rank = worst_block_rank + ((event.key.keysym.mod & KMOD_SHIFT) ? -1 : 1);
+                int errnum = show_worst_block(rank);
+                if(errnum < 0) {
+                    quit = 1;
+                } else if(errnum == 0) {
+                    paused = 1;
+                    eof = 0;
+                }
+            }
+            if(event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_SPACE) {
+                paused = 0;
+                worst_block_rect.w = 0;
+            }
+        }
+
+        // the next frames are converted while the current one waits for vsync
+        if(!eof && !paused && can_queue_texture_upload()) {
+            int errnum = read_until_not_eagain_frame();
+            if(errnum == AVERROR_EOF) {
+                eof = 1;
+            } else if(errnum != 0) {
+                break;
+            } else if(queue_texture_upload(curr_frame) < 0) {
+                break;
+            }
+        }
+        while(finish_texture_upload(0) == 0) {
+        }
+        present_display_ring();
+        if((eof || paused) && texture_uploads_in_flight == 0) {
+            SDL_Delay(16);
+        }
+    }
+
+    close();
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,484 @@
+// test_analysis.cpp
+//
+// Checks for the analysis job pipeline of main.cpp. Built and run by
+// build_tests.bat from the repository root, next to the bunny sample.
+#define NECTAR_NO_MAIN
+#include "main.cpp"
+
+static int test_failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        test_failures++; \
+    } \
+} while (0)
+
+static const char *missing_path = "nectar_missing_encode.mp4";
+
+// run_worker_with_paths
+//
+// Runs one analysis worker over an empty job whose files are source and test.
+// returns the worker result
+static int run_worker_with_paths(const char *source, const char *test) {
+    AnalysisJob job;
+    memset(&job, 0, sizeof(job));
+    job.source_path = source;
+    job.test_path = test;
+    job.encode_index = -1;
+    job.worker_count = 1;
+    job.workers[0].job = &job;
+    job.workers[0].mutex = SDL_CreateMutex();
+    int result = analysis_worker_func(&job.workers[0]);
+    CHECK(SDL_AtomicGet(&job.failed) == (result < 0));
+    free_analysis_job(&job);
+    return result;
+}
+
+// a failed open must fail the job and leave nothing for cleanup to free
+static void test_worker_failing_open() {
+    CHECK(run_worker_with_paths(missing_path, missing_path) == -1);
+    CHECK(run_worker_with_paths(source_path, missing_path) == -1);
+    CHECK(run_worker_with_paths(missing_path, source_path) == -1);
+}
+
+static void test_job_failing_open() {
+    double *frame_psnr = NULL;
+    int frame_count = -1;
+    CHECK(run_analysis_job(source_path, missing_path, -1, &frame_psnr, &frame_count) == -1);
+    CHECK(frame_psnr == NULL);
+    CHECK(frame_count == 0);
+    CHECK(run_analysis_job(missing_path, source_path, -1, &frame_psnr, &frame_count) == -1);
+    CHECK(frame_psnr == NULL);
+}
+
+static const char *checkpoint_test_path = "nectar_checkpoint_test.mp4";
+
+static uint32_t test_random_state = 1;
+
+static int test_random(int range) {
+    test_random_state = test_random_state * 1103515245 + 12345;
+    return (int)((test_random_state >> 8) % (uint32_t)range);
+}
+
+// write_test_file
+//
+// Writes size bytes to path, standing in for an encode the checkpoint belongs to.
+static void write_test_file(const char *path, int size) {
+    FILE *file = fopen(path, "wb");
+    for (int i = 0; i < size; i++) {
+        fputc(i & 0xff, file);
+    }
+    fclose(file);
+}
+
+// reset_block_metrics
+//
+// Frees every stored block grid, as if the process had just started.
+static void reset_block_metrics() {
+    for (int e = 0; e < MAX_TEST_ENCODES; e++) {
+        for (int f = 0; f < MAX_FRAMES; f++) {
+            av_freep(&block_metric_grids[e][f].block_psnr_q8);
+            memset(&block_metric_grids[e][f], 0, sizeof(BlockMetricGrid));
+        }
+    }
+    worst_blocks_count = 0;
+    worst_blocks_stale = 0;
+}
+
+// init_synthetic_job
+//
+// Sets job up as run_analysis_job would for two files of frame_count frames
+// with a keyframe every gop frames, without opening them.
+static void init_synthetic_job(AnalysisJob *job, int encode_index, int frame_count, int gop) {
+    memset(job, 0, sizeof(*job));
+    job->source_path = source_path;
+    job->test_path = checkpoint_test_path;
+    job->encode_index = encode_index;
+    job->frame_count = frame_count;
+    job->source_index.count = frame_count;
+    job->test_index.count = frame_count;
+    job->source_index.entries = (FrameIndexEntry *)av_calloc(frame_count, sizeof(FrameIndexEntry));
+    job->test_index.entries = (FrameIndexEntry *)av_calloc(frame_count, sizeof(FrameIndexEntry));
+    for (int i = 0; i < frame_count; i++) {
+        job->source_index.entries[i].pts = i * 512;
+        job->source_index.entries[i].keyframe = i % gop == 0;
+        job->test_index.entries[i] = job->source_index.entries[i];
+    }
+    CHECK(partition_at_keyframes(job) == 0);
+    job->segment_done = (uint8_t *)av_mallocz(job->segment_count);
+    job->frame_psnr = (double *)av_calloc(frame_count, sizeof(double));
+    job->checkpoint_mutex = SDL_CreateMutex();
+}
+
+// alloc_luma_frame
+//
+// A yuv420p frame with random luma and a padded luma pitch. Only the luma
+// plane is allocated, it is all the metrics read.
+static AVFrame *alloc_luma_frame(int width, int height) {
+    AVFrame *frame = av_frame_alloc();
+    frame->width = width;
+    frame->height = height;
+    frame->format = AV_PIX_FMT_YUV420P;
+    frame->linesize[0] = width + 19;
+    frame->data[0] = (uint8_t *)av_malloc((size_t)frame->linesize[0] * height);
+    for (int i = 0; i < frame->linesize[0] * height; i++) {
+        frame->data[0][i] = (uint8_t)test_random(256);
+    }
+    return frame;
+}
+
+static void free_luma_frame(AVFrame *frame) {
+    av_freep(&frame->data[0]);
+    av_frame_free(&frame);
+}
+
+static void test_partition_at_keyframes() {
+    AnalysisJob job;
+    // GOPs of 50 are merged until a segment holds 120 frames, the last one
+    // takes whatever is left
+    init_synthetic_job(&job, -1, 1000, 50);
+    CHECK(job.segment_count == 7);
+    for (int i = 0; i < job.segment_count; i++) {
+        CHECK(job.segment_starts[i] == i * 150);
+    }
+    CHECK(job.segment_starts[job.segment_count] == 1000);
+    free_analysis_job(&job);
+
+    // GOPs longer than the minimum are segments of their own
+    init_synthetic_job(&job, -1, 700, 300);
+    CHECK(job.segment_count == 3);
+    CHECK(job.segment_starts[1] == 300);
+    CHECK(job.segment_starts[2] == 600);
+    CHECK(job.segment_starts[3] == 700);
+    free_analysis_job(&job);
+
+    // a clip shorter than the minimum is one segment
+    init_synthetic_job(&job, -1, 5, 1);
+    CHECK(job.segment_count == 1);
+    CHECK(job.segment_starts[0] == 0);
+    CHECK(job.segment_starts[1] == 5);
+    free_analysis_job(&job);
+}
+
+static void test_next_worker_segment() {
+    AnalysisJob job;
+    memset(&job, 0, sizeof(job));
+    job.worker_count = 3;
+    int ranges[3][2] = { { 0, 3 }, { 3, 6 }, { 6, 10 } };
+    for (int i = 0; i < job.worker_count; i++) {
+        job.workers[i].job = &job;
+        job.workers[i].worker_index = i;
+        job.workers[i].head = ranges[i][0];
+        job.workers[i].tail = ranges[i][1];
+        job.workers[i].mutex = SDL_CreateMutex();
+    }
+    // a worker drains its own range from the front, then steals from the
+    // back of the following workers' ranges
+    int expected[] = { 0, 1, 2, 5, 4, 3, 9, 8, 7, 6, -1 };
+    for (int i = 0; i < (int)SDL_arraysize(expected); i++) {
+        CHECK(next_worker_segment(&job.workers[0]) == expected[i]);
+    }
+    free_analysis_job(&job);
+}
+
+// the frame grid and worst blocks test_checkpoint_resume stores for a frame
+static void fill_test_grid(BlockMetricGrid *grid, int frame_index) {
+    grid->width = 100;
+    grid->height = 70;
+    grid->blocks_w = 2;
+    grid->blocks_h = 2;
+    grid->block_psnr_q8 = (uint16_t *)av_malloc_array(4, sizeof(uint16_t));
+    for (int b = 0; b < 4; b++) {
+        grid->block_psnr_q8[b] = (uint16_t)(1000 + (frame_index * 7 + b * 131) % 5000);
+    }
+    grid->frame_psnr = 20.0 + frame_index / 100.0;
+}
+
+// rewrite_truncated
+//
+// Cuts the last bytes_cut bytes off the checkpoint of job, like a crash in
+// the middle of append_checkpoint, and reopens it for appending.
+static void rewrite_truncated(AnalysisJob *job, const char *checkpoint_path, long bytes_cut) {
+    fclose(job->checkpoint_file);
+    uint8_t *data = NULL;
+    long size = read_checkpoint_file(checkpoint_path, &data);
+    FILE *file = fopen(checkpoint_path, "wb");
+    fwrite(data, 1, size - bytes_cut, file);
+    fclose(file);
+    av_free(data);
+    job->checkpoint_file = fopen(checkpoint_path, "ab");
+}
+
+static void test_checkpoint_resume() {
+    char checkpoint_path[1024];
+    SDL_snprintf(checkpoint_path, sizeof(checkpoint_path), "%s.chunks", checkpoint_test_path);
+    remove(checkpoint_path);
+    write_test_file(checkpoint_test_path, 4096);
+    reset_block_metrics();
+
+    // first run: segments 0, 1 and 3 are recorded, segment 2 is torn
+    AnalysisJob job;
+    init_synthetic_job(&job, 0, 600, 120);
+    CHECK(job.segment_count == 5);
+    CHECK(load_checkpoints(&job, checkpoint_path) == 0);
+    for (int f = 0; f < job.frame_count; f++) {
+        BlockMetricGrid grid = {0};
+        fill_test_grid(&grid, f);
+        job.frame_psnr[f] = grid.frame_psnr;
+        store_frame_block_metrics(0, f, &grid);
+        av_freep(&grid.block_psnr_q8);
+    }
+    append_checkpoint(&job, 0);
+    append_checkpoint(&job, 1);
+    append_checkpoint(&job, 2);
+    rewrite_truncated(&job, checkpoint_path, 1000);
+    append_checkpoint(&job, 3);
+    free_analysis_job(&job);
+
+    // the next process resumes the intact segments, grids included
+    reset_block_metrics();
+    init_synthetic_job(&job, 0, 600, 120);
+    CHECK(load_checkpoints(&job, checkpoint_path) == 0);
+    int expected_done[] = { 1, 1, 0, 1, 0 };
+    for (int i = 0; i < job.segment_count; i++) {
+        CHECK(job.segment_done[i] == expected_done[i]);
+    }
+    for (int f = 0; f < job.frame_count; f++) {
+        int done = expected_done[f / 120];
+        BlockMetricGrid expected = {0};
+        fill_test_grid(&expected, f);
+        const BlockMetricGrid *grid = &block_metric_grids[0][f];
+        CHECK(job.frame_psnr[f] == (done ? expected.frame_psnr : 0.0));
+        CHECK((grid->block_psnr_q8 != NULL) == done);
+        if (done && grid->block_psnr_q8) {
+            CHECK(grid->width == 100 && grid->height == 70 && grid->blocks_w == 2 && grid->blocks_h == 2);
+            CHECK(memcmp(grid->block_psnr_q8, expected.block_psnr_q8, 4 * sizeof(uint16_t)) == 0);
+        }
+        av_freep(&expected.block_psnr_q8);
+    }
+    // resumed blocks are back in the worst blocks index
+    const WorstBlockEntry *worst = get_worst_block(0);
+    CHECK(worst != NULL && worst->psnr_q8 == 1000 && expected_done[worst->frame_index / 120]);
+    free_analysis_job(&job);
+
+    // re-encoding to the same path discards the checkpoint
+    write_test_file(checkpoint_test_path, 4000);
+    reset_block_metrics();
+    init_synthetic_job(&job, 0, 600, 120);
+    CHECK(load_checkpoints(&job, checkpoint_path) == 0);
+    for (int i = 0; i < job.segment_count; i++) {
+        CHECK(job.segment_done[i] == 0);
+    }
+    free_analysis_job(&job);
+
+    reset_block_metrics();
+    remove(checkpoint_path);
+    remove(checkpoint_test_path);
+}
+
+// segments finish in whatever order the workers take them, results still
+// land at their frame index, in memory and after a resume
+static void test_results_merge_in_order() {
+    char checkpoint_path[1024];
+    SDL_snprintf(checkpoint_path, sizeof(checkpoint_path), "%s.chunks", checkpoint_test_path);
+    remove(checkpoint_path);
+    write_test_file(checkpoint_test_path, 100);
+
+    AnalysisJob job;
+    init_synthetic_job(&job, -1, 1000, 60);
+    CHECK(load_checkpoints(&job, checkpoint_path) == 0);
+    job.worker_count = 2;
+    for (int i = 0; i < job.worker_count; i++) {
+        job.workers[i].job = &job;
+        job.workers[i].worker_index = i;
+        job.workers[i].head = job.segment_count * i / 2;
+        job.workers[i].tail = job.segment_count * (i + 1) / 2;
+        job.workers[i].mutex = SDL_CreateMutex();
+    }
+    int segment_index = 0;
+    while ((segment_index = next_worker_segment(&job.workers[1])) >= 0) {
+        int first_frame = 0;
+        int frame_count = 0;
+        segment_frame_range(&job, segment_index, &first_frame, &frame_count);
+        for (int f = first_frame; f < first_frame + frame_count; f++) {
+            job.frame_psnr[f] = f;
+        }
+        append_checkpoint(&job, segment_index);
+    }
+    for (int f = 0; f < job.frame_count; f++) {
+        CHECK(job.frame_psnr[f] == f);
+    }
+    free_analysis_job(&job);
+
+    init_synthetic_job(&job, -1, 1000, 60);
+    CHECK(load_checkpoints(&job, checkpoint_path) == 0);
+    for (int i = 0; i < job.segment_count; i++) {
+        CHECK(job.segment_done[i] == 1);
+    }
+    for (int f = 0; f < job.frame_count; f++) {
+        CHECK(job.frame_psnr[f] == f);
+    }
+    free_analysis_job(&job);
+
+    remove(checkpoint_path);
+    remove(checkpoint_test_path);
+}
+
+static uint64_t reference_row_sse(const uint8_t *a, const uint8_t *b, int n) {
+    uint64_t sse = 0;
+    for (int i = 0; i < n; i++) {
+        int d = (int)a[i] - (int)b[i];
+        sse += (uint64_t)(d * d);
+    }
+    return sse;
+}
+
+static void test_row_sse_u8() {
+    // long enough for the SIMD accumulator to be flushed several times
+    int n = 16 * 4096 * 3 + 13;
+    uint8_t *a = (uint8_t *)av_malloc(n + 1);
+    uint8_t *b = (uint8_t *)av_malloc(n + 1);
+    memset(a, 255, n + 1);
+    memset(b, 0, n + 1);
+    CHECK(row_sse_u8(a, b, n) == (uint64_t)n * 255 * 255);
+    for (int i = 0; i < n + 1; i++) {
+        a[i] = (uint8_t)test_random(256);
+        b[i] = (uint8_t)test_random(256);
+    }
+    for (int len = 0; len < 70; len++) {
+        CHECK(row_sse_u8(a + 1, b, len) == reference_row_sse(a + 1, b, len));
+    }
+    CHECK(row_sse_u8(a + 1, b, n) == reference_row_sse(a + 1, b, n));
+    av_free(a);
+    av_free(b);
+}
+
+static void test_compute_frame_block_metrics() {
+    // odd sizes leave partial blocks on the right and bottom edges
+    int width = 203;
+    int height = 77;
+    AVFrame *source = alloc_luma_frame(width, height);
+    AVFrame *test = alloc_luma_frame(width, height);
+    // one identical block, it gets the PSNR ceiling
+    for (int y = 0; y < METRIC_BLOCK_SIZE; y++) {
+        memcpy(test->data[0] + y * test->linesize[0] + METRIC_BLOCK_SIZE, source->data[0] + y * source->linesize[0] + METRIC_BLOCK_SIZE, METRIC_BLOCK_SIZE);
+    }
+    BlockMetricGrid grid = {0};
+    CHECK(compute_frame_block_metrics(source, test, &grid) == 0);
+    CHECK(grid.width == width && grid.height == height);
+    CHECK(grid.blocks_w == 4 && grid.blocks_h == 2);
+
+    uint64_t frame_sse = 0;
+    for (int by = 0; by < grid.blocks_h; by++) {
+        for (int bx = 0; bx < grid.blocks_w; bx++) {
+            int x0 = bx * METRIC_BLOCK_SIZE;
+            int y0 = by * METRIC_BLOCK_SIZE;
+            int cols = SDL_min(METRIC_BLOCK_SIZE, width - x0);
+            int rows = SDL_min(METRIC_BLOCK_SIZE, height - y0);
+            uint64_t sse = 0;
+            for (int y = y0; y < y0 + rows; y++) {
+                sse += reference_row_sse(source->data[0] + y * source->linesize[0] + x0, test->data[0] + y * test->linesize[0] + x0, cols);
+            }
+            frame_sse += sse;
+            double psnr = sse == 0 ? METRIC_PSNR_MAX : SDL_min(METRIC_PSNR_MAX, 10.0 * log10(255.0 * 255.0 * rows * cols / sse));
+            CHECK(grid.block_psnr_q8[by * grid.blocks_w + bx] == (uint16_t)(psnr * 256.0 + 0.5));
+        }
+    }
+    CHECK(grid.block_psnr_q8[1] == (uint16_t)(METRIC_PSNR_MAX * 256.0));
+    CHECK(fabs(grid.frame_psnr - 10.0 * log10(255.0 * 255.0 * width * height / frame_sse)) < 1e-9);
+    CHECK(fabs(compute_frame_psnr(source, test) - grid.frame_psnr) < 1e-9);
+
+    // mismatched geometry and packed formats are refused
+    test->width--;
+    CHECK(compute_frame_block_metrics(source, test, &grid) == -1);
+    test->width++;
+    source->format = AV_PIX_FMT_YUYV422;
+    test->format = AV_PIX_FMT_YUYV422;
+    CHECK(compute_frame_block_metrics(source, test, &grid) == -1);
+
+    av_freep(&grid.block_psnr_q8);
+    free_luma_frame(source);
+    free_luma_frame(test);
+}
+
+static void test_insert_worst_block() {
+    reset_block_metrics();
+    uint16_t values[200];
+    for (int i = 0; i < (int)SDL_arraysize(values); i++) {
+        values[i] = (uint16_t)test_random(20000);
+        insert_worst_block(i % MAX_TEST_ENCODES, i, i % 5, i % 3, values[i]);
+    }
+    // the index holds the WORST_BLOCKS_MAX lowest values, lowest first
+    CHECK(worst_blocks_count == WORST_BLOCKS_MAX);
+    for (int rank = 0; rank < WORST_BLOCKS_MAX; rank++) {
+        const WorstBlockEntry *entry = get_worst_block(rank);
+        CHECK(entry->psnr_q8 == values[entry->frame_index]);
+        CHECK(entry->block_x == entry->frame_index % 5 && entry->block_y == entry->frame_index % 3);
+        CHECK(rank == 0 || get_worst_block(rank - 1)->psnr_q8 <= entry->psnr_q8);
+        int lower = 0;
+        for (int i = 0; i < (int)SDL_arraysize(values); i++) {
+            lower += values[i] < entry->psnr_q8;
+        }
+        CHECK(lower <= rank);
+    }
+    CHECK(get_worst_block(WORST_BLOCKS_MAX) == NULL);
+    CHECK(get_worst_block(-1) == NULL);
+    reset_block_metrics();
+}
+
+// a frame analyzed again gives back the index slots its old blocks took
+static void test_worst_blocks_after_reanalysis() {
+    reset_block_metrics();
+    for (int f = 0; f < 2; f++) {
+        BlockMetricGrid grid = {0};
+        grid.width = grid.height = METRIC_BLOCK_SIZE * 8;
+        grid.blocks_w = grid.blocks_h = 8;
+        grid.block_psnr_q8 = (uint16_t *)av_malloc_array(64, sizeof(uint16_t));
+        for (int b = 0; b < 64; b++) {
+            grid.block_psnr_q8[b] = (uint16_t)((f == 0 ? 1000 : 2000) + b);
+        }
+        store_frame_block_metrics(0, f, &grid);
+        av_freep(&grid.block_psnr_q8);
+    }
+    CHECK(get_worst_block(WORST_BLOCKS_MAX - 1)->frame_index == 0);
+
+    BlockMetricGrid grid = {0};
+    grid.width = grid.height = METRIC_BLOCK_SIZE * 8;
+    grid.blocks_w = grid.blocks_h = 8;
+    grid.block_psnr_q8 = (uint16_t *)av_malloc_array(64, sizeof(uint16_t));
+    for (int b = 0; b < 64; b++) {
+        grid.block_psnr_q8[b] = (uint16_t)(3000 + b);
+    }
+    store_frame_block_metrics(0, 0, &grid);
+    av_freep(&grid.block_psnr_q8);
+    for (int rank = 0; rank < WORST_BLOCKS_MAX; rank++) {
+        CHECK(get_worst_block(rank)->frame_index == 1);
+        CHECK(get_worst_block(rank)->psnr_q8 == 2000 + rank);
+    }
+    reset_block_metrics();
+}
+
+int main(int argc, char **argv) {
+    (void)argc;
+    (void)argv;
+    av_log_set_level(AV_LOG_QUIET);
+    block_metrics_mutex = SDL_CreateMutex();
+    test_worker_failing_open();
+    test_job_failing_open();
+    test_partition_at_keyframes();
+    test_next_worker_segment();
+    test_checkpoint_resume();
+    test_results_merge_in_order();
+    test_row_sse_u8();
+    test_compute_frame_block_metrics();
+    test_insert_worst_block();
+    test_worst_blocks_after_reanalysis();
+    SDL_DestroyMutex(block_metrics_mutex);
+    if (test_failures) {
+        fprintf(stderr, "%d checks failed\n", test_failures);
+        return 1;
+    }
+    printf("all analysis checks passed\n");
+    return 0;
+}